@@ -34,6 +34,22 @@ android {
                 getDefaultProguardFile("proguard-android-optimize.txt"),
                 "proguard-rules.pro"
             )
+            
+            // Optimized native build: LTO, section GC, ICF (src/main/cpp/cmake)
+            externalNativeBuild {
+                cmake {
+                    arguments += "-DCMAKE_BUILD_TYPE=Release"
+                    
+                    // PGO profile from scripts/native-pgo.sh, once collected
+                    val pgoProfile = file("src/main/cpp/pgo/noghresod.profdata")
+                    if (pgoProfile.exists()) {
+                        arguments += listOf(
+                            "-DNOGHRESOD_PGO=USE",
+                            "-DNOGHRESOD_PGO_PROFILE=${pgoProfile.absolutePath}"
+                        )
+                    }
+                }
+            }
         }
     }
     
@@ -89,6 +89,18 @@
 -keep class com.noghre.sod.data.local.security.** { *; }
 -keep class com.noghre.sod.data.remote.CertificatePinningUtil { *; }
 
+# Native bindings are registered by name from JNI_OnLoad
+-keep class com.noghre.sod.core.security.NativeKeys { native <methods>; }
+-keep class com.noghre.sod.core.security.KeyProvider { native <methods>; }
+-keep class com.noghre.sod.core.security.NativeKeyManager { native <methods>; }
+-keep class com.noghre.sod.core.security.NativeCrypto { native <methods>; }
+-keep class com.noghre.sod.core.monitoring.NativeStats { native <methods>; }
+-keep class com.noghre.sod.core.util.NativeDigits { native <methods>; }
+-keep class com.noghre.sod.core.util.NativePriceFormatter { native <methods>; }
+-keep class com.noghre.sod.core.util.NativeJalali { native <methods>; }
+-keep class com.noghre.sod.core.util.NativeDateFormatter { native <methods>; }
+-keep class com.noghre.sod.core.util.NativeMoney { native <methods>; }
+
 # ============== Exception Handling ==============
 
 -keep class com.noghre.sod.domain.model.AppException { *; }
@@ -0,0 +1,281 @@
+// Host benchmark for the AES-256-GCM engine in src/aes_gcm.cpp.
+//
+// Checks the selected backend against the GCM specification test vectors,
+// GcmStream in odd-sized chunks against the one-shot engine, and the
+// LocalDataCipher fd container (round trips and a flipped bit), then
+// reports key-setup cost and one-shot encrypt/decrypt throughput.
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "aes_gcm.h"
+#include "local_crypto.h"
+#include "microbench.h"
+
+using noghresod::AesGcm;
+using noghresod::GcmStream;
+using noghresod::LocalDataCipher;
+using microbench::nowNs;
+
+namespace {
+    void fromHex(const char* hex, uint8_t* out) {
+        for (size_t i = 0; hex[2 * i] != '\0'; i++) {
+            unsigned value = 0;
+            std::sscanf(hex + 2 * i, "%2x", &value);
+            out[i] = static_cast<uint8_t>(value);
+        }
+    }
+
+    /**
+     * GCM spec test cases 14 and 16 (AES-256).
+     */
+    bool verifyVectors() {
+        uint8_t key[32] = {};
+        uint8_t iv[12] = {};
+        uint8_t plain[64] = {};
+        uint8_t cipher[64];
+        uint8_t tag[16];
+        uint8_t expected[64];
+        uint8_t expectedTag[16];
+
+        {
+            AesGcm gcm(key);
+            gcm.encrypt(iv, nullptr, 0, plain, 16, cipher, tag);
+            fromHex("cea7403d4d606b6e074ec5d3baf39d18", expected);
+            fromHex("d0d1c8a799996bf0265b98b5d48ab919", expectedTag);
+            if (std::memcmp(cipher, expected, 16) != 0 || std::memcmp(tag, expectedTag, 16) != 0) {
+                return false;
+            }
+        }
+
+        uint8_t aad[20];
+        fromHex("feffe9928665731c6d6a8f9467308308feffe9928665731c6d6a8f9467308308", key);
+        fromHex("cafebabefacedbaddecaf888", iv);
+        fromHex("d9313225f88406e5a55909c5aff5269a86a7a9531534f7da2e4c303d8a318a72"
+                "1c3c0c95956809532fcf0e2449a6b525b16aedf5aa0de657ba637b39", plain);
+        fromHex("feedfacedeadbeeffeedfacedeadbeefabaddad2", aad);
+        fromHex("522dc1f099567d07f47f37a32a84427d643a8cdcbfe5c0c97598a2bd2555d1aa"
+                "8cb08e48590dbb3da7b08b1056828838c5f61e6393ba7a0abcc9f662", expected);
+        fromHex("76fc6ece0f4e1768cddf8853bb2d551b", expectedTag);
+
+        AesGcm gcm(key);
+        gcm.encrypt(iv, aad, sizeof(aad), plain, 60, cipher, tag);
+        if (std::memcmp(cipher, expected, 60) != 0 || std::memcmp(tag, expectedTag, 16) != 0) {
+            return false;
+        }
+
+        uint8_t roundTrip[64];
+        return gcm.decrypt(iv, aad, sizeof(aad), cipher, 60, tag, roundTrip) &&
+               std::memcmp(roundTrip, plain, 60) == 0;
+    }
+
+    /**
+     * Feed [in] to [stream] in chunks of [chunk] bytes; [out] may be [in].
+     */
+    void streamChunks(GcmStream& stream, const uint8_t* in, size_t size, uint8_t* out, size_t chunk) {
+        for (size_t done = 0; done < size; done += chunk) {
+            stream.update(in + done, std::min(chunk, size - done), out + done);
+        }
+    }
+
+    /**
+     * Odd chunk sizes give the one-shot result: test case 16 and a longer
+     * message, encrypting out of place and decrypting in place.
+     */
+    bool verifyChunks() {
+        uint8_t key[32];
+        uint8_t iv[12];
+        uint8_t aad[20];
+        fromHex("feffe9928665731c6d6a8f9467308308feffe9928665731c6d6a8f9467308308", key);
+        fromHex("cafebabefacedbaddecaf888", iv);
+        fromHex("feedfacedeadbeeffeedfacedeadbeefabaddad2", aad);
+        AesGcm gcm(key);
+
+        for (size_t size : { size_t(60), size_t(1000) }) {
+            std::vector<uint8_t> plain(size);
+            if (size == 60) {
+                fromHex("d9313225f88406e5a55909c5aff5269a86a7a9531534f7da2e4c303d8a318a72"
+                        "1c3c0c95956809532fcf0e2449a6b525b16aedf5aa0de657ba637b39", plain.data());
+            } else {
+                for (size_t i = 0; i < size; i++) {
+                    plain[i] = static_cast<uint8_t>(i * 31 + 7);
+                }
+            }
+            std::vector<uint8_t> expected(size);
+            uint8_t expectedTag[16];
+            gcm.encrypt(iv, aad, sizeof(aad), plain.data(), size, expected.data(), expectedTag);
+
+            for (size_t chunk : { size_t(1), size_t(7), size_t(15), size_t(16), size_t(17), size_t(33), size_t(59) }) {
+                std::vector<uint8_t> work(size);
+                uint8_t tag[16];
+                GcmStream encryptor(gcm, iv, GcmStream::Mode::ENCRYPT);
+                encryptor.updateAad(aad, 7);
+                encryptor.updateAad(aad + 7, sizeof(aad) - 7);
+                streamChunks(encryptor, plain.data(), size, work.data(), chunk);
+                encryptor.finish(tag);
+                if (work != expected || std::memcmp(tag, expectedTag, 16) != 0) {
+                    std::printf("chunk=%zu size=%zu encrypt differs from one-shot\n", chunk, size);
+                    return false;
+                }
+
+                GcmStream decryptor(gcm, iv, GcmStream::Mode::DECRYPT);
+                decryptor.updateAad(aad, sizeof(aad));
+                streamChunks(decryptor, work.data(), size, work.data(), chunk);
+                if (!decryptor.verify(expectedTag) || work != plain) {
+                    std::printf("chunk=%zu size=%zu in-place decrypt differs\n", chunk, size);
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    /**
+     * A temporary file holding [data], rewound.
+     */
+    FILE* tempFileWith(const std::vector<uint8_t>& data) {
+        FILE* file = std::tmpfile();
+        if (file != nullptr && !data.empty() && std::fwrite(data.data(), 1, data.size(), file) != data.size()) {
+            std::fclose(file);
+            return nullptr;
+        }
+        if (file != nullptr) {
+            std::fflush(file);
+            std::rewind(file);
+        }
+        return file;
+    }
+
+    /**
+     * Everything in [file] from the start.
+     */
+    std::vector<uint8_t> contents(FILE* file) {
+        struct stat info;
+        std::vector<uint8_t> data;
+        if (fstat(fileno(file), &info) == 0) {
+            data.resize(static_cast<size_t>(info.st_size));
+            if (pread(fileno(file), data.data(), data.size(), 0) != static_cast<ssize_t>(data.size())) {
+                data.clear();
+            }
+        }
+        return data;
+    }
+
+    /**
+     * encryptFd/decryptFd round trip at the container and chunk edges, and
+     * a container with one bit flipped is rejected with nothing left behind.
+     */
+    bool verifyFdContainer() {
+        const size_t chunk = LocalDataCipher::CHUNK_SIZE;
+        const size_t overhead = LocalDataCipher::HEADER_SIZE + LocalDataCipher::TAG_SIZE;
+        LocalDataCipher& cipher = LocalDataCipher::instance();
+
+        for (size_t size : { size_t(0), size_t(15), size_t(16), size_t(17), chunk, chunk + 5 }) {
+            std::vector<uint8_t> plain(size);
+            for (size_t i = 0; i < size; i++) {
+                plain[i] = static_cast<uint8_t>(i * 13 + 5);
+            }
+            FILE* input = tempFileWith(plain);
+            FILE* sealed = std::tmpfile();
+            FILE* output = std::tmpfile();
+            FILE* rejected = std::tmpfile();
+            bool ok = input != nullptr && sealed != nullptr && output != nullptr && rejected != nullptr &&
+                      cipher.encryptFd(fileno(input), fileno(sealed));
+
+            std::vector<uint8_t> container;
+            if (ok) {
+                container = contents(sealed);
+                lseek(fileno(sealed), 0, SEEK_SET);
+                ok = container.size() == size + overhead &&
+                     cipher.decryptFd(fileno(sealed), fileno(output)) &&
+                     contents(output) == plain;
+                if (!ok) {
+                    std::printf("size=%zu fd round trip failed\n", size);
+                }
+            }
+
+            if (ok) {
+                // A ciphertext bit, or a tag bit when there is no ciphertext
+                container[LocalDataCipher::HEADER_SIZE + size / 2] ^= 0x10;
+                FILE* tampered = tempFileWith(container);
+                ok = tampered != nullptr &&
+                     !cipher.decryptFd(fileno(tampered), fileno(rejected)) &&
+                     contents(rejected).empty();
+                if (!ok) {
+                    std::printf("size=%zu tampered container not rejected cleanly\n", size);
+                }
+                if (tampered != nullptr) {
+                    std::fclose(tampered);
+                }
+            }
+
+            for (FILE* file : { input, sealed, output, rejected }) {
+                if (file != nullptr) {
+                    std::fclose(file);
+                }
+            }
+            if (!ok) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void benchKeySetup() {
+        uint8_t key[32];
+        for (size_t i = 0; i < sizeof(key); i++) {
+            key[i] = static_cast<uint8_t>(i * 7 + 1);
+        }
+        const size_t iterations = 200000;
+        double startNs = nowNs();
+        for (size_t i = 0; i < iterations; i++) {
+            key[0] = static_cast<uint8_t>(i);
+            AesGcm gcm(key);
+        }
+        std::printf("key setup        %8.1f ns/op\n", (nowNs() - startNs) / iterations);
+    }
+
+    void benchThroughput(size_t size) {
+        uint8_t key[32] = { 1, 2, 3 };
+        uint8_t iv[12] = { 9, 8, 7 };
+        uint8_t tag[16];
+        std::vector<uint8_t> buffer(size, 0x5A);
+        AesGcm gcm(key);
+        size_t iterations = size >= (1u << 20) ? 100 : (32u << 20) / size;
+
+        double startNs = nowNs();
+        for (size_t i = 0; i < iterations; i++) {
+            gcm.encrypt(iv, nullptr, 0, buffer.data(), size, buffer.data(), tag);
+        }
+        double encryptNs = nowNs() - startNs;
+        double bytes = static_cast<double>(size) * static_cast<double>(iterations);
+
+        std::printf("encrypt size=%-8zu %8.2f GB/s %10.1f ns/op\n",
+                    size, bytes / encryptNs, encryptNs / iterations);
+    }
+}
+
+int main(int argc, char** argv) {
+    std::printf("backend: %s\n", AesGcm::backendName());
+    if (!verifyVectors()) {
+        std::printf("MISMATCH against GCM test vectors\n");
+        return 1;
+    }
+    if (!verifyChunks() || !verifyFdContainer()) {
+        std::printf("MISMATCH in streaming encryption\n");
+        return 1;
+    }
+    // --verify: correctness only, for ctest
+    if (argc > 1 && std::strcmp(argv[1], "--verify") == 0) {
+        return 0;
+    }
+
+    benchKeySetup();
+    for (size_t size : { size_t(64), size_t(1024), size_t(64 * 1024), size_t(1024 * 1024) }) {
+        benchThroughput(size);
+    }
+    return 0;
+}
@@ -0,0 +1,248 @@
+// Host benchmark for the digit transcoding kernels in src/digit_transcoder.cpp.
+//
+// Checks every kernel compiled for this host against a range-by-range
+// reference, then times them on a batch of price-like strings next to C++
+// ports of the Kotlin code they replace in PersianUtils: the per-character
+// StringBuilder loop of toPersianDigits() and the ten replace() passes of
+// toEnglishDigits(). The ports skip the JVM's per-digit String allocation,
+// so they understate what the Kotlin versions cost on a device.
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "cpu_features.h"
+#include "digit_transcoder.h"
+#include "microbench.h"
+
+using noghresod::DigitScript;
+using noghresod::digit_kernels::DigitFn;
+using microbench::nowNs;
+
+namespace {
+    struct Kernel {
+        const char* name;
+        DigitFn fn;
+        bool available;
+    };
+
+    const DigitScript SCRIPTS[] = { DigitScript::LATIN, DigitScript::PERSIAN, DigitScript::ARABIC_INDIC };
+
+    uint16_t reference(uint16_t c, uint16_t zero) {
+        if (c >= 0x0030 && c <= 0x0039) return static_cast<uint16_t>(zero + (c - 0x0030));
+        if (c >= 0x0660 && c <= 0x0669) return static_cast<uint16_t>(zero + (c - 0x0660));
+        if (c >= 0x06F0 && c <= 0x06F9) return static_cast<uint16_t>(zero + (c - 0x06F0));
+        return c;
+    }
+
+    /**
+     * Digits of all three scripts, their neighbours on both sides and a few
+     * values whose wrapped differences land near 0..9.
+     */
+    std::vector<uint16_t> mixedInput(size_t length, uint32_t seed) {
+        static const uint16_t EDGES[] = {
+            0x002F, 0x003A, 0x065F, 0x066A, 0x06EF, 0x06FA, 0x0000, 0xFFFF,
+            0x0020, 0x062A, 0x066B, 0x066C, 0x2212, 0xFFD0, 0xF96A, 0xF990,
+        };
+        std::vector<uint16_t> chars(length);
+        for (size_t i = 0; i < length; i++) {
+            seed = seed * 1103515245u + 12345u;
+            uint32_t r = seed >> 16;
+            switch (r % 4) {
+                case 0: chars[i] = static_cast<uint16_t>(0x0030 + r / 4 % 10); break;
+                case 1: chars[i] = static_cast<uint16_t>(0x06F0 + r / 4 % 10); break;
+                case 2: chars[i] = static_cast<uint16_t>(0x0660 + r / 4 % 10); break;
+                default: chars[i] = EDGES[r / 4 % (sizeof(EDGES) / sizeof(EDGES[0]))]; break;
+            }
+        }
+        return chars;
+    }
+
+    bool verify(const Kernel& kernel, size_t length, DigitScript target) {
+        uint16_t zero = noghresod::digitZero(target);
+        std::vector<uint16_t> actual = mixedInput(length, static_cast<uint32_t>(length * 7 + 1));
+        std::vector<uint16_t> expected(actual);
+        bool expectedChanged = false;
+        for (uint16_t& c : expected) {
+            uint16_t mapped = reference(c, zero);
+            expectedChanged |= mapped != c;
+            c = mapped;
+        }
+        bool changed = kernel.fn(actual.data(), actual.size(), zero);
+        if (actual != expected || changed != expectedChanged) {
+            return false;
+        }
+        // Already in the target script: nothing may change
+        return !kernel.fn(actual.data(), actual.size(), zero) && actual == expected;
+    }
+
+    /**
+     * [count] strings the app actually converts: prices, weights and phone numbers.
+     */
+    std::vector<std::u16string> batch(size_t count) {
+        static const char16_t* const SAMPLES[] = {
+            u"1,250,000 تومان",
+            u"۲۵.۵ گرم",
+            u"0912 345 6789",
+            u"قیمت: ١٢٣٤٥",
+            u"Silver ring 925 - size 18",
+            u"نقره ساده",
+        };
+        const size_t sampleCount = sizeof(SAMPLES) / sizeof(SAMPLES[0]);
+        std::vector<std::u16string> strings;
+        strings.reserve(count);
+        for (size_t i = 0; i < count; i++) {
+            strings.emplace_back(SAMPLES[i % sampleCount]);
+        }
+        return strings;
+    }
+
+    // PersianUtils.toPersianDigits: one builder append per character
+    std::u16string builderToPersian(const std::u16string& input) {
+        std::u16string builder;
+        for (char16_t c : input) {
+            uint16_t mapped = reference(c, 0x06F0);
+            builder.push_back(static_cast<char16_t>(mapped));
+        }
+        return builder;
+    }
+
+    // PersianUtils.toEnglishDigits: one replace pass, and one copy, per digit
+    std::u16string replaceToLatin(const std::u16string& input) {
+        std::u16string result = input;
+        for (char16_t digit = 0; digit < 10; digit++) {
+            std::u16string next = result;
+            for (char16_t& c : next) {
+                if (c == 0x06F0 + digit) {
+                    c = static_cast<char16_t>(u'0' + digit);
+                }
+            }
+            result.swap(next);
+        }
+        return result;
+    }
+
+    size_t totalChars(const std::vector<std::u16string>& strings) {
+        size_t total = 0;
+        for (const std::u16string& s : strings) {
+            total += s.size();
+        }
+        return total;
+    }
+
+    void report(const char* name, const char* target, size_t chars, size_t iterations, double elapsedNs) {
+        double perBatchNs = elapsedNs / static_cast<double>(iterations);
+        std::printf("%-10s -> %-8s %8.3f chars/ns %10.1f us/batch\n",
+                    name, target, static_cast<double>(chars) * static_cast<double>(iterations) / elapsedNs,
+                    perBatchNs / 1000.0);
+    }
+
+    const size_t ITERATIONS = 200;
+
+    /**
+     * The JNI batch path: concatenate, convert in one pass, slice back out.
+     */
+    void runKernel(const Kernel& kernel, const std::vector<std::u16string>& strings,
+                   DigitScript target, const char* targetName) {
+        size_t chars = totalChars(strings);
+        std::vector<uint16_t> buffer(chars);
+        uint16_t zero = noghresod::digitZero(target);
+        size_t sink = 0;
+
+        double startNs = nowNs();
+        for (size_t iteration = 0; iteration < ITERATIONS; iteration++) {
+            size_t offset = 0;
+            for (const std::u16string& s : strings) {
+                std::memcpy(buffer.data() + offset, s.data(), s.size() * sizeof(uint16_t));
+                offset += s.size();
+            }
+            kernel.fn(buffer.data(), buffer.size(), zero);
+            offset = 0;
+            for (const std::u16string& s : strings) {
+                std::u16string out(reinterpret_cast<const char16_t*>(buffer.data() + offset), s.size());
+                sink += out[0];
+                offset += s.size();
+            }
+        }
+        report(kernel.name, targetName, chars, ITERATIONS, nowNs() - startNs);
+        if (sink == 1) {
+            std::printf(" ");
+        }
+    }
+
+    template <typename Convert>
+    void runBaseline(const char* name, const std::vector<std::u16string>& strings,
+                     const char* targetName, Convert convert) {
+        size_t sink = 0;
+        double startNs = nowNs();
+        for (size_t iteration = 0; iteration < ITERATIONS; iteration++) {
+            for (const std::u16string& s : strings) {
+                sink += convert(s)[0];
+            }
+        }
+        report(name, targetName, totalChars(strings), ITERATIONS, nowNs() - startNs);
+        if (sink == 1) {
+            std::printf(" ");
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    // --verify: correctness checks only, for ctest
+    bool verifyOnly = argc > 1 && std::strcmp(argv[1], "--verify") == 0;
+    namespace k = noghresod::digit_kernels;
+    const noghresod::CpuFeatures& cpu = noghresod::cpuFeatures();
+    const Kernel kernels[] = {
+        { "scalar", k::scalar, true },
+        { "sse2", k::sse2(), k::sse2() != nullptr },
+        { "avx2", k::avx2(), k::avx2() != nullptr && cpu.has(noghresod::CPU_AVX2) },
+        { "neon", k::neon(), k::neon() != nullptr && cpu.has(noghresod::CPU_NEON) },
+    };
+
+    std::printf("dispatch: %s\n", noghresod::digitKernelName());
+
+    int failures = 0;
+    for (const Kernel& kernel : kernels) {
+        if (!kernel.available) {
+            continue;
+        }
+        for (DigitScript target : SCRIPTS) {
+            for (size_t length = 0; length <= 70; length++) {
+                if (!verify(kernel, length, target)) {
+                    std::printf("MISMATCH %s target=%d length=%zu\n",
+                                kernel.name, static_cast<int>(target), length);
+                    failures++;
+                }
+            }
+            if (!verify(kernel, 4099, target)) {
+                std::printf("MISMATCH %s target=%d length=4099\n", kernel.name, static_cast<int>(target));
+                failures++;
+            }
+        }
+    }
+
+    // The dispatched entry point, through its own table
+    std::vector<uint16_t> digits = { u'1', 0x0662, 0x06F3, u'x' };
+    if (!noghresod::transcodeDigits(digits.data(), digits.size(), DigitScript::PERSIAN) ||
+        digits != std::vector<uint16_t>{ 0x06F1, 0x06F2, 0x06F3, u'x' } ||
+        noghresod::transcodeDigits(digits.data(), 0, DigitScript::LATIN)) {
+        std::printf("MISMATCH transcodeDigits\n");
+        failures++;
+    }
+
+    if (verifyOnly || failures != 0) {
+        return failures == 0 ? 0 : 1;
+    }
+
+    std::vector<std::u16string> strings = batch(4096);
+    runBaseline("builder", strings, "persian", builderToPersian);
+    runBaseline("replace", strings, "latin", replaceToLatin);
+    for (const Kernel& kernel : kernels) {
+        if (!kernel.available) {
+            continue;
+        }
+        runKernel(kernel, strings, DigitScript::PERSIAN, "persian");
+        runKernel(kernel, strings, DigitScript::LATIN, "latin");
+    }
+    return 0;
+}
@@ -0,0 +1,241 @@
+// Host benchmark for the Jalali calendar engine in src/jalali.cpp.
+//
+// Checks every day of the table against a port of the reference algorithm
+// in PersianDateConverter.kt (jalaali-js: break-point search, then the
+// Gregorian round trip) and the round trip back to epoch days, then times
+// a large order list through the batch entry point next to the reference.
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "jalali.h"
+#include "microbench.h"
+
+namespace jalali = noghresod::jalali;
+using microbench::nowNs;
+
+namespace {
+    // ==========================
+    // PersianDateConverter.kt, line for line
+    // ==========================
+
+    const int32_t BREAKS[] = {
+        -61, 9, 38, 199, 426, 686, 756, 818, 1111, 1181, 1210,
+        1635, 2060, 2097, 2192, 2262, 2324, 2394, 2456, 3178
+    };
+
+    struct JalCal {
+        int32_t leap;
+        int32_t gy;
+        int32_t march;
+    };
+
+    JalCal jalCal(int32_t jy) {
+        int32_t gy = jy + 621;
+        int32_t leapJ = -14;
+        int32_t jp = BREAKS[0];
+        int32_t jump = 0;
+        for (size_t i = 1; i < sizeof(BREAKS) / sizeof(BREAKS[0]); i++) {
+            int32_t jm = BREAKS[i];
+            jump = jm - jp;
+            if (jy < jm) break;
+            leapJ += jump / 33 * 8 + jump % 33 / 4;
+            jp = jm;
+        }
+        int32_t n = jy - jp;
+        leapJ += n / 33 * 8 + (n % 33 + 3) / 4;
+        if (jump % 33 == 4 && jump - n == 4) leapJ++;
+        int32_t leapG = gy / 4 - (gy / 100 + 1) * 3 / 4 - 150;
+        int32_t march = 20 + leapJ - leapG;
+        if (jump - n < 6) n = n - jump + (jump + 4) / 33 * 33;
+        int32_t leap = ((n + 1) % 33 - 1) % 4;
+        if (leap == -1) leap = 4;
+        return { leap, gy, march };
+    }
+
+    int32_t g2d(int32_t gy, int32_t gm, int32_t gd) {
+        int32_t d = (gy + (gm - 8) / 6 + 100100) * 1461 / 4
+            + (153 * ((gm + 9) % 12) + 2) / 5 + gd - 34840408;
+        return d - (gy + 100100 + (gm - 8) / 6) / 100 * 3 / 4 + 752;
+    }
+
+    int32_t d2gYear(int32_t jdn) {
+        int32_t j = 4 * jdn + 139361631;
+        j = j + (4 * jdn + 183187720) / 146097 * 3 / 4 * 4 - 3908;
+        int32_t i = j % 1461 / 4 * 5 + 308;
+        int32_t gm = i / 153 % 12 + 1;
+        return j / 1461 - 100100 + (8 - gm) / 6;
+    }
+
+    struct Date {
+        int32_t year;
+        int32_t month;
+        int32_t day;
+    };
+
+    Date d2j(int32_t jdn) {
+        int32_t gy = d2gYear(jdn);
+        int32_t jy = gy - 621;
+        JalCal r = jalCal(jy);
+        int32_t k = jdn - g2d(gy, 3, r.march);
+        if (k >= 0) {
+            if (k <= 185) return { jy, 1 + k / 31, k % 31 + 1 };
+            k -= 186;
+        } else {
+            jy--;
+            k += 179;
+            if (r.leap == 1) k++;
+        }
+        return { jy, 7 + k / 30, k % 30 + 1 };
+    }
+
+    const int32_t UNIX_EPOCH_JDN = 2440588;
+
+    Date referenceFromEpochDay(int64_t epochDay) {
+        return d2j(static_cast<int32_t>(epochDay) + UNIX_EPOCH_JDN);
+    }
+
+    // ==========================
+
+    Date unpack(uint32_t packed) {
+        return {
+            static_cast<int32_t>(packed >> jalali::PACKED_YEAR_SHIFT),
+            static_cast<int32_t>(packed >> jalali::PACKED_MONTH_SHIFT & 0xF),
+            static_cast<int32_t>(packed >> jalali::PACKED_DAY_SHIFT & 0x1F),
+        };
+    }
+
+    int32_t weekdayOf(int64_t epochDay) {
+        // 1970-01-01 was a Thursday: 5 counting from Saturday
+        return static_cast<int32_t>(((epochDay + 5) % 7 + 7) % 7);
+    }
+
+    int verifyTable() {
+        const int64_t first = g2d(1921, 3, 21) - UNIX_EPOCH_JDN;
+        const int64_t last = g2d(2122, 3, 20) - UNIX_EPOCH_JDN;
+        int failures = 0;
+        for (int64_t day = first; day <= last && failures < 10; day++) {
+            uint32_t packed = jalali::fromEpochDay(day);
+            Date actual = unpack(packed);
+            Date expected = referenceFromEpochDay(day);
+            int64_t back = 0;
+            bool roundTrip = jalali::toEpochDay(actual.year, actual.month, actual.day, &back) && back == day;
+            if (actual.year != expected.year || actual.month != expected.month ||
+                actual.day != expected.day ||
+                static_cast<int32_t>(packed & jalali::PACKED_WEEKDAY_MASK) != weekdayOf(day) || !roundTrip) {
+                std::printf("MISMATCH epoch day %lld: %d/%d/%d, reference %d/%d/%d\n",
+                            static_cast<long long>(day), actual.year, actual.month, actual.day,
+                            expected.year, expected.month, expected.day);
+                failures++;
+            }
+        }
+        if (jalali::fromEpochDay(first - 1) != 0 || jalali::fromEpochDay(last + 1) != 0) {
+            std::printf("MISMATCH days outside the table are not 0\n");
+            failures++;
+        }
+        return failures;
+    }
+
+    int verifyKnownDates() {
+        struct Known {
+            int32_t gy, gm, gd;
+            Date jalali;
+            int32_t weekday;
+        };
+        const Known known[] = {
+            { 2024, 3, 20, { 1403, 1, 1 }, 4 },     // Nowruz, Wednesday
+            { 2024, 12, 28, { 1403, 10, 8 }, 0 },   // Saturday
+            { 2025, 3, 20, { 1403, 12, 30 }, 5 },   // leap Esfand
+            { 2024, 3, 19, { 1402, 12, 29 }, 3 },
+            { 1979, 2, 11, { 1357, 11, 22 }, 1 },
+        };
+        int failures = 0;
+        for (const Known& k : known) {
+            int64_t day = g2d(k.gy, k.gm, k.gd) - UNIX_EPOCH_JDN;
+            uint32_t packed = jalali::fromEpochDay(day);
+            Date actual = unpack(packed);
+            if (actual.year != k.jalali.year || actual.month != k.jalali.month ||
+                actual.day != k.jalali.day ||
+                static_cast<int32_t>(packed & jalali::PACKED_WEEKDAY_MASK) != k.weekday) {
+                std::printf("MISMATCH %d-%02d-%02d\n", k.gy, k.gm, k.gd);
+                failures++;
+            }
+        }
+        int64_t unused;
+        if (jalali::toEpochDay(1402, 12, 30, &unused) || jalali::toEpochDay(1403, 7, 31, &unused) ||
+            jalali::toEpochDay(1299, 12, 29, &unused) || jalali::toEpochDay(1403, 13, 1, &unused)) {
+            std::printf("MISMATCH invalid dates accepted\n");
+            failures++;
+        }
+        return failures;
+    }
+
+    int verifyMillis() {
+        const int64_t tehran = (3 * 60 + 30) * 60 * 1000;
+        // 2024-03-19T20:29:59.999Z and a millisecond later: Nowruz in Tehran
+        const int64_t nowruz = (g2d(2024, 3, 20) - UNIX_EPOCH_JDN) * jalali::MILLIS_PER_DAY - tehran;
+        const int64_t millis[] = { nowruz - 1, nowruz, -1, 0, INT64_C(5000000000000) };
+        const size_t count = sizeof(millis) / sizeof(millis[0]);
+        uint32_t out[count];
+        jalali::fromEpochMillis(millis, count, tehran, out);
+        uint32_t utc[count];
+        jalali::fromEpochMillis(millis, count, 0, utc);
+
+        bool ok = out[0] == jalali::fromEpochDay(19801) && out[1] == jalali::fromEpochDay(19802) &&
+                  utc[2] == jalali::fromEpochDay(-1) && utc[3] == jalali::fromEpochDay(0) &&
+                  out[4] == 0;
+        if (!ok) {
+            std::printf("MISMATCH fromEpochMillis\n");
+            return 1;
+        }
+        return 0;
+    }
+
+    void runBatch(size_t count) {
+        std::vector<int64_t> millis(count);
+        std::vector<uint32_t> out(count);
+        // Orders spread over the last ten years
+        const int64_t start = INT64_C(1400000000000);
+        for (size_t i = 0; i < count; i++) {
+            millis[i] = start + static_cast<int64_t>(i) * INT64_C(77777777) % (INT64_C(315360000000));
+        }
+        const int iterations = 200;
+
+        double startNs = nowNs();
+        for (int i = 0; i < iterations; i++) {
+            jalali::fromEpochMillis(millis.data(), count, 12600000, out.data());
+        }
+        double tableNs = (nowNs() - startNs) / iterations;
+
+        uint32_t sink = out[count / 2];
+        startNs = nowNs();
+        for (int i = 0; i < iterations; i++) {
+            for (size_t j = 0; j < count; j++) {
+                int64_t day = (millis[j] + 12600000) / jalali::MILLIS_PER_DAY;
+                sink += static_cast<uint32_t>(referenceFromEpochDay(day).day);
+            }
+        }
+        double referenceNs = (nowNs() - startNs) / iterations;
+
+        std::printf("%-8zu orders  table %9.2f us (%5.2f ns/date)  reference %9.2f us (%5.2f ns/date)\n",
+                    count, tableNs / 1000.0, tableNs / count, referenceNs / 1000.0, referenceNs / count);
+        if (sink == 1) {
+            std::printf(" ");
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    // --verify: correctness checks only, for ctest
+    bool verifyOnly = argc > 1 && std::strcmp(argv[1], "--verify") == 0;
+
+    int failures = verifyTable() + verifyKnownDates() + verifyMillis();
+    if (verifyOnly || failures != 0) {
+        return failures == 0 ? 0 : 1;
+    }
+
+    for (size_t count : { size_t(100), size_t(1000), size_t(10000), size_t(100000) }) {
+        runBatch(count);
+    }
+    return 0;
+}
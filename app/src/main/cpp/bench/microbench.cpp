@@ -0,0 +1,280 @@
+#include "microbench.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <new>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+// ==========================
+// ALLOCATION COUNTING
+// ==========================
+
+namespace {
+    std::atomic<uint64_t> allocationCount{0};
+    std::atomic<uint64_t> allocationBytes{0};
+
+    void* countedAlloc(size_t size, size_t alignment) {
+        allocationCount.fetch_add(1, std::memory_order_relaxed);
+        allocationBytes.fetch_add(size, std::memory_order_relaxed);
+        if (size == 0) {
+            size = 1;
+        }
+        void* block = nullptr;
+        if (alignment <= alignof(std::max_align_t)) {
+            block = std::malloc(size);
+        } else if (posix_memalign(&block, alignment, size) != 0) {
+            block = nullptr;
+        }
+        return block;
+    }
+}
+
+void* operator new(size_t size) {
+    void* block = countedAlloc(size, 0);
+    if (block == nullptr) {
+        throw std::bad_alloc();
+    }
+    return block;
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+void* operator new(size_t size, std::align_val_t alignment) {
+    void* block = countedAlloc(size, static_cast<size_t>(alignment));
+    if (block == nullptr) {
+        throw std::bad_alloc();
+    }
+    return block;
+}
+
+void* operator new[](size_t size, std::align_val_t alignment) {
+    return operator new(size, alignment);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    return countedAlloc(size, 0);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    return countedAlloc(size, 0);
+}
+
+void operator delete(void* block) noexcept { std::free(block); }
+void operator delete[](void* block) noexcept { std::free(block); }
+void operator delete(void* block, size_t) noexcept { std::free(block); }
+void operator delete[](void* block, size_t) noexcept { std::free(block); }
+void operator delete(void* block, std::align_val_t) noexcept { std::free(block); }
+void operator delete[](void* block, std::align_val_t) noexcept { std::free(block); }
+void operator delete(void* block, size_t, std::align_val_t) noexcept { std::free(block); }
+void operator delete[](void* block, size_t, std::align_val_t) noexcept { std::free(block); }
+void operator delete(void* block, const std::nothrow_t&) noexcept { std::free(block); }
+void operator delete[](void* block, const std::nothrow_t&) noexcept { std::free(block); }
+
+namespace microbench {
+
+namespace {
+    struct Benchmark {
+        const char* name;
+        Function function;
+    };
+
+    struct Result {
+        const char* name;
+        size_t iterations;
+        double nsPerOp;
+        double allocsPerOp;
+        double bytesPerOp;
+        const char* error;
+    };
+
+    std::vector<Benchmark>& registry() {
+        static std::vector<Benchmark> benchmarks;
+        return benchmarks;
+    }
+
+    std::vector<std::pair<std::string, std::string>>& context() {
+        static std::vector<std::pair<std::string, std::string>> entries;
+        return entries;
+    }
+
+    std::string quoted(const std::string& text) {
+        std::string out = "\"";
+        for (char c : text) {
+            if (c == '"' || c == '\\') {
+                out += '\\';
+                out += c;
+            } else if (static_cast<unsigned char>(c) < 0x20) {
+                char escape[8];
+                std::snprintf(escape, sizeof(escape), "\\u%04x", c);
+                out += escape;
+            } else {
+                out += c;
+            }
+        }
+        return out + "\"";
+    }
+
+    Result run(const Benchmark& benchmark, double minTimeNs, bool verifyOnly) {
+        size_t iterations = 1;
+        for (;;) {
+            State state(iterations);
+            benchmark.function(state);
+
+            bool done = verifyOnly || state.error() != nullptr ||
+                        state.elapsedNs() >= minTimeNs || iterations >= (size_t(1) << 30);
+            if (done) {
+                return {
+                    benchmark.name,
+                    iterations,
+                    state.elapsedNs() / iterations,
+                    static_cast<double>(state.allocations()) / iterations,
+                    static_cast<double>(state.allocatedBytes()) / iterations,
+                    state.error()
+                };
+            }
+
+            // Aim 40% past the target from the last run, growing at most 10x
+            double perOp = state.elapsedNs() > 0 ? state.elapsedNs() / iterations : 1.0;
+            double next = minTimeNs * 1.4 / perOp;
+            if (next > iterations * 10.0) {
+                next = iterations * 10.0;
+            }
+            iterations = next > iterations ? static_cast<size_t>(next) + 1 : iterations * 2;
+        }
+    }
+
+    void writeJson(FILE* out, const std::vector<Result>& results) {
+        char date[64];
+        std::time_t now = std::time(nullptr);
+        std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S%z", std::localtime(&now));
+        char hostName[256] = {};
+        gethostname(hostName, sizeof(hostName) - 1);
+
+        std::fprintf(out, "{\n  \"context\": {\n");
+        std::fprintf(out, "    \"date\": %s,\n", quoted(date).c_str());
+        std::fprintf(out, "    \"host_name\": %s,\n", quoted(hostName).c_str());
+        std::fprintf(out, "    \"num_cpus\": %u,\n", std::thread::hardware_concurrency());
+#ifdef NDEBUG
+        std::fprintf(out, "    \"library_build_type\": \"release\"");
+#else
+        std::fprintf(out, "    \"library_build_type\": \"debug\"");
+#endif
+        for (const auto& entry : context()) {
+            std::fprintf(out, ",\n    %s: %s", quoted(entry.first).c_str(), quoted(entry.second).c_str());
+        }
+        std::fprintf(out, "\n  },\n  \"benchmarks\": [");
+
+        for (size_t i = 0; i < results.size(); i++) {
+            const Result& r = results[i];
+            std::fprintf(out, "%s\n    {\n", i == 0 ? "" : ",");
+            std::fprintf(out, "      \"name\": %s,\n", quoted(r.name).c_str());
+            std::fprintf(out, "      \"iterations\": %zu,\n", r.iterations);
+            std::fprintf(out, "      \"real_time\": %.2f,\n", r.nsPerOp);
+            std::fprintf(out, "      \"time_unit\": \"ns\",\n");
+            std::fprintf(out, "      \"allocs_per_iter\": %.2f,\n", r.allocsPerOp);
+            std::fprintf(out, "      \"bytes_per_iter\": %.2f", r.bytesPerOp);
+            if (r.error != nullptr) {
+                std::fprintf(out, ",\n      \"error_occurred\": true,\n");
+                std::fprintf(out, "      \"error_message\": %s", quoted(r.error).c_str());
+            }
+            std::fprintf(out, "\n    }");
+        }
+        std::fprintf(out, "\n  ]\n}\n");
+    }
+
+    void writeTable(FILE* out, const std::vector<Result>& results) {
+        std::fprintf(out, "%-40s %14s %12s %12s\n", "benchmark", "ns/op", "allocs/op", "bytes/op");
+        for (const Result& r : results) {
+            if (r.error != nullptr) {
+                std::fprintf(out, "%-40s ERROR: %s\n", r.name, r.error);
+            } else {
+                std::fprintf(out, "%-40s %14.1f %12.2f %12.1f\n",
+                             r.name, r.nsPerOp, r.allocsPerOp, r.bytesPerOp);
+            }
+        }
+    }
+}
+
+void State::start() {
+    started_ = true;
+    startAllocations_ = allocationCount.load(std::memory_order_relaxed);
+    startBytes_ = allocationBytes.load(std::memory_order_relaxed);
+    startNs_ = nowNs();
+}
+
+void State::stop() {
+    elapsedNs_ = nowNs() - startNs_;
+    allocations_ = allocationCount.load(std::memory_order_relaxed) - startAllocations_;
+    allocatedBytes_ = allocationBytes.load(std::memory_order_relaxed) - startBytes_;
+}
+
+bool registerBenchmark(const char* name, Function function) {
+    registry().push_back({ name, function });
+    return true;
+}
+
+void addContext(const char* key, const char* value) {
+    context().emplace_back(key, value);
+}
+
+int runMain(int argc, char** argv) {
+    const char* filter = nullptr;
+    const char* jsonPath = nullptr;
+    double minTimeNs = 200e6;
+    bool verifyOnly = false;
+
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        if (std::strncmp(arg, "--filter=", 9) == 0) {
+            filter = arg + 9;
+        } else if (std::strncmp(arg, "--json=", 7) == 0) {
+            jsonPath = arg + 7;
+        } else if (std::strncmp(arg, "--min-time-ms=", 14) == 0) {
+            minTimeNs = std::atof(arg + 14) * 1e6;
+        } else if (std::strcmp(arg, "--verify") == 0) {
+            verifyOnly = true;
+        } else {
+            std::fprintf(stderr, "unknown flag: %s\n", arg);
+            return 2;
+        }
+    }
+
+    std::vector<Result> results;
+    int failures = 0;
+    for (const Benchmark& benchmark : registry()) {
+        if (filter != nullptr && std::strstr(benchmark.name, filter) == nullptr) {
+            continue;
+        }
+        results.push_back(run(benchmark, minTimeNs, verifyOnly));
+        if (results.back().error != nullptr) {
+            failures++;
+        }
+    }
+
+    if (jsonPath != nullptr) {
+        FILE* file = std::fopen(jsonPath, "w");
+        if (file == nullptr) {
+            std::fprintf(stderr, "cannot write %s\n", jsonPath);
+            return 2;
+        }
+        writeJson(file, results);
+        std::fclose(file);
+        writeTable(stdout, results);
+    } else if (verifyOnly) {
+        writeTable(stdout, results);
+    } else {
+        writeJson(stdout, results);
+    }
+    return failures == 0 ? 0 : 1;
+}
+
+} // namespace microbench
@@ -0,0 +1,119 @@
+#ifndef NOGHRESOD_MICROBENCH_H
+#define NOGHRESOD_MICROBENCH_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Minimal Google Benchmark-style harness for the host benchmarks.
+ *
+ *     void BM_decode(microbench::State& state) {
+ *         while (state.keepRunning()) {
+ *             ...
+ *         }
+ *     }
+ *     MICROBENCH(BM_decode, "merchant_id/reveal");
+ *
+ * Each benchmark is rerun with a growing iteration count until one run
+ * lasts at least --min-time-ms. Heap allocations made while the timer runs
+ * are counted through the replaced global operator new (microbench.cpp).
+ *
+ * Results are written as JSON (the field names follow Google Benchmark's
+ * --benchmark_format=json where they overlap) so two releases can be diffed.
+ */
+namespace microbench {
+
+class State {
+public:
+    explicit State(size_t iterations) : remaining_(iterations), iterations_(iterations) {}
+
+    /**
+     * Loop condition; starts the timer on the first call and stops it on
+     * the last.
+     */
+    bool keepRunning() {
+        if (started_) {
+            if (--remaining_ != 0) {
+                return true;
+            }
+            stop();
+            return false;
+        }
+        start();
+        return remaining_ != 0;
+    }
+
+    size_t iterations() const { return iterations_; }
+
+    /**
+     * Mark the run as failed; it is reported with "error_occurred".
+     */
+    void skipWithError(const char* message) { error_ = message; }
+
+    const char* error() const { return error_; }
+    double elapsedNs() const { return elapsedNs_; }
+    uint64_t allocations() const { return allocations_; }
+    uint64_t allocatedBytes() const { return allocatedBytes_; }
+
+private:
+    void start();
+    void stop();
+
+    size_t remaining_;
+    size_t iterations_;
+    bool started_ = false;
+    const char* error_ = nullptr;
+    double startNs_ = 0;
+    double elapsedNs_ = 0;
+    uint64_t startAllocations_ = 0;
+    uint64_t startBytes_ = 0;
+    uint64_t allocations_ = 0;
+    uint64_t allocatedBytes_ = 0;
+};
+
+using Function = void (*)(State&);
+
+bool registerBenchmark(const char* name, Function function);
+
+/**
+ * Extra "context" entry for the JSON report, e.g. the selected AES backend.
+ */
+void addContext(const char* key, const char* value);
+
+/**
+ * Run the registered benchmarks.
+ *
+ * Flags: --filter=<substring>, --min-time-ms=<n>, --json=<path> (default:
+ * JSON on stdout) and --verify (a few iterations each, no timing targets;
+ * exits non-zero if any benchmark reports an error).
+ */
+int runMain(int argc, char** argv);
+
+/**
+ * Monotonic time in nanoseconds. Inline, so the other host benches time
+ * with it without linking microbench.cpp and its operator new.
+ */
+inline double nowNs() {
+    using namespace std::chrono;
+    return static_cast<double>(
+        duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count());
+}
+
+/**
+ * Keep [value] alive so the optimizer cannot drop the computation behind it.
+ */
+template <typename T>
+inline void doNotOptimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+} // namespace microbench
+
+#define MICROBENCH_CONCAT_(a, b) a##b
+#define MICROBENCH_CONCAT(a, b) MICROBENCH_CONCAT_(a, b)
+#define MICROBENCH(function, name) \
+    static const bool MICROBENCH_CONCAT(microbenchRegistered_, __LINE__) = \
+        ::microbench::registerBenchmark(name, function)
+
+#endif // NOGHRESOD_MICROBENCH_H
@@ -0,0 +1,276 @@
+// Host benchmark for the fixed-point money engine in src/money.cpp.
+//
+// Checks every rounding mode against exact 128-bit arithmetic, prices a
+// generated catalog in all four modes and compares the batch kernel with
+// single-product pricing, and pins the catalog's checksum: the same value
+// is asserted by NativeMoneyTest.kt, so a build on any ABI (or the Kotlin
+// twin) that drifts by one Rial fails. Then times a catalog repricing next
+// to a port of the Double arithmetic in MoneyExt.kt it replaces.
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "microbench.h"
+#include "money.h"
+
+namespace money = noghresod::money;
+using money::RoundingMode;
+using microbench::nowNs;
+
+namespace {
+    const RoundingMode MODES[] = {
+        RoundingMode::HALF_UP, RoundingMode::HALF_EVEN, RoundingMode::DOWN, RoundingMode::UP,
+    };
+
+    // Catalog shared with NativeMoneyTest.kt
+    const size_t CATALOG_SIZE = 10000;
+    const int64_t CATALOG_PRICE_PER_GRAM = 1234567;
+    const uint64_t CATALOG_CHECKSUM = UINT64_C(0xB8556BCB6E353F46);
+
+    struct Catalog {
+        std::vector<int64_t> weightMg;
+        std::vector<int64_t> wage;
+        std::vector<int32_t> discountBps;
+    };
+
+    uint64_t splitmix64(uint64_t* state) {
+        uint64_t z = (*state += UINT64_C(0x9E3779B97F4A7C15));
+        z = (z ^ (z >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+        z = (z ^ (z >> 27)) * UINT64_C(0x94D049BB133111EB);
+        return z ^ (z >> 31);
+    }
+
+    /**
+     * 0.5 g to 200 g pieces, wages up to 5,000,000 Rial, discounts up to 30%.
+     */
+    Catalog makeCatalog(size_t size) {
+        Catalog catalog;
+        uint64_t state = 1403;
+        for (size_t i = 0; i < size; i++) {
+            catalog.weightMg.push_back(static_cast<int64_t>(500 + (splitmix64(&state) >> 1) % 199501));
+            catalog.wage.push_back(static_cast<int64_t>((splitmix64(&state) >> 1) % 5000001));
+            catalog.discountBps.push_back(static_cast<int32_t>((splitmix64(&state) >> 1) % 3001));
+        }
+        return catalog;
+    }
+
+    uint64_t checksum(const std::vector<int64_t>& totals, uint64_t hash) {
+        for (int64_t total : totals) {
+            hash = (hash ^ static_cast<uint64_t>(total)) * UINT64_C(0x100000001B3);
+        }
+        return hash;
+    }
+
+    /**
+     * value * numerator / denominator in 128 bits, rounded by comparing
+     * twice the remainder with the denominator.
+     */
+    int64_t exactMulDiv(int64_t value, int64_t numerator, int64_t denominator, RoundingMode mode) {
+        __int128 product = static_cast<__int128>(value) * numerator;
+        bool negative = product < 0;
+        __int128 magnitude = negative ? -product : product;
+        __int128 q = magnitude / denominator;
+        __int128 twice = 2 * (magnitude % denominator);
+        bool up = false;
+        switch (mode) {
+            case RoundingMode::HALF_UP: up = twice >= denominator; break;
+            case RoundingMode::HALF_EVEN: up = twice > denominator || (twice == denominator && q % 2 == 1); break;
+            case RoundingMode::DOWN: up = false; break;
+            case RoundingMode::UP: up = twice != 0; break;
+        }
+        q += up ? 1 : 0;
+        return static_cast<int64_t>(negative ? -q : q);
+    }
+
+    int verifyRounding() {
+        struct Case {
+            int64_t value, numerator, denominator;
+            int64_t expected[4];    // HALF_UP, HALF_EVEN, DOWN, UP
+        };
+        const Case cases[] = {
+            { 25, 1, 10, { 3, 2, 2, 3 } },
+            { 35, 1, 10, { 4, 4, 3, 4 } },
+            { -25, 1, 10, { -3, -2, -2, -3 } },
+            { 24, 1, 10, { 2, 2, 2, 3 } },
+            { 26, 1, 10, { 3, 3, 2, 3 } },
+            { 20, 1, 10, { 2, 2, 2, 2 } },
+            { 0, 900, 10000, { 0, 0, 0, 0 } },
+            { 17240730, 500, 10000, { 862037, 862036, 862036, 862037 } },
+        };
+        int failures = 0;
+        for (const Case& c : cases) {
+            for (size_t m = 0; m < 4; m++) {
+                int64_t actual = money::mulDiv(c.value, c.numerator, c.denominator, MODES[m]);
+                if (actual != c.expected[m]) {
+                    std::printf("MISMATCH mulDiv(%lld, %lld, %lld) mode %zu: %lld\n",
+                                static_cast<long long>(c.value), static_cast<long long>(c.numerator),
+                                static_cast<long long>(c.denominator), m, static_cast<long long>(actual));
+                    failures++;
+                }
+            }
+        }
+
+        // Products up to the largest the pricing steps form
+        uint64_t state = 7;
+        for (int i = 0; i < 200000 && failures < 10; i++) {
+            int64_t value = static_cast<int64_t>((splitmix64(&state) >> 1) % (2 * money::MAX_WAGE + 1)) - money::MAX_WAGE;
+            int64_t numerator = static_cast<int64_t>((splitmix64(&state) >> 1) % (money::BASIS_POINTS + 1));
+            int64_t denominator = i % 2 == 0 ? money::BASIS_POINTS : money::MILLIGRAMS_PER_GRAM;
+            for (RoundingMode mode : MODES) {
+                if (money::mulDiv(value, numerator, denominator, mode) !=
+                    exactMulDiv(value, numerator, denominator, mode)) {
+                    std::printf("MISMATCH mulDiv(%lld, %lld, %lld) against 128-bit\n",
+                                static_cast<long long>(value), static_cast<long long>(numerator),
+                                static_cast<long long>(denominator));
+                    failures++;
+                }
+            }
+        }
+        return failures;
+    }
+
+    int verifyPricing() {
+        int failures = 0;
+        // 12.345 g at 1,234,567 Rial/g, 2,000,000 wage, 5% off, 9% VAT
+        money::PriceBreakdown p;
+        if (!money::priceProduct(12345, 1234567, 2000000, 500, money::VAT_BASIS_POINTS,
+                                 RoundingMode::HALF_UP, &p) ||
+            p.metal != 15240730 || p.wage != 2000000 || p.discount != 862037 ||
+            p.tax != 1474082 || p.total != 17852775) {
+            std::printf("MISMATCH priceProduct known value\n");
+            failures++;
+        }
+
+        // The largest inputs stay exact
+        if (!money::priceProduct(money::MAX_WEIGHT_MG, money::MAX_PRICE_PER_GRAM, money::MAX_WAGE,
+                                 0, money::BASIS_POINTS, RoundingMode::UP, &p) ||
+            p.total != 4 * INT64_C(100000000000000)) {
+            std::printf("MISMATCH priceProduct at the bounds\n");
+            failures++;
+        }
+
+        const bool rejected =
+            !money::priceProduct(money::MAX_WEIGHT_MG + 1, 1, 0, 0, 0, RoundingMode::DOWN, &p) &&
+            !money::priceProduct(1, money::MAX_PRICE_PER_GRAM + 1, 0, 0, 0, RoundingMode::DOWN, &p) &&
+            !money::priceProduct(1, 1, money::MAX_WAGE + 1, 0, 0, RoundingMode::DOWN, &p) &&
+            !money::priceProduct(-1, 1, 0, 0, 0, RoundingMode::DOWN, &p) &&
+            !money::priceProduct(1, 1, 0, -1, 0, RoundingMode::DOWN, &p) &&
+            !money::priceProduct(1, 1, 0, 0, money::BASIS_POINTS + 1, RoundingMode::DOWN, &p);
+        if (!rejected) {
+            std::printf("MISMATCH out-of-range inputs accepted\n");
+            failures++;
+        }
+        return failures;
+    }
+
+    int verifyCatalog() {
+        Catalog catalog = makeCatalog(CATALOG_SIZE);
+        std::vector<int64_t> totals(CATALOG_SIZE);
+        int failures = 0;
+        uint64_t hash = UINT64_C(0xCBF29CE484222325);
+
+        for (RoundingMode mode : MODES) {
+            size_t priced = money::priceProducts(catalog.weightMg.data(), catalog.wage.data(),
+                                                 catalog.discountBps.data(), CATALOG_SIZE,
+                                                 CATALOG_PRICE_PER_GRAM, money::VAT_BASIS_POINTS,
+                                                 mode, totals.data());
+            if (priced != CATALOG_SIZE) {
+                std::printf("MISMATCH catalog priced %zu of %zu\n", priced, CATALOG_SIZE);
+                return failures + 1;
+            }
+            for (size_t i = 0; i < CATALOG_SIZE && failures < 10; i++) {
+                money::PriceBreakdown p;
+                money::priceProduct(catalog.weightMg[i], CATALOG_PRICE_PER_GRAM, catalog.wage[i],
+                                    catalog.discountBps[i], money::VAT_BASIS_POINTS, mode, &p);
+                if (p.total != totals[i]) {
+                    std::printf("MISMATCH batch total %zu\n", i);
+                    failures++;
+                }
+            }
+            hash = checksum(totals, hash);
+        }
+
+        if (hash != CATALOG_CHECKSUM) {
+            std::printf("MISMATCH catalog checksum %016llx\n", static_cast<unsigned long long>(hash));
+            failures++;
+        }
+
+        // Without discounts, and stopping at the first product out of range
+        std::vector<int64_t> plain(CATALOG_SIZE);
+        money::priceProducts(catalog.weightMg.data(), catalog.wage.data(), nullptr, CATALOG_SIZE,
+                             CATALOG_PRICE_PER_GRAM, money::VAT_BASIS_POINTS, RoundingMode::HALF_UP,
+                             plain.data());
+        money::PriceBreakdown first;
+        money::priceProduct(catalog.weightMg[0], CATALOG_PRICE_PER_GRAM, catalog.wage[0], 0,
+                            money::VAT_BASIS_POINTS, RoundingMode::HALF_UP, &first);
+        catalog.wage[17] = -1;
+        if (plain[0] != first.total ||
+            money::priceProducts(catalog.weightMg.data(), catalog.wage.data(), nullptr, CATALOG_SIZE,
+                                 CATALOG_PRICE_PER_GRAM, money::VAT_BASIS_POINTS,
+                                 RoundingMode::HALF_UP, plain.data()) != 17) {
+            std::printf("MISMATCH catalog without discounts\n");
+            failures++;
+        }
+        return failures;
+    }
+
+    /**
+     * MoneyExt.kt as it was: weight x price, calculateTotal(discount%, 9.0), toLong().
+     */
+    int64_t doubleTotal(double weightGrams, double pricePerGram, double wage, double discountPercent) {
+        double base = weightGrams * pricePerGram + wage;
+        double afterDiscount = base - base * (discountPercent / 100);
+        return static_cast<int64_t>(afterDiscount + afterDiscount * (9.0 / 100));
+    }
+
+    void runCatalog(size_t size) {
+        Catalog catalog = makeCatalog(size);
+        std::vector<int64_t> totals(size);
+        const int iterations = 200;
+
+        double start = nowNs();
+        for (int i = 0; i < iterations; i++) {
+            money::priceProducts(catalog.weightMg.data(), catalog.wage.data(), catalog.discountBps.data(),
+                                 size, CATALOG_PRICE_PER_GRAM + i, money::VAT_BASIS_POINTS,
+                                 RoundingMode::HALF_UP, totals.data());
+        }
+        double fixedNs = (nowNs() - start) / iterations;
+
+        std::vector<int64_t> doubles(size);
+        start = nowNs();
+        for (int i = 0; i < iterations; i++) {
+            for (size_t j = 0; j < size; j++) {
+                doubles[j] = doubleTotal(static_cast<double>(catalog.weightMg[j]) / 1000.0,
+                                         static_cast<double>(CATALOG_PRICE_PER_GRAM + i),
+                                         static_cast<double>(catalog.wage[j]),
+                                         catalog.discountBps[j] / 100.0);
+            }
+        }
+        double doubleNs = (nowNs() - start) / iterations;
+
+        // Same price as the last timed iteration, to count where Double lands elsewhere
+        size_t differing = 0;
+        for (size_t j = 0; j < size; j++) {
+            differing += doubles[j] != totals[j] ? 1 : 0;
+        }
+        std::printf("%-8zu products  fixed %9.2f us (%5.2f ns/product)  double %9.2f us (%5.2f ns/product)  "
+                    "%zu totals differ\n",
+                    size, fixedNs / 1000.0, fixedNs / size, doubleNs / 1000.0, doubleNs / size, differing);
+    }
+}
+
+int main(int argc, char** argv) {
+    // --verify: correctness checks only, for ctest
+    bool verifyOnly = argc > 1 && std::strcmp(argv[1], "--verify") == 0;
+
+    int failures = verifyRounding() + verifyPricing() + verifyCatalog();
+    if (verifyOnly || failures != 0) {
+        return failures == 0 ? 0 : 1;
+    }
+
+    for (size_t size : { size_t(100), size_t(1000), size_t(10000), size_t(100000) }) {
+        runCatalog(size);
+    }
+    return 0;
+}
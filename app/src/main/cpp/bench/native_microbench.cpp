@@ -0,0 +1,636 @@
+// Microbenchmarks for the native key paths, reported as JSON.
+//
+//   build/native-host/bench/native_microbench --json=native-bench.json
+//
+// Covers the getMerchantId decode, each stage of the decryptApiKey pipeline
+// (XOR reveal -> Base64 -> AES-256-GCM) and the whole of it, jstring
+// creation (fresh vs interned), SecretCache hits and misses, handing a
+// cached secret to Java as a String vs into a reused buffer, price and
+// Jalali date formatting (ports of the Kotlin formatters vs the native
+// ones), and repricing a catalog (the Double MoneyExt math vs the native
+// fixed-point batch). Every entry
+// reports ns/op, heap allocations/op and heap bytes/op; allocations served
+// by the secure arena are not heap allocations and do not show up.
+//
+// The shipped API key payloads are placeholders, so the pipeline benchmarks
+// use a bench payload of the same shape: a 40-character key encrypted under
+// a fixed key, Base64 encoded and obfuscated at compile time.
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "aes_gcm.h"
+#include "cpu_features.h"
+#include "device_binding.h"
+#include "encryption.h"
+#include "jalali_format.h"
+#include "jni_host.h"
+#include "microbench.h"
+#include "number_format.h"
+#include "obfuscation.h"
+#include "secret_cache.h"
+#include "secure_arena.h"
+#include "xor_kernel.h"
+
+using microbench::State;
+using microbench::doNotOptimize;
+using noghresod::DeviceInputs;
+using noghresod::DeviceKeyService;
+using noghresod::SecretCache;
+using noghresod::SecretId;
+using noghresod::SecureString;
+using noghresod::host::JniHost;
+
+namespace {
+    using StringFn = jstring (*)(JNIEnv*, jobject);
+
+    // Same length as a Zarinpal merchant ID
+    constexpr auto MERCHANT_ID = NOGHRESOD_OBFUSCATE("00000000-0000-0000-0000-000000000000");
+
+    // IV || AES-256-GCM("sk_live_bench_0123456789abcdefghijklmnop") || tag under benchKey()
+    constexpr auto API_KEY_PAYLOAD = NOGHRESOD_OBFUSCATE(
+        "kJ2qt8TR3uv4BRIfHZV0PcjWzk6y5wKHsqy95fhDBlpWP+Kay/wtWWoqkeaPNgv0qRa17EvDHMdGuTMCPewcGE75m3k=");
+    const char* const API_KEY_PLAIN = "sk_live_bench_0123456789abcdefghijklmnop";
+
+    /**
+     * Built per call, like the device key in decryptApiKey: a long-lived
+     * block would pin the secure arena and hide its rewind behaviour.
+     */
+    SecureString benchKey() {
+        SecureString key(noghresod::AesGcm::KEY_SIZE, '\0');
+        for (size_t i = 0; i < key.size(); i++) {
+            key[i] = static_cast<char>(0x40 + i * 7);
+        }
+        return key;
+    }
+
+    /**
+     * Fixed fingerprint, standing in for android.os.Build.
+     */
+    class BenchDeviceInputs : public DeviceInputs {
+    public:
+        bool collect(SecureString& out) override {
+            out.append("host/noghresod/linux:14/HOST/1:userdebug/test-keys\x1Fhost\x1F"
+                       "linux-x86_64\x1Fhost\x1Fhost\x1F");
+            return true;
+        }
+    };
+
+    /**
+     * XOR reveal -> Base64 -> AES-256-GCM, as decryptApiKey does.
+     */
+    SecureString decryptBenchPayload() {
+        SecureString key = benchKey();
+        auto payload = API_KEY_PAYLOAD.reveal();
+        SecureString decoded = base64Decode(payload.c_str(), payload.size());
+        return aesDecrypt(decoded, key);
+    }
+
+    JNIEnv* loadedEnv() {
+        JniHost& host = JniHost::instance();
+        JNIEnv* env = host.env();
+        host.load();
+        return env;
+    }
+
+    // ==========================
+    // getMerchantId
+    // ==========================
+
+    void merchantIdReveal(State& state) {
+        while (state.keepRunning()) {
+            auto merchantId = MERCHANT_ID.reveal();
+            doNotOptimize(merchantId.c_str()[0]);
+        }
+    }
+    MICROBENCH(merchantIdReveal, "merchant_id/reveal");
+
+    void merchantIdJni(State& state) {
+        JNIEnv* env = loadedEnv();
+        auto getMerchantId = JniHost::instance().native<StringFn>(
+            "com/noghre/sod/core/security/NativeKeyManager", "getMerchantId");
+        if (getMerchantId == nullptr) {
+            state.skipWithError("getMerchantId not registered");
+            return;
+        }
+        while (state.keepRunning()) {
+            jstring value = getMerchantId(env, nullptr);
+            env->DeleteLocalRef(value);
+        }
+    }
+    MICROBENCH(merchantIdJni, "merchant_id/jni");
+
+    // ==========================
+    // decryptApiKey pipeline
+    // ==========================
+
+    void pipelineDeviceKey(State& state) {
+        BenchDeviceInputs device;
+        if (DeviceKeyService::instance().getKey(device).empty()) {
+            state.skipWithError("device key unavailable");
+            return;
+        }
+        while (state.keepRunning()) {
+            SecureString key = DeviceKeyService::instance().getKey(device);
+            doNotOptimize(key.data());
+        }
+    }
+    MICROBENCH(pipelineDeviceKey, "decrypt_api_key/device_key_cached");
+
+    void pipelineReveal(State& state) {
+        while (state.keepRunning()) {
+            auto payload = API_KEY_PAYLOAD.reveal();
+            doNotOptimize(payload.c_str()[0]);
+        }
+    }
+    MICROBENCH(pipelineReveal, "decrypt_api_key/xor_reveal");
+
+    void pipelineBase64(State& state) {
+        auto payload = API_KEY_PAYLOAD.reveal();
+        const size_t length = payload.size();
+        while (state.keepRunning()) {
+            SecureString decoded = base64Decode(payload.c_str(), length);
+            doNotOptimize(decoded.data());
+        }
+    }
+    MICROBENCH(pipelineBase64, "decrypt_api_key/base64_decode");
+
+    void pipelineAes(State& state) {
+        auto payload = API_KEY_PAYLOAD.reveal();
+        SecureString decoded = base64Decode(payload.c_str(), payload.size());
+        SecureString key = benchKey();
+        while (state.keepRunning()) {
+            SecureString plain = aesDecrypt(decoded, key);
+            doNotOptimize(plain.data());
+        }
+    }
+    MICROBENCH(pipelineAes, "decrypt_api_key/aes_gcm_decrypt");
+
+    void pipelineAesColdKey(State& state) {
+        auto payload = API_KEY_PAYLOAD.reveal();
+        SecureString decoded = base64Decode(payload.c_str(), payload.size());
+        SecureString key = benchKey();
+        while (state.keepRunning()) {
+            clearCipherCache();
+            SecureString plain = aesDecrypt(decoded, key);
+            doNotOptimize(plain.data());
+        }
+    }
+    MICROBENCH(pipelineAesColdKey, "decrypt_api_key/aes_gcm_decrypt_cold_key");
+
+    void pipelineFull(State& state) {
+        if (decryptBenchPayload() != API_KEY_PLAIN) {
+            state.skipWithError("bench payload did not decrypt");
+            return;
+        }
+        while (state.keepRunning()) {
+            SecureString plain = decryptBenchPayload();
+            doNotOptimize(plain.data());
+        }
+    }
+    MICROBENCH(pipelineFull, "decrypt_api_key/full");
+
+    // ==========================
+    // jstring creation
+    // ==========================
+
+    void jstringNewStringUtf(State& state) {
+        JNIEnv* env = loadedEnv();
+        while (state.keepRunning()) {
+            jstring value = env->NewStringUTF(API_KEY_PLAIN);
+            env->DeleteLocalRef(value);
+        }
+    }
+    MICROBENCH(jstringNewStringUtf, "jstring/new_string_utf");
+
+    void jstringPooled(State& state) {
+        JNIEnv* env = loadedEnv();
+        auto getApiUrl = JniHost::instance().native<StringFn>(
+            "com/noghre/sod/core/security/NativeKeys", "getApiUrl");
+        if (getApiUrl == nullptr) {
+            state.skipWithError("getApiUrl not registered");
+            return;
+        }
+        while (state.keepRunning()) {
+            // Interned values are global references: nothing to delete
+            jstring value = getApiUrl(env, nullptr);
+            doNotOptimize(value);
+        }
+    }
+    MICROBENCH(jstringPooled, "jstring/interned_pool");
+
+    // ==========================
+    // SecretCache
+    // ==========================
+
+    bool cachedLookup(JNIEnv* env) {
+        return SecretCache::instance().withSecret(
+            SecretId::API_KEY,
+            [] { return decryptBenchPayload(); },
+            [env](const char* value, size_t /* length */) {
+                env->DeleteLocalRef(env->NewStringUTF(value));
+            });
+    }
+
+    void cacheHit(State& state) {
+        JNIEnv* env = loadedEnv();
+        SecretCache::instance().clear();
+        if (!cachedLookup(env)) {
+            state.skipWithError("cache fill failed");
+            return;
+        }
+        while (state.keepRunning()) {
+            cachedLookup(env);
+        }
+    }
+    MICROBENCH(cacheHit, "secret_cache/hit");
+
+    void cacheMiss(State& state) {
+        JNIEnv* env = loadedEnv();
+        while (state.keepRunning()) {
+            SecretCache::instance().clear();
+            cachedLookup(env);
+        }
+    }
+    MICROBENCH(cacheMiss, "secret_cache/miss");
+
+    void cacheClear(State& state) {
+        while (state.keepRunning()) {
+            SecretCache::instance().clear();
+        }
+    }
+    MICROBENCH(cacheClear, "secret_cache/clear");
+
+    // ==========================
+    // Secret delivery to Java (cache hits)
+    // ==========================
+
+    const char* const KEY_PROVIDER = "com/noghre/sod/core/security/KeyProvider";
+    using ReadBytesFn = jint (*)(JNIEnv*, jobject, jint, jobject, jint, jint);
+    using ReadCharsFn = jint (*)(JNIEnv*, jobject, jint, jcharArray, jint);
+
+    void deliverString(State& state) {
+        JNIEnv* env = loadedEnv();
+        auto getApiKey = JniHost::instance().native<StringFn>(KEY_PROVIDER, "getApiKey");
+        if (getApiKey == nullptr || !cachedLookup(env)) {
+            state.skipWithError("getApiKey unavailable");
+            return;
+        }
+        while (state.keepRunning()) {
+            env->DeleteLocalRef(getApiKey(env, nullptr));
+        }
+    }
+    MICROBENCH(deliverString, "secret_delivery/new_string");
+
+    void deliverBytes(State& state) {
+        JNIEnv* env = loadedEnv();
+        auto readBytes = JniHost::instance().native<ReadBytesFn>(KEY_PROVIDER, "nativeReadSecretBytes");
+        if (readBytes == nullptr || !cachedLookup(env)) {
+            state.skipWithError("nativeReadSecretBytes unavailable");
+            return;
+        }
+        // One buffer reused across calls, as an interceptor would
+        static uint8_t storage[256];
+        jobject buffer = env->NewDirectByteBuffer(storage, sizeof(storage));
+        while (state.keepRunning()) {
+            doNotOptimize(readBytes(env, nullptr, static_cast<jint>(SecretId::API_KEY),
+                                    buffer, 0, sizeof(storage)));
+        }
+        env->DeleteLocalRef(buffer);
+    }
+    MICROBENCH(deliverBytes, "secret_delivery/direct_byte_buffer");
+
+    void deliverChars(State& state) {
+        JNIEnv* env = loadedEnv();
+        auto readChars = JniHost::instance().native<ReadCharsFn>(KEY_PROVIDER, "nativeReadSecretChars");
+        if (readChars == nullptr || !cachedLookup(env)) {
+            state.skipWithError("nativeReadSecretChars unavailable");
+            return;
+        }
+        jcharArray chars = env->NewCharArray(256);
+        while (state.keepRunning()) {
+            doNotOptimize(readChars(env, nullptr, static_cast<jint>(SecretId::API_KEY), chars, 0));
+        }
+        env->DeleteLocalRef(chars);
+    }
+    MICROBENCH(deliverChars, "secret_delivery/char_array");
+
+    // ==========================
+    // Price formatting
+    // ==========================
+
+    const char* const NATIVE_PRICE_FORMATTER = "com/noghre/sod/core/util/NativePriceFormatter";
+    using FormatFn = jint (*)(JNIEnv*, jobject, jlong, jint, jcharArray, jint);
+    using FormatAllFn = jint (*)(JNIEnv*, jobject, jlongArray, jint, jcharArray, jintArray);
+
+    const int64_t PRICE = 12750000;
+    const jint TOMAN = noghresod::NUMBER_TOMAN;
+    // One product grid page
+    const jsize PAGE_SIZE = 48;
+
+    /**
+     * PersianNumberFormatter.format(Long) + " تومان", step for step:
+     * toString, reversed, chunked(3), reversed, map each digit, joinToString.
+     */
+    std::u16string kotlinFormat(int64_t value) {
+        std::string digits = std::to_string(value < 0 ? -value : value);
+        std::reverse(digits.begin(), digits.end());
+        std::vector<std::string> parts;
+        for (size_t i = 0; i < digits.size(); i += 3) {
+            parts.push_back(digits.substr(i, 3));
+        }
+        std::reverse(parts.begin(), parts.end());
+        std::vector<std::u16string> formatted;
+        for (std::string& part : parts) {
+            std::reverse(part.begin(), part.end());
+            std::u16string persian;
+            for (char digit : part) {
+                persian += static_cast<char16_t>(0x06F0 + (digit - '0'));
+            }
+            formatted.push_back(persian);
+        }
+        std::u16string result;
+        for (size_t i = 0; i < formatted.size(); i++) {
+            if (i > 0) {
+                result += u'\u066C';
+            }
+            result += formatted[i];
+        }
+        if (value < 0) {
+            result = u"\u2212" + result;
+        }
+        return result + u" \u062A\u0648\u0645\u0627\u0646";
+    }
+
+    void priceKotlinPort(State& state) {
+        while (state.keepRunning()) {
+            doNotOptimize(kotlinFormat(PRICE));
+        }
+    }
+    MICROBENCH(priceKotlinPort, "price_format/kotlin_port");
+
+    void priceNative(State& state) {
+        JNIEnv* env = loadedEnv();
+        auto format = JniHost::instance().native<FormatFn>(NATIVE_PRICE_FORMATTER, "nativeFormat");
+        if (format == nullptr) {
+            state.skipWithError("nativeFormat unavailable");
+            return;
+        }
+        // Reused output buffer, as NativePriceFormatter keeps one per thread
+        jcharArray chars = env->NewCharArray(static_cast<jsize>(noghresod::MAX_FORMATTED_NUMBER));
+        while (state.keepRunning()) {
+            doNotOptimize(format(env, nullptr, PRICE, TOMAN, chars, 0));
+        }
+        env->DeleteLocalRef(chars);
+    }
+    MICROBENCH(priceNative, "price_format/native");
+
+    void pricePageKotlinPort(State& state) {
+        while (state.keepRunning()) {
+            for (jsize i = 0; i < PAGE_SIZE; i++) {
+                doNotOptimize(kotlinFormat(PRICE + i * 1000));
+            }
+        }
+    }
+    MICROBENCH(pricePageKotlinPort, "price_format/page_48_kotlin_port");
+
+    void pricePageNative(State& state) {
+        JNIEnv* env = loadedEnv();
+        auto formatAll = JniHost::instance().native<FormatAllFn>(NATIVE_PRICE_FORMATTER, "nativeFormatAll");
+        if (formatAll == nullptr) {
+            state.skipWithError("nativeFormatAll unavailable");
+            return;
+        }
+        jlongArray values = env->NewLongArray(PAGE_SIZE);
+        jcharArray chars = env->NewCharArray(PAGE_SIZE * static_cast<jsize>(noghresod::MAX_FORMATTED_NUMBER));
+        jintArray ends = env->NewIntArray(PAGE_SIZE);
+        jlong prices[PAGE_SIZE];
+        for (jsize i = 0; i < PAGE_SIZE; i++) {
+            prices[i] = PRICE + i * 1000;
+        }
+        env->SetLongArrayRegion(values, 0, PAGE_SIZE, prices);
+        while (state.keepRunning()) {
+            doNotOptimize(formatAll(env, nullptr, values, TOMAN, chars, ends));
+        }
+        env->DeleteLocalRef(ends);
+        env->DeleteLocalRef(chars);
+        env->DeleteLocalRef(values);
+    }
+    MICROBENCH(pricePageNative, "price_format/page_48_native");
+
+    // ==========================
+    // Jalali date formatting
+    // ==========================
+
+    const char* const NATIVE_DATE_FORMATTER = "com/noghre/sod/core/util/NativeDateFormatter";
+    using DateCompileFn = jboolean (*)(JNIEnv*, jobject, jcharArray, jobject);
+    using DateFormatFn = jint (*)(JNIEnv*, jobject, jlong, jlong, jobject, jint, jcharArray, jint);
+    using DateFormatAllFn = jint (*)(JNIEnv*, jobject, jlongArray, jlong, jobject, jint, jcharArray, jintArray);
+
+    // 2024-12-28T09:30Z, 8 Dey 1403 in Tehran
+    const int64_t INSTANT = INT64_C(1735378200000);
+    const jlong TEHRAN = 12600000;
+    const char16_t LONG_PATTERN[] = u"EEEE d MMMM yyyy";
+    const jsize LONG_PATTERN_LENGTH = sizeof(LONG_PATTERN) / sizeof(LONG_PATTERN[0]) - 1;
+    // One order timeline screen
+    const jsize TIMELINE_SIZE = 50;
+
+    // NativeDateFormatter.COMPILED_PATTERN_BYTES
+    struct CompiledPattern {
+        alignas(8) uint8_t bytes[512];
+    };
+
+    /**
+     * LONG_PATTERN compiled into [storage] once, as NativeDateFormatter.Pattern
+     * does on construction; nullptr if nativeCompile is unavailable.
+     */
+    jobject compileLongPattern(JNIEnv* env, CompiledPattern* storage) {
+        auto compile = JniHost::instance().native<DateCompileFn>(NATIVE_DATE_FORMATTER, "nativeCompile");
+        if (compile == nullptr) {
+            return nullptr;
+        }
+        jcharArray chars = env->NewCharArray(LONG_PATTERN_LENGTH);
+        env->SetCharArrayRegion(chars, 0, LONG_PATTERN_LENGTH, reinterpret_cast<const jchar*>(LONG_PATTERN));
+        jobject pattern = env->NewDirectByteBuffer(storage->bytes, sizeof(storage->bytes));
+        bool compiled = compile(env, nullptr, chars, pattern) == JNI_TRUE;
+        env->DeleteLocalRef(chars);
+        if (!compiled) {
+            env->DeleteLocalRef(pattern);
+            return nullptr;
+        }
+        return pattern;
+    }
+
+    std::u16string kotlinFarsiNumbers(int32_t value) {
+        std::string ascii = std::to_string(value);
+        std::u16string output(ascii.begin(), ascii.end());
+        // input.replace(i.toString(), farsiDigits[i]) for every digit
+        for (char16_t digit = u'0'; digit <= u'9'; digit++) {
+            std::u16string replaced;
+            for (char16_t unit : output) {
+                replaced += unit == digit ? static_cast<char16_t>(0x06F0 + (digit - u'0')) : unit;
+            }
+            output = replaced;
+        }
+        return output;
+    }
+
+    /**
+     * PersianDateConverter.toPersianText as it was, step for step: the name
+     * arrays built per call, then each number through toFarsiNumbers.
+     */
+    std::u16string kotlinPersianText(int32_t jy, int32_t jm, int32_t jd, int32_t weekday) {
+        const std::vector<std::u16string> days = {
+            u"شنبه", u"یکشنبه", u"دوشنبه", u"سه\u200Cشنبه", u"چهارشنبه", u"پنج\u200Cشنبه", u"جمعه",
+        };
+        const std::vector<std::u16string> months = {
+            u"", u"فروردین", u"اردیبهشت", u"خرداد", u"تیر", u"مرداد", u"شهریور",
+            u"مهر", u"آبان", u"آذر", u"دی", u"بهمن", u"اسفند",
+        };
+        return days[weekday] + u"، " + kotlinFarsiNumbers(jd) + u" " + months[jm] + u" " + kotlinFarsiNumbers(jy);
+    }
+
+    void dateKotlinPort(State& state) {
+        while (state.keepRunning()) {
+            doNotOptimize(kotlinPersianText(1403, 10, 8, 0));
+        }
+    }
+    MICROBENCH(dateKotlinPort, "date_format/kotlin_port");
+
+    void dateNative(State& state) {
+        JNIEnv* env = loadedEnv();
+        auto format = JniHost::instance().native<DateFormatFn>(NATIVE_DATE_FORMATTER, "nativeFormat");
+        if (format == nullptr) {
+            state.skipWithError("nativeFormat unavailable");
+            return;
+        }
+        // The compiled pattern and output buffer live as long as NativeDateFormatter's
+        CompiledPattern storage;
+        jobject pattern = compileLongPattern(env, &storage);
+        if (pattern == nullptr) {
+            state.skipWithError("nativeCompile unavailable");
+            return;
+        }
+        jcharArray chars = env->NewCharArray(static_cast<jsize>(noghresod::jalali::MAX_FORMATTED_DATE));
+        while (state.keepRunning()) {
+            doNotOptimize(format(env, nullptr, INSTANT, TEHRAN, pattern, 0, chars, 0));
+        }
+        env->DeleteLocalRef(chars);
+        env->DeleteLocalRef(pattern);
+    }
+    MICROBENCH(dateNative, "date_format/native");
+
+    void timelineKotlinPort(State& state) {
+        while (state.keepRunning()) {
+            for (jsize i = 0; i < TIMELINE_SIZE; i++) {
+                doNotOptimize(kotlinPersianText(1403, 10, 1 + i % 30, i % 7));
+            }
+        }
+    }
+    MICROBENCH(timelineKotlinPort, "date_format/timeline_50_kotlin_port");
+
+    void timelineNative(State& state) {
+        JNIEnv* env = loadedEnv();
+        auto formatAll = JniHost::instance().native<DateFormatAllFn>(NATIVE_DATE_FORMATTER, "nativeFormatAll");
+        if (formatAll == nullptr) {
+            state.skipWithError("nativeFormatAll unavailable");
+            return;
+        }
+        CompiledPattern storage;
+        jobject pattern = compileLongPattern(env, &storage);
+        if (pattern == nullptr) {
+            state.skipWithError("nativeCompile unavailable");
+            return;
+        }
+        jlongArray millis = env->NewLongArray(TIMELINE_SIZE);
+        jcharArray chars = env->NewCharArray(TIMELINE_SIZE * static_cast<jsize>(noghresod::jalali::MAX_FORMATTED_DATE));
+        jintArray ends = env->NewIntArray(TIMELINE_SIZE);
+        jlong instants[TIMELINE_SIZE];
+        for (jsize i = 0; i < TIMELINE_SIZE; i++) {
+            instants[i] = INSTANT - i * INT64_C(86400000);
+        }
+        env->SetLongArrayRegion(millis, 0, TIMELINE_SIZE, instants);
+        while (state.keepRunning()) {
+            doNotOptimize(formatAll(env, nullptr, millis, TEHRAN, pattern, 0, chars, ends));
+        }
+        env->DeleteLocalRef(ends);
+        env->DeleteLocalRef(chars);
+        env->DeleteLocalRef(millis);
+        env->DeleteLocalRef(pattern);
+    }
+    MICROBENCH(timelineNative, "date_format/timeline_50_native");
+
+    // ==========================
+    // Catalog repricing
+    // ==========================
+
+    const char* const NATIVE_MONEY = "com/noghre/sod/core/util/NativeMoney";
+    using PriceAllFn = jint (*)(JNIEnv*, jobject, jlongArray, jlongArray, jintArray, jlong, jint, jint, jlongArray);
+
+    // One silver price update over a category listing
+    const jsize CATALOG_SIZE = 1000;
+    const jlong PRICE_PER_GRAM = 1234567;
+
+    void catalogProducts(jlong* weightMg, jlong* wage, jint* discountBps) {
+        for (jsize i = 0; i < CATALOG_SIZE; i++) {
+            weightMg[i] = 500 + i * 197 % 199500;
+            wage[i] = i * 4999 % 5000000;
+            discountBps[i] = i * 7 % 3001;
+        }
+    }
+
+    void repriceDoublePort(State& state) {
+        std::vector<jlong> weightMg(CATALOG_SIZE), wage(CATALOG_SIZE), totals(CATALOG_SIZE);
+        std::vector<jint> discountBps(CATALOG_SIZE);
+        catalogProducts(weightMg.data(), wage.data(), discountBps.data());
+        while (state.keepRunning()) {
+            // weight x price + wage, calculateTotal(discount%, 9.0), toLong()
+            for (jsize i = 0; i < CATALOG_SIZE; i++) {
+                double base = weightMg[i] / 1000.0 * PRICE_PER_GRAM + wage[i];
+                double afterDiscount = base - base * (discountBps[i] / 100.0 / 100);
+                totals[i] = static_cast<jlong>(afterDiscount + afterDiscount * (9.0 / 100));
+            }
+            doNotOptimize(totals.data());
+        }
+    }
+    MICROBENCH(repriceDoublePort, "money/reprice_1000_double_port");
+
+    void repriceNative(State& state) {
+        JNIEnv* env = loadedEnv();
+        auto priceAll = JniHost::instance().native<PriceAllFn>(NATIVE_MONEY, "nativePriceAll");
+        if (priceAll == nullptr) {
+            state.skipWithError("nativePriceAll unavailable");
+            return;
+        }
+        jlong weights[CATALOG_SIZE];
+        jlong wages[CATALOG_SIZE];
+        jint discounts[CATALOG_SIZE];
+        catalogProducts(weights, wages, discounts);
+        jlongArray weightMg = env->NewLongArray(CATALOG_SIZE);
+        jlongArray wage = env->NewLongArray(CATALOG_SIZE);
+        jintArray discountBps = env->NewIntArray(CATALOG_SIZE);
+        jlongArray totals = env->NewLongArray(CATALOG_SIZE);
+        env->SetLongArrayRegion(weightMg, 0, CATALOG_SIZE, weights);
+        env->SetLongArrayRegion(wage, 0, CATALOG_SIZE, wages);
+        env->SetIntArrayRegion(discountBps, 0, CATALOG_SIZE, discounts);
+        while (state.keepRunning()) {
+            doNotOptimize(priceAll(env, nullptr, weightMg, wage, discountBps, PRICE_PER_GRAM, 900, 0, totals));
+        }
+        env->DeleteLocalRef(totals);
+        env->DeleteLocalRef(discountBps);
+        env->DeleteLocalRef(wage);
+        env->DeleteLocalRef(weightMg);
+    }
+    MICROBENCH(repriceNative, "money/reprice_1000_native");
+}
+
+int main(int argc, char** argv) {
+    char features[128];
+    noghresod::cpuFeatures().describe(features, sizeof(features));
+    microbench::addContext("cpu_features", features);
+    microbench::addContext("aes_gcm_backend", noghresod::AesGcm::backendName());
+    microbench::addContext("xor_kernel", noghresod::xorKernelName());
+    microbench::addContext("jni", "host stand-in (host/jni_host.cpp)");
+    return microbench::runMain(argc, argv);
+}
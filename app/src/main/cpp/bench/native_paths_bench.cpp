@@ -0,0 +1,821 @@
+// Host benchmark for the JNI entry points, driven through the stand-in VM
+// in host/. JNI_OnLoad registers every binding exactly as on device; each
+// native is then called through its registered function pointer.
+//
+// Reports per-call latency (mean and p99) for every native path and the
+// streaming encryption throughput. --verify only checks that every path
+// answers, that streams also run in place across updates, that secret
+// reads stay consistent under concurrent clears, that secrets load
+// independently, that digits transcode in place, that prices format singly
+// and in batches, that Jalali dates convert both ways and format through
+// patterns, that products reprice in one batch, that the native stats saw
+// every call and drain in one snapshot, and that no local references leak,
+// for ctest.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+#include "jni_host.h"
+#include "microbench.h"
+#include "secret_cache.h"
+#include "secure_arena.h"
+
+using noghresod::SecretCache;
+using noghresod::SecretId;
+using noghresod::SecureString;
+using noghresod::host::JniHost;
+using microbench::nowNs;
+
+namespace {
+    const char* const NATIVE_KEY_MANAGER = "com/noghre/sod/core/security/NativeKeyManager";
+    const char* const NATIVE_KEYS = "com/noghre/sod/core/security/NativeKeys";
+    const char* const KEY_PROVIDER = "com/noghre/sod/core/security/KeyProvider";
+    const char* const NATIVE_CRYPTO = "com/noghre/sod/core/security/NativeCrypto";
+    const char* const NATIVE_STATS = "com/noghre/sod/core/monitoring/NativeStats";
+    const char* const NATIVE_DIGITS = "com/noghre/sod/core/util/NativeDigits";
+    const char* const NATIVE_PRICE_FORMATTER = "com/noghre/sod/core/util/NativePriceFormatter";
+    const char* const NATIVE_JALALI = "com/noghre/sod/core/util/NativeJalali";
+    const char* const NATIVE_DATE_FORMATTER = "com/noghre/sod/core/util/NativeDateFormatter";
+    const char* const NATIVE_MONEY = "com/noghre/sod/core/util/NativeMoney";
+
+    using StringFn = jstring (*)(JNIEnv*, jobject);
+    using IntFn = jint (*)(JNIEnv*, jobject);
+    using ObjectFn = jobject (*)(JNIEnv*, jobject);
+    using VoidFn = void (*)(JNIEnv*, jobject);
+    using BeginFn = jlong (*)(JNIEnv*, jobject, jobject, jint);
+    using UpdateFn = jint (*)(JNIEnv*, jobject, jlong, jobject, jint, jint, jobject, jint);
+    using FinishFn = jboolean (*)(JNIEnv*, jobject, jlong, jobject, jint);
+    using ReleaseFn = void (*)(JNIEnv*, jobject, jlong);
+    using DumpFn = jbyteArray (*)(JNIEnv*, jobject);
+    using PrefetchFn = jboolean (*)(JNIEnv*, jobject, jint);
+    using ReadBytesFn = jint (*)(JNIEnv*, jobject, jint, jobject, jint, jint);
+    using ReadCharsFn = jint (*)(JNIEnv*, jobject, jint, jcharArray, jint);
+    using TranscodeFn = jboolean (*)(JNIEnv*, jobject, jcharArray, jint, jint, jint);
+    using FormatFn = jint (*)(JNIEnv*, jobject, jlong, jint, jcharArray, jint);
+    using FormatAllFn = jint (*)(JNIEnv*, jobject, jlongArray, jint, jcharArray, jintArray);
+    using FromEpochDayFn = jint (*)(JNIEnv*, jobject, jlong);
+    using ToEpochDayFn = jlong (*)(JNIEnv*, jobject, jint, jint, jint);
+    using FromEpochMillisAllFn = jint (*)(JNIEnv*, jobject, jlongArray, jlong, jintArray);
+    using DateCompileFn = jboolean (*)(JNIEnv*, jobject, jcharArray, jobject);
+    using DateFormatFn = jint (*)(JNIEnv*, jobject, jlong, jlong, jobject, jint, jcharArray, jint);
+    using DateFormatAllFn = jint (*)(JNIEnv*, jobject, jlongArray, jlong, jobject, jint, jcharArray, jintArray);
+    using PriceAllFn = jint (*)(JNIEnv*, jobject, jlongArray, jlongArray, jintArray, jlong, jint, jint, jlongArray);
+
+    struct Path {
+        const char* className;
+        const char* method;
+        std::function<bool(JNIEnv*)> call;   // false when the native reports failure
+    };
+
+    template <typename Fn>
+    Fn lookup(const char* className, const char* method) {
+        Fn fn = JniHost::instance().native<Fn>(className, method);
+        if (fn == nullptr) {
+            std::printf("MISSING %s.%s\n", className, method);
+        }
+        return fn;
+    }
+
+    Path stringPath(const char* className, const char* method) {
+        StringFn fn = lookup<StringFn>(className, method);
+        return { className, method, [fn](JNIEnv* env) {
+            return fn != nullptr && fn(env, nullptr) != nullptr;
+        } };
+    }
+
+    Path intPath(const char* className, const char* method) {
+        IntFn fn = lookup<IntFn>(className, method);
+        return { className, method, [fn](JNIEnv* env) {
+            return fn != nullptr && fn(env, nullptr) > 0;
+        } };
+    }
+
+    Path objectPath(const char* className, const char* method) {
+        ObjectFn fn = lookup<ObjectFn>(className, method);
+        return { className, method, [fn](JNIEnv* env) {
+            return fn != nullptr && fn(env, nullptr) != nullptr;
+        } };
+    }
+
+    Path voidPath(const char* className, const char* method) {
+        VoidFn fn = lookup<VoidFn>(className, method);
+        return { className, method, [fn](JNIEnv* env) {
+            if (fn != nullptr) {
+                fn(env, nullptr);
+            }
+            return fn != nullptr;
+        } };
+    }
+
+    // The placeholder payloads do not decrypt on the host, so only check
+    // that the native answers
+    Path prefetchPath(const char* className, const char* method, jint secretId) {
+        PrefetchFn fn = lookup<PrefetchFn>(className, method);
+        return { className, method, [fn, secretId](JNIEnv* env) {
+            if (fn != nullptr) {
+                fn(env, nullptr, secretId);
+            }
+            return fn != nullptr;
+        } };
+    }
+
+    /**
+     * A secret that is still loading does not hold up lookups of another
+     * one: the API key loader waits until the base URL has been served.
+     */
+    bool secretLoadsIndependent() {
+        SecretCache& cache = SecretCache::instance();
+        std::promise<void> urlServed;
+        std::future<void> urlDone = urlServed.get_future();
+
+        bool independent = false;
+        std::thread keyLoad([&] {
+            cache.withSecret(SecretId::API_KEY,
+                [&] {
+                    independent = urlDone.wait_for(std::chrono::seconds(5)) == std::future_status::ready;
+                    return SecureString("key");
+                },
+                [](const char*, size_t) {});
+        });
+        // Give the key loader a head start so it is mid-load below
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        cache.withSecret(SecretId::API_BASE_URL,
+            [] { return SecureString("url"); },
+            [](const char*, size_t) {});
+        urlServed.set_value();
+        keyLoad.join();
+
+        cache.clear();
+        return independent;
+    }
+
+    /**
+     * Readers racing clear() and reloads only ever see a whole value: every
+     * value is one repeated letter, so a torn or wiped read shows up as a
+     * mixed or short string.
+     */
+    bool secretReadsConsistent() {
+        const size_t readers = 8;
+        const size_t length = 64;
+        SecretCache& cache = SecretCache::instance();
+        std::atomic<bool> done{false};
+        std::atomic<size_t> torn{0};
+        std::atomic<size_t> reloads{0};
+
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < readers; t++) {
+            threads.emplace_back([&] {
+                while (!done.load()) {
+                    cache.withSecret(SecretId::API_KEY,
+                        [&] { return SecureString(length, static_cast<char>('a' + reloads++ % 26)); },
+                        [&](const char* value, size_t size) {
+                            bool whole = size == length && std::strlen(value) == length;
+                            for (size_t i = 1; whole && i < size; i++) {
+                                whole = value[i] == value[0];
+                            }
+                            if (!whole) {
+                                torn++;
+                            }
+                        });
+                }
+            });
+        }
+        // Bounded in time too: on a single core every yield is a timeslice
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(300);
+        for (int i = 0; i < 2000 && std::chrono::steady_clock::now() < deadline; i++) {
+            cache.clear();
+            std::this_thread::yield();
+        }
+        done = true;
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        cache.clear();
+        return torn.load() == 0;
+    }
+
+    /**
+     * A cached secret copied into a direct buffer and a char[]: exact bytes,
+     * UTF-16 with a surrogate pair, and nothing written when it does not fit.
+     */
+    bool secretDelivered(JNIEnv* env) {
+        auto readBytes = lookup<ReadBytesFn>(KEY_PROVIDER, "nativeReadSecretBytes");
+        auto readChars = lookup<ReadCharsFn>(KEY_PROVIDER, "nativeReadSecretChars");
+        if (readBytes == nullptr || readChars == nullptr) {
+            return false;
+        }
+
+        // 2-byte and 4-byte UTF-8 sequences; the latter becomes a surrogate pair
+        const char secret[] = "key-\xC3\xA9-\xF0\x9D\x84\x9E";
+        const jchar expected[] = { 'k', 'e', 'y', '-', 0xE9, '-', 0xD834, 0xDD1E };
+        const size_t secretLength = sizeof(secret) - 1;
+        const jint id = static_cast<jint>(SecretId::API_KEY);
+        SecretCache& cache = SecretCache::instance();
+        cache.clear();
+        cache.withSecret(SecretId::API_KEY,
+            [&] { return SecureString(secret, secretLength); },
+            [](const char*, size_t) {});
+
+        uint8_t storage[32] = {};
+        jobject buffer = env->NewDirectByteBuffer(storage, sizeof(storage));
+        bool ok = readBytes(env, nullptr, id, buffer, 4, 20) == static_cast<jint>(secretLength) &&
+                  std::memcmp(storage + 4, secret, secretLength) == 0;
+        std::memset(storage, 0, sizeof(storage));
+        ok = ok && readBytes(env, nullptr, id, buffer, 0, 4) == static_cast<jint>(secretLength) &&
+             storage[0] == 0;
+        env->DeleteLocalRef(buffer);
+
+        const jint units = sizeof(expected) / sizeof(expected[0]);
+        jcharArray chars = env->NewCharArray(units + 2);
+        jchar out[units + 2] = {};
+        ok = ok && readChars(env, nullptr, id, chars, 2) == units;
+        env->GetCharArrayRegion(chars, 0, units + 2, out);
+        ok = ok && out[0] == 0 && std::memcmp(out + 2, expected, sizeof(expected)) == 0;
+        ok = ok && readChars(env, nullptr, id, chars, 3) == units;
+        env->DeleteLocalRef(chars);
+
+        cache.clear();
+        return ok;
+    }
+
+    /**
+     * A slice of a concatenated batch rewritten in place: only the slice
+     * changes, and bad ranges or scripts are refused.
+     */
+    bool digitsTranscoded(JNIEnv* env) {
+        auto transcode = lookup<TranscodeFn>(NATIVE_DIGITS, "nativeTranscode");
+        if (transcode == nullptr) {
+            return false;
+        }
+
+        // "12|۳٤5" with the Latin "12" outside the slice; 1 = PERSIAN
+        const jchar input[] = { '1', '2', '|', 0x06F3, 0x0664, '5' };
+        const jchar expected[] = { '1', '2', '|', 0x06F3, 0x06F4, 0x06F5 };
+        const jint length = sizeof(input) / sizeof(input[0]);
+        jcharArray chars = env->NewCharArray(length);
+        env->SetCharArrayRegion(chars, 0, length, input);
+        jchar out[length] = {};
+        bool ok = transcode(env, nullptr, chars, 3, 3, 1) == JNI_TRUE;
+        env->GetCharArrayRegion(chars, 0, length, out);
+        ok = ok && std::memcmp(out, expected, sizeof(expected)) == 0;
+        ok = ok && transcode(env, nullptr, chars, 3, 3, 1) == JNI_FALSE;
+        ok = ok && transcode(env, nullptr, chars, 4, 3, 0) == JNI_FALSE;
+        ok = ok && transcode(env, nullptr, chars, 0, length, 3) == JNI_FALSE;
+        env->GetCharArrayRegion(chars, 0, length, out);
+        ok = ok && std::memcmp(out, expected, sizeof(expected)) == 0;
+        env->DeleteLocalRef(chars);
+        return ok;
+    }
+
+    /**
+     * Grouping, signs, INT64_MIN, the Toman suffix and Latin digits, one
+     * value at a time and as one batch with its end offsets.
+     */
+    bool pricesFormatted(JNIEnv* env) {
+        auto format = lookup<FormatFn>(NATIVE_PRICE_FORMATTER, "nativeFormat");
+        auto formatAll = lookup<FormatAllFn>(NATIVE_PRICE_FORMATTER, "nativeFormatAll");
+        if (format == nullptr || formatAll == nullptr) {
+            return false;
+        }
+
+        const jint LATIN = 1;
+        const jint TOMAN = 2;
+        struct Case {
+            jlong value;
+            jint flags;
+            std::u16string expected;
+        };
+        const Case cases[] = {
+            { 0, 0, u"\u06F0" },
+            { 999, 0, u"\u06F9\u06F9\u06F9" },
+            { 1000, 0, u"\u06F1\u066C\u06F0\u06F0\u06F0" },
+            { -1234567, 0, u"\u2212\u06F1\u066C\u06F2\u06F3\u06F4\u066C\u06F5\u06F6\u06F7" },
+            { 1500000, TOMAN, u"\u06F1\u066C\u06F5\u06F0\u06F0\u066C\u06F0\u06F0\u06F0 \u062A\u0648\u0645\u0627\u0646" },
+            { -1500000, LATIN, u"-1,500,000" },
+            { INT64_MIN, LATIN | TOMAN, u"-9,223,372,036,854,775,808 \u062A\u0648\u0645\u0627\u0646" },
+        };
+        const jsize count = sizeof(cases) / sizeof(cases[0]);
+        const jsize room = 32;
+
+        jcharArray chars = env->NewCharArray(count * room);
+        jchar out[count * room];
+        bool ok = true;
+        for (const Case& c : cases) {
+            jint length = format(env, nullptr, c.value, c.flags, chars, room);
+            if (length < 0) {
+                ok = false;
+                continue;
+            }
+            env->GetCharArrayRegion(chars, room, length, out);
+            ok = ok && std::u16string(reinterpret_cast<const char16_t*>(out), length) == c.expected;
+        }
+        ok = ok && format(env, nullptr, 1, 0, chars, count * room - room + 1) == -1;
+
+        // The batch shares flags, so it takes the Persian cases only
+        const jsize persian = 4;
+        jlongArray values = env->NewLongArray(persian);
+        jintArray ends = env->NewIntArray(persian);
+        for (jsize i = 0; i < persian; i++) {
+            env->SetLongArrayRegion(values, i, 1, &cases[i].value);
+        }
+        ok = ok && formatAll(env, nullptr, values, 0, chars, ends) == persian;
+        jint endOffsets[persian];
+        env->GetIntArrayRegion(ends, 0, persian, endOffsets);
+        env->GetCharArrayRegion(chars, 0, endOffsets[persian - 1], out);
+        jint start = 0;
+        for (jsize i = 0; i < persian && ok; i++) {
+            ok = std::u16string(reinterpret_cast<const char16_t*>(out + start),
+                                endOffsets[i] - start) == cases[i].expected;
+            start = endOffsets[i];
+        }
+        env->DeleteLocalRef(ends);
+        env->DeleteLocalRef(values);
+        env->DeleteLocalRef(chars);
+        return ok;
+    }
+
+    /**
+     * Nowruz 1403 (epoch day 19802, a Wednesday) as a day, back to a day,
+     * and as instants either side of Tehran midnight in one batch.
+     */
+    bool jalaliConverted(JNIEnv* env) {
+        auto fromEpochDay = lookup<FromEpochDayFn>(NATIVE_JALALI, "nativeFromEpochDay");
+        auto toEpochDay = lookup<ToEpochDayFn>(NATIVE_JALALI, "nativeToEpochDay");
+        auto fromEpochMillisAll = lookup<FromEpochMillisAllFn>(NATIVE_JALALI, "nativeFromEpochMillisAll");
+        if (fromEpochDay == nullptr || toEpochDay == nullptr || fromEpochMillisAll == nullptr) {
+            return false;
+        }
+
+        // 1403 << 12 | 1 << 8 | 1 << 3 | 4 (Wednesday, counting from Saturday)
+        const jint nowruz = (1403 << 12) | (1 << 8) | (1 << 3) | 4;
+        bool ok = fromEpochDay(env, nullptr, 19802) == nowruz &&
+                  toEpochDay(env, nullptr, 1403, 1, 1) == 19802 &&
+                  toEpochDay(env, nullptr, 1402, 12, 30) == INT64_MIN &&
+                  fromEpochDay(env, nullptr, 1000000) == 0;
+
+        const jlong tehran = 12600000;
+        const jlong midnight = jlong(19802) * 86400000 - tehran;
+        const jlong instants[] = { midnight - 1, midnight };
+        jlongArray millis = env->NewLongArray(2);
+        jintArray packed = env->NewIntArray(2);
+        env->SetLongArrayRegion(millis, 0, 2, instants);
+        jint out[2] = {};
+        ok = ok && fromEpochMillisAll(env, nullptr, millis, tehran, packed) == 2;
+        env->GetIntArrayRegion(packed, 0, 2, out);
+        ok = ok && out[0] == fromEpochDay(env, nullptr, 19801) && out[1] == nowruz;
+        env->DeleteLocalRef(packed);
+        env->DeleteLocalRef(millis);
+        return ok;
+    }
+
+    jcharArray newChars(JNIEnv* env, const std::u16string& text) {
+        jcharArray chars = env->NewCharArray(static_cast<jsize>(text.size()));
+        env->SetCharArrayRegion(chars, 0, static_cast<jsize>(text.size()),
+                                reinterpret_cast<const jchar*>(text.data()));
+        return chars;
+    }
+
+    // NativeDateFormatter.COMPILED_PATTERN_BYTES
+    struct CompiledPattern {
+        alignas(8) uint8_t bytes[512];
+    };
+
+    /**
+     * [pattern] compiled through nativeCompile into [storage], as a direct
+     * buffer; nullptr if rejected.
+     */
+    jobject compilePattern(JNIEnv* env, DateCompileFn compile, const std::u16string& pattern,
+                           CompiledPattern* storage) {
+        jcharArray chars = newChars(env, pattern);
+        jobject buffer = env->NewDirectByteBuffer(storage->bytes, sizeof(storage->bytes));
+        bool compiled = compile(env, nullptr, chars, buffer) == JNI_TRUE;
+        env->DeleteLocalRef(chars);
+        if (!compiled) {
+            env->DeleteLocalRef(buffer);
+            return nullptr;
+        }
+        return buffer;
+    }
+
+    /**
+     * 2024-12-28T09:30Z (8 Dey 1403, 13:00 in Tehran) through a few
+     * patterns, each compiled once, a rejected pattern, and a two-day batch.
+     */
+    bool datesFormatted(JNIEnv* env) {
+        auto compile = lookup<DateCompileFn>(NATIVE_DATE_FORMATTER, "nativeCompile");
+        auto format = lookup<DateFormatFn>(NATIVE_DATE_FORMATTER, "nativeFormat");
+        auto formatAll = lookup<DateFormatAllFn>(NATIVE_DATE_FORMATTER, "nativeFormatAll");
+        if (compile == nullptr || format == nullptr || formatAll == nullptr) {
+            return false;
+        }
+
+        const jint LATIN = 1;
+        const jlong instant = INT64_C(1735378200000);
+        const jlong tehran = 12600000;
+        struct Case {
+            std::u16string pattern;
+            jint flags;
+            std::u16string expected;
+        };
+        const Case cases[] = {
+            { u"EEEE d MMMM yyyy", 0, u"شنبه ۸ دی ۱۴۰۳" },
+            { u"yyyy/MM/dd HH:mm", LATIN, u"1403/10/08 13:00" },
+            { u"yyyy/MM/dd HH:mm", 0, u"۱۴۰۳/۱۰/۰۸ ۱۳:۰۰" },
+            { u"d 'of' MMMM, ''yy", LATIN, u"8 of دی, '03" },
+        };
+
+        const jsize room = 64;
+        jcharArray chars = env->NewCharArray(2 * room);
+        jchar out[2 * room];
+        CompiledPattern storage;
+        bool ok = true;
+        for (const Case& c : cases) {
+            jobject pattern = compilePattern(env, compile, c.pattern, &storage);
+            // Twice with one compiled pattern
+            for (int i = 0; i < 2 && pattern != nullptr; i++) {
+                jint length = format(env, nullptr, instant, tehran, pattern, c.flags, chars, 0);
+                if (length < 0) {
+                    ok = false;
+                    break;
+                }
+                env->GetCharArrayRegion(chars, 0, length, out);
+                ok = ok && std::u16string(reinterpret_cast<const char16_t*>(out), length) == c.expected;
+            }
+            ok = ok && pattern != nullptr;
+            env->DeleteLocalRef(pattern);
+        }
+
+        ok = ok && compilePattern(env, compile, u"yyyy-QQ", &storage) == nullptr;
+        ok = ok && format(env, nullptr, instant, tehran, nullptr, 0, chars, 0) == -1;
+
+        jobject numeric = compilePattern(env, compile, cases[2].pattern, &storage);
+        const jlong instants[] = { instant, instant - 86400000 };
+        jlongArray millis = env->NewLongArray(2);
+        jintArray ends = env->NewIntArray(2);
+        env->SetLongArrayRegion(millis, 0, 2, instants);
+        ok = ok && formatAll(env, nullptr, millis, tehran, numeric, 0, chars, ends) == 2;
+        jint endOffsets[2] = {};
+        env->GetIntArrayRegion(ends, 0, 2, endOffsets);
+        env->GetCharArrayRegion(chars, 0, endOffsets[1], out);
+        ok = ok && std::u16string(reinterpret_cast<const char16_t*>(out), endOffsets[1]) ==
+                   u"۱۴۰۳/۱۰/۰۸ ۱۳:۰۰۱۴۰۳/۱۰/۰۷ ۱۳:۰۰";
+        env->DeleteLocalRef(ends);
+        env->DeleteLocalRef(millis);
+        env->DeleteLocalRef(numeric);
+        env->DeleteLocalRef(chars);
+        return ok;
+    }
+
+    /**
+     * Two products repriced in each rounding mode (see money_bench for the
+     * arithmetic itself), without discounts, and the rejected inputs.
+     */
+    bool productsPriced(JNIEnv* env) {
+        auto priceAll = lookup<PriceAllFn>(NATIVE_MONEY, "nativePriceAll");
+        if (priceAll == nullptr) {
+            return false;
+        }
+
+        // 12.345 g with 2,000,000 wage and 5% off, then 1 g plain; 9% VAT
+        const jlong weights[] = { 12345, 1000 };
+        const jlong wages[] = { 2000000, 0 };
+        const jint discounts[] = { 500, 0 };
+        const jlong pricePerGram = 1234567;
+        const jint vat = 900;
+        // HALF_UP, HALF_EVEN, DOWN, UP
+        const jlong expected[4][2] = {
+            { 17852775, 1345678 },
+            { 17852776, 1345678 },
+            { 17852775, 1345678 },
+            { 17852776, 1345679 },
+        };
+
+        jlongArray weightMg = env->NewLongArray(2);
+        jlongArray wage = env->NewLongArray(2);
+        jintArray discountBps = env->NewIntArray(2);
+        jlongArray totals = env->NewLongArray(2);
+        env->SetLongArrayRegion(weightMg, 0, 2, weights);
+        env->SetLongArrayRegion(wage, 0, 2, wages);
+        env->SetIntArrayRegion(discountBps, 0, 2, discounts);
+
+        bool ok = true;
+        jlong out[2] = {};
+        for (jint mode = 0; mode < 4; mode++) {
+            ok = ok && priceAll(env, nullptr, weightMg, wage, discountBps, pricePerGram, vat, mode, totals) == 2;
+            env->GetLongArrayRegion(totals, 0, 2, out);
+            ok = ok && out[0] == expected[mode][0] && out[1] == expected[mode][1];
+        }
+
+        ok = ok && priceAll(env, nullptr, weightMg, wage, nullptr, pricePerGram, vat, 0, totals) == 2;
+        ok = ok && priceAll(env, nullptr, weightMg, wage, discountBps, pricePerGram, vat, 4, totals) == -1;
+        ok = ok && priceAll(env, nullptr, weightMg, wage, discountBps, -1, vat, 0, totals) == 0;
+        env->DeleteLocalRef(totals);
+        env->DeleteLocalRef(discountBps);
+        env->DeleteLocalRef(wage);
+        env->DeleteLocalRef(weightMg);
+        return ok;
+    }
+
+    /**
+     * One NSE1 encrypt-then-decrypt round trip of [size] bytes through the
+     * NativeCrypto stream natives.
+     */
+    bool streamRoundTrip(JNIEnv* env, std::vector<uint8_t>& plain, std::vector<uint8_t>& work) {
+        static auto beginEncrypt = lookup<BeginFn>(NATIVE_CRYPTO, "nativeBeginEncrypt");
+        static auto beginDecrypt = lookup<BeginFn>(NATIVE_CRYPTO, "nativeBeginDecrypt");
+        static auto update = lookup<UpdateFn>(NATIVE_CRYPTO, "nativeUpdate");
+        static auto finishEncrypt = lookup<FinishFn>(NATIVE_CRYPTO, "nativeFinishEncrypt");
+        static auto finishDecrypt = lookup<FinishFn>(NATIVE_CRYPTO, "nativeFinishDecrypt");
+        static auto release = lookup<ReleaseFn>(NATIVE_CRYPTO, "nativeRelease");
+        if (!beginEncrypt || !beginDecrypt || !update || !finishEncrypt || !finishDecrypt || !release) {
+            return false;
+        }
+
+        const jint size = static_cast<jint>(plain.size());
+        uint8_t header[16];
+        uint8_t tag[16];
+        jobject headerBuffer = env->NewDirectByteBuffer(header, sizeof(header));
+        jobject tagBuffer = env->NewDirectByteBuffer(tag, sizeof(tag));
+        jobject plainBuffer = env->NewDirectByteBuffer(plain.data(), size);
+        jobject workBuffer = env->NewDirectByteBuffer(work.data(), size);
+
+        jlong stream = beginEncrypt(env, nullptr, headerBuffer, 0);
+        bool ok = stream != 0 &&
+                  update(env, nullptr, stream, plainBuffer, 0, size, workBuffer, 0) == size &&
+                  finishEncrypt(env, nullptr, stream, tagBuffer, 0);
+        release(env, nullptr, stream);
+
+        if (ok) {
+            stream = beginDecrypt(env, nullptr, headerBuffer, 0);
+            ok = stream != 0 &&
+                 update(env, nullptr, stream, workBuffer, 0, size, workBuffer, 0) == size &&
+                 finishDecrypt(env, nullptr, stream, tagBuffer, 0) &&
+                 std::equal(plain.begin(), plain.end(), work.begin());
+            release(env, nullptr, stream);
+        }
+
+        env->DeleteLocalRef(headerBuffer);
+        env->DeleteLocalRef(tagBuffer);
+        env->DeleteLocalRef(plainBuffer);
+        env->DeleteLocalRef(workBuffer);
+        return ok;
+    }
+
+    /**
+     * Encrypt then decrypt [plain] in place in [work], split over two
+     * updates at [split]: the one buffer's position moves by each update's
+     * output only, as NativeCrypto.Stream.update() does when input === output.
+     */
+    bool streamInPlace(JNIEnv* env, const std::vector<uint8_t>& plain, std::vector<uint8_t>& work, jint split) {
+        static auto beginEncrypt = lookup<BeginFn>(NATIVE_CRYPTO, "nativeBeginEncrypt");
+        static auto beginDecrypt = lookup<BeginFn>(NATIVE_CRYPTO, "nativeBeginDecrypt");
+        static auto update = lookup<UpdateFn>(NATIVE_CRYPTO, "nativeUpdate");
+        static auto finishEncrypt = lookup<FinishFn>(NATIVE_CRYPTO, "nativeFinishEncrypt");
+        static auto finishDecrypt = lookup<FinishFn>(NATIVE_CRYPTO, "nativeFinishDecrypt");
+        static auto release = lookup<ReleaseFn>(NATIVE_CRYPTO, "nativeRelease");
+        if (!beginEncrypt || !beginDecrypt || !update || !finishEncrypt || !finishDecrypt || !release) {
+            return false;
+        }
+
+        const jint size = static_cast<jint>(plain.size());
+        uint8_t header[16];
+        uint8_t tag[16];
+        work.assign(plain.begin(), plain.end());
+        jobject headerBuffer = env->NewDirectByteBuffer(header, sizeof(header));
+        jobject tagBuffer = env->NewDirectByteBuffer(tag, sizeof(tag));
+        jobject workBuffer = env->NewDirectByteBuffer(work.data(), size);
+
+        jlong stream = beginEncrypt(env, nullptr, headerBuffer, 0);
+        bool ok = stream != 0 &&
+                  update(env, nullptr, stream, workBuffer, 0, split, workBuffer, 0) == split &&
+                  update(env, nullptr, stream, workBuffer, split, size - split, workBuffer, split) == size - split &&
+                  finishEncrypt(env, nullptr, stream, tagBuffer, 0) &&
+                  !std::equal(plain.begin(), plain.end(), work.begin());
+        release(env, nullptr, stream);
+
+        if (ok) {
+            // Decrypt split elsewhere: the keystream must not depend on it
+            jint other = size - split;
+            stream = beginDecrypt(env, nullptr, headerBuffer, 0);
+            ok = stream != 0 &&
+                 update(env, nullptr, stream, workBuffer, 0, other, workBuffer, 0) == other &&
+                 update(env, nullptr, stream, workBuffer, other, size - other, workBuffer, other) == size - other &&
+                 finishDecrypt(env, nullptr, stream, tagBuffer, 0) &&
+                 std::equal(plain.begin(), plain.end(), work.begin());
+            release(env, nullptr, stream);
+        }
+
+        env->DeleteLocalRef(headerBuffer);
+        env->DeleteLocalRef(tagBuffer);
+        env->DeleteLocalRef(workBuffer);
+        return ok;
+    }
+
+    void benchPath(JNIEnv* env, const Path& path) {
+        const size_t iterations = 20000;
+        std::vector<double> samples(iterations);
+        JniHost& host = JniHost::instance();
+
+        // Warm up caches (and the secret cache for the decrypting paths)
+        path.call(env);
+        host.releaseLocals();
+
+        for (size_t i = 0; i < iterations; i++) {
+            double startNs = nowNs();
+            path.call(env);
+            samples[i] = nowNs() - startNs;
+            host.releaseLocals();
+        }
+
+        double total = 0;
+        for (double sample : samples) {
+            total += sample;
+        }
+        std::sort(samples.begin(), samples.end());
+        std::printf("%-14s %-26s %10.1f ns/op  p99 %10.1f ns\n",
+                    std::strrchr(path.className, '/') + 1, path.method,
+                    total / iterations, samples[iterations * 99 / 100]);
+    }
+
+    void benchStream(JNIEnv* env, size_t size) {
+        std::vector<uint8_t> plain(size, 0x5A), work(size);
+        size_t iterations = std::max<size_t>(16, (32u << 20) / size);
+
+        streamRoundTrip(env, plain, work);
+        double startNs = nowNs();
+        for (size_t i = 0; i < iterations; i++) {
+            streamRoundTrip(env, plain, work);
+        }
+        double elapsedNs = nowNs() - startNs;
+        double bytes = 2.0 * static_cast<double>(size) * static_cast<double>(iterations);
+
+        std::printf("NativeCrypto   stream round trip size=%-8zu %6.2f GB/s %10.1f ns/op\n",
+                    size, bytes / elapsedNs, elapsedNs / iterations);
+    }
+
+    /**
+     * Entries in the snapshot from [dump], or -1.
+     */
+    jint snapshotEntries(JNIEnv* env, DumpFn dump) {
+        jbyteArray snapshot = dump(env, nullptr);
+        if (snapshot == nullptr || env->GetArrayLength(snapshot) < 12) {
+            return -1;
+        }
+        jint header[3];
+        env->GetByteArrayRegion(snapshot, 0, sizeof(header), reinterpret_cast<jbyte*>(header));
+        return header[1];
+    }
+
+    /**
+     * The stats snapshot lists at least [expectedEntries] called entry points.
+     */
+    bool statsRecorded(JNIEnv* env, size_t expectedEntries) {
+        DumpFn dump = lookup<DumpFn>(NATIVE_STATS, "dumpNativeStats");
+        return dump != nullptr && snapshotEntries(env, dump) >= static_cast<jint>(expectedEntries);
+    }
+
+    /**
+     * dumpAndResetNativeStats() returns what dumpNativeStats() did and
+     * leaves nothing behind.
+     */
+    bool statsDrained(JNIEnv* env) {
+        DumpFn dump = lookup<DumpFn>(NATIVE_STATS, "dumpNativeStats");
+        DumpFn dumpAndReset = lookup<DumpFn>(NATIVE_STATS, "dumpAndResetNativeStats");
+        if (dump == nullptr || dumpAndReset == nullptr) {
+            return false;
+        }
+        jint before = snapshotEntries(env, dump);
+        return before > 0 && snapshotEntries(env, dumpAndReset) == before && snapshotEntries(env, dump) == 0;
+    }
+}
+
+int main(int argc, char** argv) {
+    // --verify: every path once, plus a leak check, for ctest
+    bool verifyOnly = argc > 1 && std::strcmp(argv[1], "--verify") == 0;
+
+    JniHost& host = JniHost::instance();
+    JNIEnv* env = host.env();
+    if (host.load() != JNI_VERSION_1_6) {
+        std::printf("JNI_OnLoad failed\n");
+        return 1;
+    }
+
+    const Path paths[] = {
+        stringPath(NATIVE_KEY_MANAGER, "getMerchantId"),
+        stringPath(NATIVE_KEY_MANAGER, "getApiKey"),
+        stringPath(NATIVE_KEYS, "getApiUrl"),
+        stringPath(NATIVE_KEYS, "getCertificatePinSha"),
+        stringPath(NATIVE_KEYS, "getBackupCertificatePin"),
+        objectPath(NATIVE_KEYS, "getCertificatePins"),
+        stringPath(NATIVE_KEYS, "getPaymentGatewayKey"),
+        stringPath(NATIVE_KEYS, "getFirebaseKey"),
+        intPath(NATIVE_KEYS, "getApiTimeout"),
+        intPath(NATIVE_KEYS, "getMaxRetries"),
+        intPath(NATIVE_KEYS, "getRetryDelay"),
+        objectPath(NATIVE_KEYS, "getNetworkConfigBundle"),
+        stringPath(KEY_PROVIDER, "getApiKey"),
+        stringPath(KEY_PROVIDER, "getApiBaseUrl"),
+        stringPath(KEY_PROVIDER, "getStripeKey"),
+        stringPath(KEY_PROVIDER, "getCertificatePins"),
+        voidPath(KEY_PROVIDER, "clearSensitiveData"),
+        prefetchPath(KEY_PROVIDER, "nativePrefetch", 0),
+    };
+
+    int failures = 0;
+    size_t baseline = host.liveObjects();
+    for (const Path& path : paths) {
+        if (!path.call(env)) {
+            std::printf("FAILED %s.%s\n", path.className, path.method);
+            failures++;
+        }
+        host.releaseLocals();
+    }
+    std::vector<uint8_t> plain(1000, 0x33), work(1000);
+    if (!streamRoundTrip(env, plain, work)) {
+        std::printf("FAILED NativeCrypto stream round trip\n");
+        failures++;
+    }
+    host.releaseLocals();
+    for (uint8_t& byte : plain) {
+        byte = static_cast<uint8_t>(&byte - plain.data());
+    }
+    if (!streamInPlace(env, plain, work, 333)) {
+        std::printf("FAILED NativeCrypto in-place stream\n");
+        failures++;
+    }
+    host.releaseLocals();
+    if (!secretReadsConsistent()) {
+        std::printf("FAILED SecretCache concurrent reads\n");
+        failures++;
+    }
+    if (!secretDelivered(env)) {
+        std::printf("FAILED KeyProvider secret delivery\n");
+        failures++;
+    }
+    host.releaseLocals();
+    if (!digitsTranscoded(env)) {
+        std::printf("FAILED NativeDigits transcode\n");
+        failures++;
+    }
+    host.releaseLocals();
+    if (!pricesFormatted(env)) {
+        std::printf("FAILED NativePriceFormatter format\n");
+        failures++;
+    }
+    host.releaseLocals();
+    if (!jalaliConverted(env)) {
+        std::printf("FAILED NativeJalali conversion\n");
+        failures++;
+    }
+    host.releaseLocals();
+    if (!datesFormatted(env)) {
+        std::printf("FAILED NativeDateFormatter format\n");
+        failures++;
+    }
+    host.releaseLocals();
+    if (!productsPriced(env)) {
+        std::printf("FAILED NativeMoney priceAll\n");
+        failures++;
+    }
+    host.releaseLocals();
+    if (!secretLoadsIndependent()) {
+        std::printf("FAILED SecretCache independent loads\n");
+        failures++;
+    }
+#if NOGHRESOD_NATIVE_STATS
+    if (!statsRecorded(env, sizeof(paths) / sizeof(paths[0]))) {
+        std::printf("FAILED NativeStats.dumpNativeStats\n");
+        failures++;
+    }
+    host.releaseLocals();
+    if (!statsDrained(env)) {
+        std::printf("FAILED NativeStats.dumpAndResetNativeStats\n");
+        failures++;
+    }
+    host.releaseLocals();
+#endif
+    if (host.liveObjects() != baseline) {
+        std::printf("LEAK %zu objects outlive their calls\n", host.liveObjects() - baseline);
+        failures++;
+    }
+    if (verifyOnly || failures != 0) {
+        return failures == 0 ? 0 : 1;
+    }
+
+    for (const Path& path : paths) {
+        benchPath(env, path);
+    }
+    for (size_t size : { size_t(1024), size_t(64 * 1024), size_t(1024 * 1024) }) {
+        benchStream(env, size);
+    }
+    return 0;
+}
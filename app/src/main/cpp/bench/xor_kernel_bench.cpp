@@ -0,0 +1,113 @@
+// Host benchmark for the XOR decode kernels in src/xor_kernel.cpp.
+//
+// Runs every kernel compiled for this host over a range of payload sizes,
+// checks each against the scalar reference and prints throughput. On x86 the
+// cycle counter gives bytes/cycle; elsewhere throughput is reported per ns.
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "microbench.h"
+#include "xor_kernel.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_CYCLE_COUNTER 1
+#endif
+
+using noghresod::xor_kernels::XorFn;
+using microbench::nowNs;
+
+namespace {
+    struct Kernel {
+        const char* name;
+        XorFn fn;
+        bool available;
+    };
+
+    bool verify(const Kernel& kernel, size_t size, const std::vector<uint8_t>& key) {
+        std::vector<uint8_t> src(size), expected(size), actual(size);
+        for (size_t i = 0; i < size; i++) {
+            src[i] = static_cast<uint8_t>(i * 131 + 7);
+        }
+        noghresod::xor_kernels::scalar(expected.data(), src.data(), size, key.data(), key.size());
+        kernel.fn(actual.data(), src.data(), size, key.data(), key.size());
+        return expected == actual;
+    }
+
+    void run(const Kernel& kernel, size_t size, const std::vector<uint8_t>& key) {
+        std::vector<uint8_t> buffer(size, 0x5A);
+        size_t iterations = size >= (1u << 20) ? 200 : (64u << 20) / size;
+
+        // Warm up caches and the dispatch path
+        kernel.fn(buffer.data(), buffer.data(), size, key.data(), key.size());
+
+        double startNs = nowNs();
+#ifdef HAVE_CYCLE_COUNTER
+        unsigned long long startCycles = __rdtsc();
+#endif
+        for (size_t i = 0; i < iterations; i++) {
+            kernel.fn(buffer.data(), buffer.data(), size, key.data(), key.size());
+        }
+#ifdef HAVE_CYCLE_COUNTER
+        double cycles = static_cast<double>(__rdtsc() - startCycles);
+#endif
+        double elapsedNs = nowNs() - startNs;
+        double bytes = static_cast<double>(size) * static_cast<double>(iterations);
+
+#ifdef HAVE_CYCLE_COUNTER
+        std::printf("%-8s key=%-3zu size=%-8zu %8.3f bytes/cycle %8.2f GB/s\n",
+                    kernel.name, key.size(), size, bytes / cycles, bytes / elapsedNs);
+#else
+        std::printf("%-8s key=%-3zu size=%-8zu %8.3f bytes/ns\n",
+                    kernel.name, key.size(), size, bytes / elapsedNs);
+#endif
+        // Keep the result observable
+        if (buffer[0] == 0x42 && buffer[size - 1] == 0x42) {
+            std::printf(" ");
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    // --verify: correctness checks only, for ctest
+    bool verifyOnly = argc > 1 && std::strcmp(argv[1], "--verify") == 0;
+    namespace k = noghresod::xor_kernels;
+    const Kernel kernels[] = {
+        { "scalar", k::scalar, true },
+        { "word", k::word, true },
+        { "sse2", k::sse2(), k::sse2() != nullptr },
+        { "avx2", k::avx2(), k::avx2() != nullptr && k::cpuHasAvx2() },
+        { "neon", k::neon(), k::neon() != nullptr && k::cpuHasNeon() },
+    };
+    const size_t sizes[] = { 64, 1024, 64 * 1024, 1024 * 1024 };
+    const size_t keySizes[] = { 7, 32 };
+
+    std::printf("dispatch: %s\n", noghresod::xorKernelName());
+
+    int failures = 0;
+    for (const Kernel& kernel : kernels) {
+        if (!kernel.available) {
+            continue;
+        }
+        for (size_t keySize : keySizes) {
+            std::vector<uint8_t> key(keySize);
+            for (size_t i = 0; i < keySize; i++) {
+                key[i] = static_cast<uint8_t>(0xA5 ^ (i * 29));
+            }
+            for (size_t size : { size_t(1), size_t(15), size_t(33), size_t(1000) }) {
+                if (!verify(kernel, size, key)) {
+                    std::printf("MISMATCH %s key=%zu size=%zu\n", kernel.name, keySize, size);
+                    failures++;
+                }
+            }
+            if (verifyOnly) {
+                continue;
+            }
+            for (size_t size : sizes) {
+                run(kernel, size, key);
+            }
+        }
+    }
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,79 @@
+# Release tuning shared by the Android library and the host benchmarks.
+#
+# NOGHRESOD_OPTIMIZED_RELEASE (Release builds only):
+#   ThinLTO (plain LTO with GCC), -ffunction-sections/-fdata-sections with
+#   --gc-sections, and safe identical-code folding where the linker has it
+#   (lld, gold). Hidden visibility is set on the targets themselves.
+#
+# NOGHRESOD_PGO:
+#   GENERATE  instrument for clang IR profiles (host benchmark build)
+#   USE       optimize with NOGHRESOD_PGO_PROFILE (merged .profdata)
+#   Profiles come from scripts/native-pgo.sh; see there for the pipeline.
+
+include(CheckCXXCompilerFlag)
+include(CheckIPOSupported)
+include(CheckLinkerFlag)
+
+option(NOGHRESOD_OPTIMIZED_RELEASE "LTO, section GC and ICF for Release builds" ON)
+set(NOGHRESOD_PGO "OFF" CACHE STRING "Profile-guided optimization: OFF, GENERATE or USE")
+set_property(CACHE NOGHRESOD_PGO PROPERTY STRINGS OFF GENERATE USE)
+set(NOGHRESOD_PGO_PROFILE "" CACHE FILEPATH "Merged .profdata used when NOGHRESOD_PGO=USE")
+
+set(NOGHRESOD_OPTIMIZE_RELEASE OFF)
+if(NOGHRESOD_OPTIMIZED_RELEASE AND CMAKE_BUILD_TYPE STREQUAL "Release")
+    set(NOGHRESOD_OPTIMIZE_RELEASE ON)
+    check_ipo_supported(RESULT NOGHRESOD_IPO_SUPPORTED OUTPUT NOGHRESOD_IPO_ERROR LANGUAGES CXX)
+    if(NOT NOGHRESOD_IPO_SUPPORTED)
+        message(STATUS "LTO unavailable: ${NOGHRESOD_IPO_ERROR}")
+    endif()
+    check_linker_flag(CXX "-Wl,--icf=safe" NOGHRESOD_LINKER_ICF)
+endif()
+
+if(NOT NOGHRESOD_PGO STREQUAL "OFF")
+    if(NOT CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+        message(FATAL_ERROR "NOGHRESOD_PGO needs clang; use the NDK's host clang (scripts/native-pgo.sh)")
+    endif()
+    if(NOGHRESOD_PGO STREQUAL "USE" AND NOT EXISTS "${NOGHRESOD_PGO_PROFILE}")
+        message(FATAL_ERROR "NOGHRESOD_PGO=USE but NOGHRESOD_PGO_PROFILE is not a file: '${NOGHRESOD_PGO_PROFILE}'")
+    endif()
+endif()
+
+# Apply the release and PGO settings to [target].
+function(noghresod_optimize target)
+    get_target_property(type ${target} TYPE)
+    set(links OFF)
+    if(type STREQUAL "SHARED_LIBRARY" OR type STREQUAL "EXECUTABLE")
+        set(links ON)
+    endif()
+
+    if(NOGHRESOD_OPTIMIZE_RELEASE)
+        target_compile_options(${target} PRIVATE -ffunction-sections -fdata-sections)
+        if(NOGHRESOD_IPO_SUPPORTED)
+            # CMake picks -flto=thin for clang and -flto for GCC
+            set_property(TARGET ${target} PROPERTY INTERPROCEDURAL_OPTIMIZATION ON)
+        endif()
+        if(links)
+            target_link_options(${target} PRIVATE -Wl,--gc-sections)
+            if(NOGHRESOD_LINKER_ICF)
+                target_link_options(${target} PRIVATE -Wl,--icf=safe)
+            endif()
+        endif()
+    endif()
+
+    if(NOGHRESOD_PGO STREQUAL "GENERATE")
+        target_compile_options(${target} PRIVATE -fprofile-generate)
+        if(links)
+            target_link_options(${target} PRIVATE -fprofile-generate)
+        endif()
+    elseif(NOGHRESOD_PGO STREQUAL "USE")
+        # Profiles are collected on x86_64 and reused for every ABI: functions
+        # whose control flow differs per target (SIMD backends) simply stay
+        # unprofiled, which is not worth a warning each.
+        target_compile_options(${target} PRIVATE
+            -fprofile-use=${NOGHRESOD_PGO_PROFILE}
+            -Wno-profile-instr-unprofiled
+            -Wno-profile-instr-out-of-date
+            -Wno-backend-plugin
+        )
+    endif()
+endfunction()
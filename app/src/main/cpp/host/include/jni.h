@@ -0,0 +1,170 @@
+#ifndef NOGHRESOD_HOST_JNI_H
+#define NOGHRESOD_HOST_JNI_H
+
+/**
+ * Minimal JNI stand-in for host (Linux) builds.
+ *
+ * Declares the subset of the JNI C++ API the JNI layer uses, with the same
+ * spelling as the NDK's <jni.h>, so jni/ compiles unchanged off-device.
+ * The implementation in host/jni_host.cpp keeps a tiny in-process object
+ * model (strings, arrays, direct buffers, classes with static fields and
+ * registered natives); see host/jni_host.h for the driver API.
+ *
+ * Only the host CMake path puts this directory on the include path.
+ */
+
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+
+typedef uint8_t jboolean;
+typedef int8_t jbyte;
+typedef uint16_t jchar;
+typedef int16_t jshort;
+typedef int32_t jint;
+typedef int64_t jlong;
+typedef float jfloat;
+typedef double jdouble;
+typedef jint jsize;
+
+class _jobject {
+public:
+    virtual ~_jobject() = default;
+};
+class _jclass : public _jobject {};
+class _jstring : public _jobject {};
+class _jthrowable : public _jobject {};
+class _jarray : public _jobject {};
+class _jobjectArray : public _jarray {};
+class _jbooleanArray : public _jarray {};
+class _jbyteArray : public _jarray {};
+class _jcharArray : public _jarray {};
+class _jshortArray : public _jarray {};
+class _jintArray : public _jarray {};
+class _jlongArray : public _jarray {};
+class _jfloatArray : public _jarray {};
+class _jdoubleArray : public _jarray {};
+
+typedef _jobject* jobject;
+typedef _jclass* jclass;
+typedef _jstring* jstring;
+typedef _jthrowable* jthrowable;
+typedef _jarray* jarray;
+typedef _jobjectArray* jobjectArray;
+typedef _jbooleanArray* jbooleanArray;
+typedef _jbyteArray* jbyteArray;
+typedef _jcharArray* jcharArray;
+typedef _jshortArray* jshortArray;
+typedef _jintArray* jintArray;
+typedef _jlongArray* jlongArray;
+typedef _jfloatArray* jfloatArray;
+typedef _jdoubleArray* jdoubleArray;
+typedef jobject jweak;
+
+struct _jfieldID;
+typedef _jfieldID* jfieldID;
+struct _jmethodID;
+typedef _jmethodID* jmethodID;
+
+typedef struct {
+    const char* name;
+    const char* signature;
+    void* fnPtr;
+} JNINativeMethod;
+
+#define JNI_FALSE 0
+#define JNI_TRUE 1
+
+#define JNI_OK 0
+#define JNI_ERR (-1)
+#define JNI_EDETACHED (-2)
+#define JNI_EVERSION (-3)
+
+#define JNI_COMMIT 1
+#define JNI_ABORT 2
+
+#define JNI_VERSION_1_6 0x00010006
+
+#define JNIEXPORT __attribute__((visibility("default")))
+#define JNICALL
+
+struct _JavaVM;
+typedef _JavaVM JavaVM;
+
+namespace noghresod {
+namespace host {
+    struct EnvState;
+}
+}
+
+struct _JNIEnv {
+    // Classes, registration, references
+    jclass FindClass(const char* name);
+    jint RegisterNatives(jclass clazz, const JNINativeMethod* methods, jint count);
+    jclass GetObjectClass(jobject object);
+    jobject NewGlobalRef(jobject object);
+    void DeleteGlobalRef(jobject object);
+    void DeleteLocalRef(jobject object);
+    jint GetJavaVM(JavaVM** vm);
+
+    // Exceptions
+    jboolean ExceptionCheck();
+    void ExceptionClear();
+    jint ThrowNew(jclass clazz, const char* message);
+
+    // Static fields
+    jfieldID GetStaticFieldID(jclass clazz, const char* name, const char* signature);
+    jobject GetStaticObjectField(jclass clazz, jfieldID field);
+
+    // Strings
+    jstring NewStringUTF(const char* utf);
+    jstring NewString(const jchar* chars, jsize length);
+    jsize GetStringLength(jstring string);
+    jsize GetStringUTFLength(jstring string);
+    const char* GetStringUTFChars(jstring string, jboolean* isCopy);
+    void ReleaseStringUTFChars(jstring string, const char* chars);
+    const jchar* GetStringChars(jstring string, jboolean* isCopy);
+    void ReleaseStringChars(jstring string, const jchar* chars);
+    const jchar* GetStringCritical(jstring string, jboolean* isCopy);
+    void ReleaseStringCritical(jstring string, const jchar* chars);
+    void GetStringRegion(jstring string, jsize start, jsize length, jchar* buffer);
+
+    // Arrays
+    jsize GetArrayLength(jarray array);
+    jobjectArray NewObjectArray(jsize length, jclass elementClass, jobject initial);
+    jobject GetObjectArrayElement(jobjectArray array, jsize index);
+    void SetObjectArrayElement(jobjectArray array, jsize index, jobject value);
+
+    jbyteArray NewByteArray(jsize length);
+    jcharArray NewCharArray(jsize length);
+    jintArray NewIntArray(jsize length);
+    jlongArray NewLongArray(jsize length);
+
+    void GetByteArrayRegion(jbyteArray array, jsize start, jsize length, jbyte* buffer);
+    void SetByteArrayRegion(jbyteArray array, jsize start, jsize length, const jbyte* buffer);
+    void GetCharArrayRegion(jcharArray array, jsize start, jsize length, jchar* buffer);
+    void SetCharArrayRegion(jcharArray array, jsize start, jsize length, const jchar* buffer);
+    void GetIntArrayRegion(jintArray array, jsize start, jsize length, jint* buffer);
+    void SetIntArrayRegion(jintArray array, jsize start, jsize length, const jint* buffer);
+    void GetLongArrayRegion(jlongArray array, jsize start, jsize length, jlong* buffer);
+    void SetLongArrayRegion(jlongArray array, jsize start, jsize length, const jlong* buffer);
+
+    void* GetPrimitiveArrayCritical(jarray array, jboolean* isCopy);
+    void ReleasePrimitiveArrayCritical(jarray array, void* elements, jint mode);
+
+    // NIO
+    jobject NewDirectByteBuffer(void* address, jlong capacity);
+    void* GetDirectBufferAddress(jobject buffer);
+    jlong GetDirectBufferCapacity(jobject buffer);
+
+    noghresod::host::EnvState* state;
+};
+typedef _JNIEnv JNIEnv;
+
+struct _JavaVM {
+    jint GetEnv(void** env, jint version);
+    jint AttachCurrentThread(JNIEnv** env, void* args);
+    jint DetachCurrentThread();
+};
+
+#endif // NOGHRESOD_HOST_JNI_H
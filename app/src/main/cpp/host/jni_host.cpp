@@ -0,0 +1,682 @@
+#include "jni_host.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+extern "C" jint JNI_OnLoad(JavaVM* vm, void* reserved);
+
+namespace noghresod {
+namespace host {
+
+// ==========================
+// OBJECT MODEL
+// ==========================
+
+/**
+ * Reference count shared by every stand-in object. Local and global
+ * references both hold one count; the object dies with the last.
+ */
+struct HostObject {
+    virtual ~HostObject() = default;
+    int refs = 0;
+    bool permanent = false;
+};
+
+namespace {
+
+std::mutex heapMutex;
+size_t liveCount = 0;
+
+struct HostString : _jstring, HostObject {
+    std::u16string chars;
+    std::string utf;   // modified UTF-8, kept alongside for GetStringUTFChars
+
+    HostString() { liveCount++; }
+    ~HostString() override { liveCount--; }
+};
+
+template <typename Base, typename T>
+struct HostArray : Base, HostObject {
+    std::vector<T> elements;
+
+    explicit HostArray(jsize length) : elements(static_cast<size_t>(length)) { liveCount++; }
+    ~HostArray() override { liveCount--; }
+};
+
+using ByteArray = HostArray<_jbyteArray, jbyte>;
+using CharArray = HostArray<_jcharArray, jchar>;
+using IntArray = HostArray<_jintArray, jint>;
+using LongArray = HostArray<_jlongArray, jlong>;
+
+struct ObjectArray : _jobjectArray, HostObject {
+    std::vector<jobject> elements;
+
+    explicit ObjectArray(jsize length) : elements(static_cast<size_t>(length), nullptr) { liveCount++; }
+    ~ObjectArray() override;
+};
+
+struct DirectBuffer : _jobject, HostObject {
+    void* address;
+    jlong capacity;
+
+    DirectBuffer(void* a, jlong c) : address(a), capacity(c) { liveCount++; }
+    ~DirectBuffer() override { liveCount--; }
+};
+
+} // namespace
+
+} // namespace host
+} // namespace noghresod
+
+struct _jfieldID {
+    std::string name;
+    std::string signature;
+    std::string value;
+    bool isNull = true;
+};
+
+namespace noghresod {
+namespace host {
+
+namespace {
+
+struct HostClass : _jclass, HostObject {
+    std::string name;
+    std::map<std::string, std::unique_ptr<_jfieldID>> fields;
+    std::map<std::string, void*> natives;   // keyed by name, last registration wins
+};
+
+std::map<std::string, std::unique_ptr<HostClass>>& classes() {
+    static std::map<std::string, std::unique_ptr<HostClass>> registry;
+    return registry;
+}
+
+HostClass* classNamed(const char* name) {
+    auto& registry = classes();
+    auto it = registry.find(name);
+    if (it != registry.end()) {
+        return it->second.get();
+    }
+    auto clazz = std::make_unique<HostClass>();
+    clazz->name = name;
+    clazz->permanent = true;
+    HostClass* raw = clazz.get();
+    registry.emplace(name, std::move(clazz));
+    return raw;
+}
+
+HostObject* counted(jobject object) {
+    return object == nullptr ? nullptr : dynamic_cast<HostObject*>(object);
+}
+
+void retain(jobject object) {
+    if (HostObject* o = counted(object)) {
+        o->refs++;
+    }
+}
+
+void release(jobject object) {
+    HostObject* o = counted(object);
+    if (o == nullptr || o->permanent) {
+        return;
+    }
+    if (--o->refs <= 0) {
+        delete object;
+    }
+}
+
+ObjectArray::~ObjectArray() {
+    for (jobject element : elements) {
+        release(element);
+    }
+    liveCount--;
+}
+
+// ==========================
+// MODIFIED UTF-8
+// ==========================
+
+std::string encodeModifiedUtf8(const std::u16string& chars) {
+    std::string out;
+    out.reserve(chars.size());
+    for (char16_t c : chars) {
+        if (c != 0 && c < 0x80) {
+            out.push_back(static_cast<char>(c));
+        } else if (c < 0x800) {
+            out.push_back(static_cast<char>(0xC0 | (c >> 6)));
+            out.push_back(static_cast<char>(0x80 | (c & 0x3F)));
+        } else {
+            // Surrogates are encoded one unit at a time, as the JVM does
+            out.push_back(static_cast<char>(0xE0 | (c >> 12)));
+            out.push_back(static_cast<char>(0x80 | ((c >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (c & 0x3F)));
+        }
+    }
+    return out;
+}
+
+std::u16string decodeUtf8(const char* utf) {
+    std::u16string out;
+    const auto* p = reinterpret_cast<const unsigned char*>(utf);
+    while (*p != 0) {
+        uint32_t c = *p;
+        if (c < 0x80) {
+            p += 1;
+        } else if ((c & 0xE0) == 0xC0 && p[1] != 0) {
+            c = ((c & 0x1F) << 6) | (p[1] & 0x3F);
+            p += 2;
+        } else if ((c & 0xF0) == 0xE0 && p[1] != 0 && p[2] != 0) {
+            c = ((c & 0x0F) << 12) | ((p[1] & 0x3F) << 6) | (p[2] & 0x3F);
+            p += 3;
+        } else if ((c & 0xF8) == 0xF0 && p[1] != 0 && p[2] != 0 && p[3] != 0) {
+            // Standard 4-byte UTF-8 is accepted leniently and split into a surrogate pair
+            c = ((c & 0x07) << 18) | ((p[1] & 0x3F) << 12) | ((p[2] & 0x3F) << 6) | (p[3] & 0x3F);
+            p += 4;
+            c -= 0x10000;
+            out.push_back(static_cast<char16_t>(0xD800 | (c >> 10)));
+            c = 0xDC00 | (c & 0x3FF);
+        } else {
+            c = 0xFFFD;
+            p += 1;
+        }
+        out.push_back(static_cast<char16_t>(c));
+    }
+    return out;
+}
+
+} // namespace
+
+// ==========================
+// THREAD STATE
+// ==========================
+
+/**
+ * Per-thread environment: local references and the pending exception.
+ */
+struct EnvState {
+    std::vector<jobject> locals;
+    bool pendingException = false;
+    std::string exceptionClass;
+    std::string exceptionMessage;
+};
+
+namespace {
+
+_JavaVM hostVm;
+
+struct ThreadEnv {
+    _JNIEnv env{};
+    EnvState state;
+    bool attached = false;
+
+    ~ThreadEnv() {
+        std::lock_guard<std::mutex> lock(heapMutex);
+        for (jobject local : state.locals) {
+            release(local);
+        }
+    }
+};
+
+thread_local ThreadEnv threadEnv;
+
+template <typename T>
+T* makeLocal(JNIEnv* env, T* object) {
+    object->refs = 1;
+    env->state->locals.push_back(object);
+    return object;
+}
+
+void raise(JNIEnv* env, const char* clazz, const std::string& message) {
+    env->state->pendingException = true;
+    env->state->exceptionClass = clazz;
+    env->state->exceptionMessage = message;
+}
+
+template <typename Array>
+bool inBounds(JNIEnv* env, Array* array, jsize start, jsize length) {
+    if (start < 0 || length < 0 || static_cast<size_t>(start) + length > array->elements.size()) {
+        raise(env, "java/lang/ArrayIndexOutOfBoundsException", "region out of bounds");
+        return false;
+    }
+    return true;
+}
+
+template <typename Array, typename T>
+void getRegion(JNIEnv* env, jobject array, jsize start, jsize length, T* buffer) {
+    auto* a = static_cast<Array*>(array);
+    if (inBounds(env, a, start, length) && length > 0) {
+        std::memcpy(buffer, a->elements.data() + start, length * sizeof(T));
+    }
+}
+
+template <typename Array, typename T>
+void setRegion(JNIEnv* env, jobject array, jsize start, jsize length, const T* buffer) {
+    auto* a = static_cast<Array*>(array);
+    if (inBounds(env, a, start, length) && length > 0) {
+        std::memcpy(a->elements.data() + start, buffer, length * sizeof(T));
+    }
+}
+
+} // namespace
+
+// ==========================
+// DRIVER
+// ==========================
+
+JniHost& JniHost::instance() {
+    static JniHost host;
+    return host;
+}
+
+JniHost::JniHost() {
+    // Fingerprint fields read by the device-binding path
+    const char* const buildFields[][2] = {
+        {"FINGERPRINT", "host/noghresod/linux:14/HOST/1:userdebug/test-keys"},
+        {"MANUFACTURER", "host"},
+        {"MODEL", "linux-x86_64"},
+        {"BOARD", "host"},
+        {"HARDWARE", "host"},
+    };
+    for (const auto& field : buildFields) {
+        setStaticField("android/os/Build", field[0], field[1]);
+    }
+}
+
+JavaVM* JniHost::vm() {
+    return &hostVm;
+}
+
+JNIEnv* JniHost::env() {
+    JNIEnv* env = nullptr;
+    hostVm.AttachCurrentThread(&env, nullptr);
+    return env;
+}
+
+jint JniHost::load() {
+    static const jint result = JNI_OnLoad(&hostVm, nullptr);
+    return result;
+}
+
+void JniHost::setStaticField(const char* className, const char* field, const char* value) {
+    std::lock_guard<std::mutex> lock(heapMutex);
+    HostClass* clazz = classNamed(className);
+    auto& slot = clazz->fields[field];
+    if (!slot) {
+        slot = std::make_unique<_jfieldID>();
+        slot->name = field;
+        slot->signature = "Ljava/lang/String;";
+    }
+    slot->isNull = value == nullptr;
+    slot->value = value == nullptr ? "" : value;
+}
+
+void* JniHost::findNative(const char* className, const char* method) {
+    std::lock_guard<std::mutex> lock(heapMutex);
+    auto it = classes().find(className);
+    if (it == classes().end()) {
+        return nullptr;
+    }
+    auto native = it->second->natives.find(method);
+    return native == it->second->natives.end() ? nullptr : native->second;
+}
+
+void JniHost::releaseLocals() {
+    std::lock_guard<std::mutex> lock(heapMutex);
+    for (jobject local : threadEnv.state.locals) {
+        release(local);
+    }
+    threadEnv.state.locals.clear();
+}
+
+size_t JniHost::liveObjects() {
+    std::lock_guard<std::mutex> lock(heapMutex);
+    return liveCount;
+}
+
+std::string JniHost::utf8(JNIEnv* env, jstring string) {
+    if (string == nullptr) {
+        return std::string();
+    }
+    const char* chars = env->GetStringUTFChars(string, nullptr);
+    std::string copy(chars, env->GetStringUTFLength(string));
+    env->ReleaseStringUTFChars(string, chars);
+    return copy;
+}
+
+} // namespace host
+} // namespace noghresod
+
+using namespace noghresod::host;
+
+// ==========================
+// JavaVM
+// ==========================
+
+jint _JavaVM::GetEnv(void** env, jint /* version */) {
+    if (!threadEnv.attached) {
+        *env = nullptr;
+        return JNI_EDETACHED;
+    }
+    *env = &threadEnv.env;
+    return JNI_OK;
+}
+
+jint _JavaVM::AttachCurrentThread(JNIEnv** env, void* /* args */) {
+    if (!threadEnv.attached) {
+        threadEnv.env.state = &threadEnv.state;
+        threadEnv.attached = true;
+    }
+    *env = &threadEnv.env;
+    return JNI_OK;
+}
+
+jint _JavaVM::DetachCurrentThread() {
+    if (!threadEnv.attached) {
+        return JNI_EDETACHED;
+    }
+    JniHost::instance().releaseLocals();
+    threadEnv.attached = false;
+    return JNI_OK;
+}
+
+// ==========================
+// JNIEnv: classes, references, exceptions
+// ==========================
+
+jclass _JNIEnv::FindClass(const char* name) {
+    std::lock_guard<std::mutex> lock(heapMutex);
+    return classNamed(name);
+}
+
+jint _JNIEnv::RegisterNatives(jclass clazz, const JNINativeMethod* methods, jint count) {
+    std::lock_guard<std::mutex> lock(heapMutex);
+    auto* host = static_cast<HostClass*>(clazz);
+    for (jint i = 0; i < count; i++) {
+        if (methods[i].fnPtr == nullptr) {
+            raise(this, "java/lang/NoSuchMethodError", methods[i].name);
+            return JNI_ERR;
+        }
+        host->natives[methods[i].name] = methods[i].fnPtr;
+    }
+    return JNI_OK;
+}
+
+jclass _JNIEnv::GetObjectClass(jobject object) {
+    std::lock_guard<std::mutex> lock(heapMutex);
+    if (dynamic_cast<HostString*>(object) != nullptr) {
+        return classNamed("java/lang/String");
+    }
+    if (dynamic_cast<DirectBuffer*>(object) != nullptr) {
+        return classNamed("java/nio/DirectByteBuffer");
+    }
+    return classNamed("java/lang/Object");
+}
+
+jobject _JNIEnv::NewGlobalRef(jobject object) {
+    std::lock_guard<std::mutex> lock(heapMutex);
+    retain(object);
+    return object;
+}
+
+void _JNIEnv::DeleteGlobalRef(jobject object) {
+    std::lock_guard<std::mutex> lock(heapMutex);
+    release(object);
+}
+
+void _JNIEnv::DeleteLocalRef(jobject object) {
+    if (object == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(heapMutex);
+    auto& locals = state->locals;
+    auto it = std::find(locals.rbegin(), locals.rend(), object);
+    if (it != locals.rend()) {
+        locals.erase(std::next(it).base());
+        release(object);
+    }
+}
+
+jint _JNIEnv::GetJavaVM(JavaVM** vm) {
+    *vm = &hostVm;
+    return JNI_OK;
+}
+
+jboolean _JNIEnv::ExceptionCheck() {
+    return state->pendingException ? JNI_TRUE : JNI_FALSE;
+}
+
+void _JNIEnv::ExceptionClear() {
+    state->pendingException = false;
+    state->exceptionClass.clear();
+    state->exceptionMessage.clear();
+}
+
+jint _JNIEnv::ThrowNew(jclass clazz, const char* message) {
+    raise(this, static_cast<HostClass*>(clazz)->name.c_str(), message == nullptr ? "" : message);
+    return JNI_OK;
+}
+
+// ==========================
+// JNIEnv: static fields
+// ==========================
+
+jfieldID _JNIEnv::GetStaticFieldID(jclass clazz, const char* name, const char* signature) {
+    std::lock_guard<std::mutex> lock(heapMutex);
+    auto* host = static_cast<HostClass*>(clazz);
+    auto it = host->fields.find(name);
+    if (it == host->fields.end() || it->second->signature != signature) {
+        raise(this, "java/lang/NoSuchFieldError", name);
+        return nullptr;
+    }
+    return it->second.get();
+}
+
+jobject _JNIEnv::GetStaticObjectField(jclass /* clazz */, jfieldID field) {
+    if (field->isNull) {
+        return nullptr;
+    }
+    return NewStringUTF(field->value.c_str());
+}
+
+// ==========================
+// JNIEnv: strings
+// ==========================
+
+jstring _JNIEnv::NewStringUTF(const char* utf) {
+    if (utf == nullptr) {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(heapMutex);
+    auto* string = new HostString();
+    string->chars = decodeUtf8(utf);
+    string->utf = encodeModifiedUtf8(string->chars);
+    return makeLocal(this, string);
+}
+
+jstring _JNIEnv::NewString(const jchar* chars, jsize length) {
+    std::lock_guard<std::mutex> lock(heapMutex);
+    auto* string = new HostString();
+    string->chars.assign(reinterpret_cast<const char16_t*>(chars), static_cast<size_t>(length));
+    string->utf = encodeModifiedUtf8(string->chars);
+    return makeLocal(this, string);
+}
+
+jsize _JNIEnv::GetStringLength(jstring string) {
+    return static_cast<jsize>(static_cast<HostString*>(string)->chars.size());
+}
+
+jsize _JNIEnv::GetStringUTFLength(jstring string) {
+    return static_cast<jsize>(static_cast<HostString*>(string)->utf.size());
+}
+
+const char* _JNIEnv::GetStringUTFChars(jstring string, jboolean* isCopy) {
+    if (isCopy != nullptr) {
+        *isCopy = JNI_FALSE;
+    }
+    return static_cast<HostString*>(string)->utf.c_str();
+}
+
+void _JNIEnv::ReleaseStringUTFChars(jstring /* string */, const char* /* chars */) {}
+
+const jchar* _JNIEnv::GetStringChars(jstring string, jboolean* isCopy) {
+    if (isCopy != nullptr) {
+        *isCopy = JNI_FALSE;
+    }
+    return reinterpret_cast<const jchar*>(static_cast<HostString*>(string)->chars.c_str());
+}
+
+void _JNIEnv::ReleaseStringChars(jstring /* string */, const jchar* /* chars */) {}
+
+const jchar* _JNIEnv::GetStringCritical(jstring string, jboolean* isCopy) {
+    return GetStringChars(string, isCopy);
+}
+
+void _JNIEnv::ReleaseStringCritical(jstring /* string */, const jchar* /* chars */) {}
+
+void _JNIEnv::GetStringRegion(jstring string, jsize start, jsize length, jchar* buffer) {
+    const auto& chars = static_cast<HostString*>(string)->chars;
+    if (start < 0 || length < 0 || static_cast<size_t>(start) + length > chars.size()) {
+        raise(this, "java/lang/StringIndexOutOfBoundsException", "region out of bounds");
+        return;
+    }
+    std::memcpy(buffer, chars.data() + start, length * sizeof(jchar));
+}
+
+// ==========================
+// JNIEnv: arrays
+// ==========================
+
+jsize _JNIEnv::GetArrayLength(jarray array) {
+    if (auto* a = dynamic_cast<ObjectArray*>(array)) return static_cast<jsize>(a->elements.size());
+    if (auto* a = dynamic_cast<ByteArray*>(array)) return static_cast<jsize>(a->elements.size());
+    if (auto* a = dynamic_cast<CharArray*>(array)) return static_cast<jsize>(a->elements.size());
+    if (auto* a = dynamic_cast<IntArray*>(array)) return static_cast<jsize>(a->elements.size());
+    if (auto* a = dynamic_cast<LongArray*>(array)) return static_cast<jsize>(a->elements.size());
+    return 0;
+}
+
+jobjectArray _JNIEnv::NewObjectArray(jsize length, jclass /* elementClass */, jobject initial) {
+    std::lock_guard<std::mutex> lock(heapMutex);
+    auto* array = new ObjectArray(length);
+    for (jobject& element : array->elements) {
+        element = initial;
+        retain(initial);
+    }
+    return makeLocal(this, array);
+}
+
+jobject _JNIEnv::GetObjectArrayElement(jobjectArray array, jsize index) {
+    std::lock_guard<std::mutex> lock(heapMutex);
+    auto* a = static_cast<ObjectArray*>(array);
+    if (index < 0 || static_cast<size_t>(index) >= a->elements.size()) {
+        raise(this, "java/lang/ArrayIndexOutOfBoundsException", std::to_string(index));
+        return nullptr;
+    }
+    jobject element = a->elements[index];
+    if (element != nullptr) {
+        retain(element);
+        state->locals.push_back(element);
+    }
+    return element;
+}
+
+void _JNIEnv::SetObjectArrayElement(jobjectArray array, jsize index, jobject value) {
+    std::lock_guard<std::mutex> lock(heapMutex);
+    auto* a = static_cast<ObjectArray*>(array);
+    if (index < 0 || static_cast<size_t>(index) >= a->elements.size()) {
+        raise(this, "java/lang/ArrayIndexOutOfBoundsException", std::to_string(index));
+        return;
+    }
+    retain(value);
+    release(a->elements[index]);
+    a->elements[index] = value;
+}
+
+jbyteArray _JNIEnv::NewByteArray(jsize length) {
+    std::lock_guard<std::mutex> lock(heapMutex);
+    return makeLocal(this, new ByteArray(length));
+}
+
+jcharArray _JNIEnv::NewCharArray(jsize length) {
+    std::lock_guard<std::mutex> lock(heapMutex);
+    return makeLocal(this, new CharArray(length));
+}
+
+jintArray _JNIEnv::NewIntArray(jsize length) {
+    std::lock_guard<std::mutex> lock(heapMutex);
+    return makeLocal(this, new IntArray(length));
+}
+
+jlongArray _JNIEnv::NewLongArray(jsize length) {
+    std::lock_guard<std::mutex> lock(heapMutex);
+    return makeLocal(this, new LongArray(length));
+}
+
+void _JNIEnv::GetByteArrayRegion(jbyteArray array, jsize start, jsize length, jbyte* buffer) {
+    getRegion<ByteArray>(this, array, start, length, buffer);
+}
+
+void _JNIEnv::SetByteArrayRegion(jbyteArray array, jsize start, jsize length, const jbyte* buffer) {
+    setRegion<ByteArray>(this, array, start, length, buffer);
+}
+
+void _JNIEnv::GetCharArrayRegion(jcharArray array, jsize start, jsize length, jchar* buffer) {
+    getRegion<CharArray>(this, array, start, length, buffer);
+}
+
+void _JNIEnv::SetCharArrayRegion(jcharArray array, jsize start, jsize length, const jchar* buffer) {
+    setRegion<CharArray>(this, array, start, length, buffer);
+}
+
+void _JNIEnv::GetIntArrayRegion(jintArray array, jsize start, jsize length, jint* buffer) {
+    getRegion<IntArray>(this, array, start, length, buffer);
+}
+
+void _JNIEnv::SetIntArrayRegion(jintArray array, jsize start, jsize length, const jint* buffer) {
+    setRegion<IntArray>(this, array, start, length, buffer);
+}
+
+void _JNIEnv::GetLongArrayRegion(jlongArray array, jsize start, jsize length, jlong* buffer) {
+    getRegion<LongArray>(this, array, start, length, buffer);
+}
+
+void _JNIEnv::SetLongArrayRegion(jlongArray array, jsize start, jsize length, const jlong* buffer) {
+    setRegion<LongArray>(this, array, start, length, buffer);
+}
+
+void* _JNIEnv::GetPrimitiveArrayCritical(jarray array, jboolean* isCopy) {
+    if (isCopy != nullptr) {
+        *isCopy = JNI_FALSE;
+    }
+    if (auto* a = dynamic_cast<ByteArray*>(array)) return a->elements.data();
+    if (auto* a = dynamic_cast<CharArray*>(array)) return a->elements.data();
+    if (auto* a = dynamic_cast<IntArray*>(array)) return a->elements.data();
+    if (auto* a = dynamic_cast<LongArray*>(array)) return a->elements.data();
+    return nullptr;
+}
+
+void _JNIEnv::ReleasePrimitiveArrayCritical(jarray /* array */, void* /* elements */, jint /* mode */) {}
+
+// ==========================
+// JNIEnv: NIO
+// ==========================
+
+jobject _JNIEnv::NewDirectByteBuffer(void* address, jlong capacity) {
+    std::lock_guard<std::mutex> lock(heapMutex);
+    return makeLocal(this, new DirectBuffer(address, capacity));
+}
+
+void* _JNIEnv::GetDirectBufferAddress(jobject buffer) {
+    auto* direct = dynamic_cast<DirectBuffer*>(buffer);
+    return direct == nullptr ? nullptr : direct->address;
+}
+
+jlong _JNIEnv::GetDirectBufferCapacity(jobject buffer) {
+    auto* direct = dynamic_cast<DirectBuffer*>(buffer);
+    return direct == nullptr ? -1 : direct->capacity;
+}
@@ -0,0 +1,77 @@
+#ifndef NOGHRESOD_JNI_HOST_H
+#define NOGHRESOD_JNI_HOST_H
+
+#include <jni.h>
+#include <cstddef>
+#include <string>
+
+namespace noghresod {
+namespace host {
+
+/**
+ * Driver for the host JNI stand-in (host/include/jni.h).
+ *
+ * Stands in for the VM around the JNI layer: runs JNI_OnLoad, resolves
+ * natives registered through RegisterNatives so they can be called
+ * directly, serves static fields such as android.os.Build.* and releases
+ * local references the way returning to Java would.
+ */
+class JniHost {
+public:
+    static JniHost& instance();
+
+    JavaVM* vm();
+
+    /**
+     * Environment of the calling thread, attaching it on first use.
+     */
+    JNIEnv* env();
+
+    /**
+     * Run JNI_OnLoad once.
+     * @return Its result, cached for later calls
+     */
+    jint load();
+
+    /**
+     * Set a static String field, e.g. ("android/os/Build", "MODEL", "host").
+     */
+    void setStaticField(const char* className, const char* field, const char* value);
+
+    /**
+     * Function registered for [className].[method], or nullptr.
+     */
+    void* findNative(const char* className, const char* method);
+
+    template <typename Fn>
+    Fn native(const char* className, const char* method) {
+        return reinterpret_cast<Fn>(findNative(className, method));
+    }
+
+    /**
+     * Drop every local reference created on the calling thread, as if the
+     * current native call had returned to Java.
+     */
+    void releaseLocals();
+
+    /**
+     * Objects currently alive in the stand-in heap; lets tests spot leaks.
+     */
+    size_t liveObjects();
+
+    /**
+     * Modified UTF-8 contents of [string].
+     */
+    static std::string utf8(JNIEnv* env, jstring string);
+
+    JniHost(const JniHost&) = delete;
+    JniHost& operator=(const JniHost&) = delete;
+
+private:
+    JniHost();
+};
+
+} // namespace host
+} // namespace noghresod
+
+#endif // NOGHRESOD_JNI_HOST_H
@@ -0,0 +1,37 @@
+#ifndef NOGHRESOD_JNI_BINDINGS_H
+#define NOGHRESOD_JNI_BINDINGS_H
+
+#include <jni.h>
+#include <cstddef>
+
+namespace noghresod {
+
+/**
+ * Native methods of one Kotlin class, registered from JNI_OnLoad.
+ */
+struct JniClassBinding {
+    const char* className;
+    const JNINativeMethod* methods;
+    size_t methodCount;
+    // Optional one-time setup, run from JNI_OnLoad before the methods are registered
+    void (*onLoad)(JNIEnv* env);
+};
+
+// Each defined next to its implementations:
+// native-keys.cpp, native_keys.cpp, keys.cpp, native_crypto.cpp,
+// native_stats_jni.cpp, native_digits.cpp, native_price_formatter.cpp,
+// native_jalali.cpp, native_date_formatter.cpp and native_money.cpp
+extern const JniClassBinding NATIVE_KEY_MANAGER_BINDING;
+extern const JniClassBinding NATIVE_KEYS_BINDING;
+extern const JniClassBinding KEY_PROVIDER_BINDING;
+extern const JniClassBinding NATIVE_CRYPTO_BINDING;
+extern const JniClassBinding NATIVE_STATS_BINDING;
+extern const JniClassBinding NATIVE_DIGITS_BINDING;
+extern const JniClassBinding NATIVE_PRICE_FORMATTER_BINDING;
+extern const JniClassBinding NATIVE_JALALI_BINDING;
+extern const JniClassBinding NATIVE_DATE_FORMATTER_BINDING;
+extern const JniClassBinding NATIVE_MONEY_BINDING;
+
+} // namespace noghresod
+
+#endif // NOGHRESOD_JNI_BINDINGS_H
@@ -0,0 +1,74 @@
+#include <jni.h>
+#include "cpu_features.h"
+#include "jni_bindings.h"
+#include "native_trace.h"
+
+#define LOG_TAG "NoghreSod_Keys"
+#include "native_log.h"
+
+using noghresod::JniClassBinding;
+
+namespace {
+    /**
+     * Every native class served by this library.
+     * Binding through RegisterNatives keeps the Java_* symbols out of .dynsym
+     * and spares ART the dlsym lookup on each method's first call.
+     */
+    const JniClassBinding* const BINDINGS[] = {
+        &noghresod::NATIVE_KEY_MANAGER_BINDING,
+        &noghresod::NATIVE_KEYS_BINDING,
+        &noghresod::KEY_PROVIDER_BINDING,
+        &noghresod::NATIVE_CRYPTO_BINDING,
+        &noghresod::NATIVE_STATS_BINDING,
+        &noghresod::NATIVE_DIGITS_BINDING,
+        &noghresod::NATIVE_PRICE_FORMATTER_BINDING,
+        &noghresod::NATIVE_JALALI_BINDING,
+        &noghresod::NATIVE_DATE_FORMATTER_BINDING,
+        &noghresod::NATIVE_MONEY_BINDING,
+    };
+
+    bool registerBinding(JNIEnv* env, const JniClassBinding& binding) {
+        jclass clazz = env->FindClass(binding.className);
+        if (clazz == nullptr) {
+            env->ExceptionClear();
+            LOGE("Native class not found: %s", binding.className);
+            return false;
+        }
+
+        jint result = env->RegisterNatives(
+            clazz, binding.methods, static_cast<jint>(binding.methodCount));
+        env->DeleteLocalRef(clazz);
+
+        if (result != JNI_OK) {
+            env->ExceptionClear();
+            LOGE("RegisterNatives failed for %s", binding.className);
+            return false;
+        }
+        return true;
+    }
+}
+
+extern "C" JNIEXPORT jint JNICALL
+JNI_OnLoad(JavaVM* vm, void* /* reserved */) {
+    JNIEnv* env = nullptr;
+    if (vm->GetEnv(reinterpret_cast<void**>(&env), JNI_VERSION_1_6) != JNI_OK) {
+        return JNI_ERR;
+    }
+    NOGHRESOD_TRACE_SCOPE("JNI_OnLoad");
+
+    // Probe once up front so no kernel pays for it on its first call
+    char features[128];
+    noghresod::cpuFeatures().describe(features, sizeof(features));
+    LOGI("CPU features: %s", features[0] != '\0' ? features : "none");
+
+    for (const JniClassBinding* binding : BINDINGS) {
+        if (binding->onLoad != nullptr) {
+            binding->onLoad(env);
+        }
+        if (!registerBinding(env, *binding)) {
+            return JNI_ERR;
+        }
+    }
+
+    return JNI_VERSION_1_6;
+}
@@ -0,0 +1,55 @@
+#include "jstring_pool.h"
+#include "native_trace.h"
+
+#define LOG_TAG "NoghreSod_Keys"
+#include "native_log.h"
+
+namespace noghresod {
+
+JStringPool::JStringPool(const char* const* values, size_t count)
+    : values_(values), count_(count), refs_(new jstring[count]()) {}
+
+bool JStringPool::intern(JNIEnv* env) {
+    if (interned_.load(std::memory_order_acquire)) {
+        return true;
+    }
+    NOGHRESOD_TRACE_SCOPE("JStringPool.intern");
+
+    for (size_t i = 0; i < count_; i++) {
+        jstring local = env->NewStringUTF(values_[i]);
+        if (local == nullptr) {
+            env->ExceptionClear();
+            LOGE("Failed to intern native constant #%zu", i);
+            release(env);
+            return false;
+        }
+        refs_[i] = static_cast<jstring>(env->NewGlobalRef(local));
+        env->DeleteLocalRef(local);
+        if (refs_[i] == nullptr) {
+            release(env);
+            return false;
+        }
+    }
+
+    interned_.store(true, std::memory_order_release);
+    return true;
+}
+
+void JStringPool::release(JNIEnv* env) {
+    interned_.store(false, std::memory_order_release);
+    for (size_t i = 0; i < count_; i++) {
+        if (refs_[i] != nullptr) {
+            env->DeleteGlobalRef(refs_[i]);
+            refs_[i] = nullptr;
+        }
+    }
+}
+
+jstring JStringPool::get(JNIEnv* env, size_t index) const {
+    if (interned_.load(std::memory_order_acquire)) {
+        return refs_[index];
+    }
+    return env->NewStringUTF(values_[index]);
+}
+
+} // namespace noghresod
@@ -0,0 +1,56 @@
+#ifndef NOGHRESOD_JSTRING_POOL_H
+#define NOGHRESOD_JSTRING_POOL_H
+
+#include <jni.h>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace noghresod {
+
+/**
+ * Interned Java strings for native constants.
+ *
+ * intern() builds one jstring per value and pins it with NewGlobalRef,
+ * normally from JNI_OnLoad. get() then hands back the same reference on
+ * every call instead of allocating and validating a new string. Until the
+ * pool is interned (or if interning failed) get() falls back to
+ * NewStringUTF, so callers never need to care.
+ */
+class JStringPool {
+public:
+    /**
+     * @param values NUL-terminated constants; must outlive the pool
+     * @param count Number of entries in [values]
+     */
+    JStringPool(const char* const* values, size_t count);
+
+    JStringPool(const JStringPool&) = delete;
+    JStringPool& operator=(const JStringPool&) = delete;
+
+    /**
+     * Create a global reference for every value.
+     * @return false if any string could not be created; the pool stays unused
+     */
+    bool intern(JNIEnv* env);
+
+    /**
+     * Drop all global references.
+     */
+    void release(JNIEnv* env);
+
+    /**
+     * Pooled string at [index], or a fresh local string if not interned.
+     */
+    jstring get(JNIEnv* env, size_t index) const;
+
+private:
+    const char* const* values_;
+    size_t count_;
+    std::unique_ptr<jstring[]> refs_;
+    std::atomic<bool> interned_{false};
+};
+
+} // namespace noghresod
+
+#endif // NOGHRESOD_JSTRING_POOL_H
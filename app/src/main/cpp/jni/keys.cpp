@@ -0,0 +1,318 @@
+#include <jni.h>
+#include <string>
+#include <cstring>
+#include "encryption.h"
+#include "device_binding.h"
+#include "jni_bindings.h"
+#include "native_stats.h"
+#include "native_trace.h"
+#include "secret_cache.h"
+#include "secret_pipeline.h"
+#include "secure_arena.h"
+#include "utf8.h"
+
+#define LOG_TAG "NoghreSod_Keys"
+#include "native_log.h"
+
+using noghresod::DeviceInputs;
+using noghresod::DeviceKeyService;
+using noghresod::SecretCache;
+using noghresod::SecretId;
+using noghresod::SecureArena;
+using noghresod::SecureString;
+
+// ==========================
+// JNI NATIVE METHODS
+// ==========================
+
+namespace {
+
+// android.os.Build fields that make up the device fingerprint
+const char* const FINGERPRINT_FIELDS[] = {
+    "FINGERPRINT", "MANUFACTURER", "MODEL", "BOARD", "HARDWARE"
+};
+
+/**
+ * Device fingerprint read from android.os.Build.
+ */
+class BuildFieldInputs : public DeviceInputs {
+public:
+    explicit BuildFieldInputs(JNIEnv* env) : env_(env) {}
+
+    bool collect(SecureString& out) override {
+        jclass buildClass = env_->FindClass("android/os/Build");
+        if (buildClass == nullptr) {
+            env_->ExceptionClear();
+            return false;
+        }
+
+        bool ok = true;
+        for (const char* name : FINGERPRINT_FIELDS) {
+            jfieldID field = env_->GetStaticFieldID(buildClass, name, "Ljava/lang/String;");
+            if (field == nullptr) {
+                env_->ExceptionClear();
+                ok = false;
+                break;
+            }
+
+            jstring value = static_cast<jstring>(env_->GetStaticObjectField(buildClass, field));
+            if (value != nullptr) {
+                const char* chars = env_->GetStringUTFChars(value, nullptr);
+                if (chars != nullptr) {
+                    out.append(chars);
+                    env_->ReleaseStringUTFChars(value, chars);
+                }
+                env_->DeleteLocalRef(value);
+            }
+            out.push_back('\x1F');
+        }
+
+        env_->DeleteLocalRef(buildClass);
+        return ok;
+    }
+
+private:
+    JNIEnv* env_;
+};
+
+/**
+ * Decrypt [id] with the binding key of this device (the SecretCache loader).
+ */
+SecureString loadSecret(JNIEnv* env, SecretId id) {
+    BuildFieldInputs device(env);
+    switch (id) {
+        case SecretId::API_KEY:
+            return decryptApiKey(device);
+        case SecretId::API_BASE_URL:
+            return decryptApiUrl(device);
+        default:
+            return SecureString();
+    }
+}
+
+/**
+ * Resolve a secret by SecretId ordinal through the cache and hand it to [use].
+ * @return false for an unknown id or if the secret could not be decrypted
+ */
+template <typename Use>
+bool withSecretId(JNIEnv* env, jint secretId, Use&& use) {
+    if (secretId < 0 || secretId >= static_cast<jint>(SecretId::COUNT)) {
+        return false;
+    }
+    SecretId id = static_cast<SecretId>(secretId);
+    try {
+        return SecretCache::instance().withSecret(
+            id,
+            [env, id]() { return loadSecret(env, id); },
+            use);
+    } catch (const std::exception& e) {
+        LOGE("JNI error reading secret %d: %s", static_cast<int>(secretId), e.what());
+        return false;
+    }
+}
+
+/**
+ * Get API key via JNI.
+ * Decrypted once per cache epoch; later calls are served from the locked cache.
+ */
+jstring getApiKey(JNIEnv* env, jobject /* this */) {
+    NOGHRESOD_STAT_SCOPE(KEY_PROVIDER_GET_API_KEY);
+    NOGHRESOD_TRACE_SCOPE("KeyProvider.getApiKey");
+    try {
+        jstring result = nullptr;
+        bool found = SecretCache::instance().withSecret(
+            SecretId::API_KEY,
+            [env]() { return loadSecret(env, SecretId::API_KEY); },
+            [env, &result](const char* value, size_t /* length */) {
+                result = env->NewStringUTF(value);
+            });
+        
+        if (!found) {
+            LOGE("API key decryption failed");
+            return env->NewStringUTF("");
+        }
+        
+        return result;
+    } catch (const std::exception& e) {
+        LOGE("JNI error in getApiKey: %s", e.what());
+        return env->NewStringUTF("");
+    }
+}
+
+/**
+ * Get API URL via JNI.
+ * Served from the secret cache after the first decryption.
+ */
+jstring getApiBaseUrl(JNIEnv* env, jobject /* this */) {
+    NOGHRESOD_STAT_SCOPE(KEY_PROVIDER_GET_API_BASE_URL);
+    NOGHRESOD_TRACE_SCOPE("KeyProvider.getApiBaseUrl");
+    try {
+        jstring result = nullptr;
+        bool found = SecretCache::instance().withSecret(
+            SecretId::API_BASE_URL,
+            [env]() { return loadSecret(env, SecretId::API_BASE_URL); },
+            [env, &result](const char* value, size_t /* length */) {
+                result = env->NewStringUTF(value);
+            });
+        
+        if (!found) {
+            LOGE("API URL decryption failed");
+            return env->NewStringUTF("");
+        }
+        
+        return result;
+    } catch (const std::exception& e) {
+        LOGE("JNI error in getApiBaseUrl: %s", e.what());
+        return env->NewStringUTF("");
+    }
+}
+
+/**
+ * Get Stripe key via JNI
+ */
+jstring getStripeKey(JNIEnv* env, jobject /* this */) {
+    NOGHRESOD_STAT_SCOPE(KEY_PROVIDER_GET_STRIPE_KEY);
+    // Similar to API key - encrypted and device-bound
+    // Implementation similar to decryptApiKey()
+    return env->NewStringUTF("");  // Implement as needed
+}
+
+/**
+ * Get certificate pins via JNI
+ */
+jstring getCertificatePins(JNIEnv* env, jobject /* this */) {
+    NOGHRESOD_STAT_SCOPE(KEY_PROVIDER_GET_CERTIFICATE_PINS);
+    // Return certificate pins as JSON
+    // Also encrypted and device-bound
+    return env->NewStringUTF("");  // Implement as needed
+}
+
+/**
+ * Decrypt a secret into the cache without handing it to Java.
+ * Called by the start-up warm-up (NativeWarmUp.kt) off the main thread.
+ *
+ * @param secretId SecretId ordinal
+ * @return false if the secret could not be decrypted
+ */
+jboolean prefetch(JNIEnv* env, jobject /* this */, jint secretId) {
+    NOGHRESOD_STAT_SCOPE(KEY_PROVIDER_PREFETCH);
+    NOGHRESOD_TRACE_SCOPE("KeyProvider.prefetch");
+    bool found = withSecretId(env, secretId, [](const char* /* value */, size_t /* length */) {});
+    return found ? JNI_TRUE : JNI_FALSE;
+}
+
+/**
+ * Copy a secret as UTF-8 into a direct ByteBuffer, without a Java String.
+ *
+ * @param secretId SecretId ordinal
+ * @param offset Absolute index in [buffer] to write at
+ * @param capacity Bytes available from [offset]
+ * @return Secret length in bytes; nothing is written if it exceeds
+ *         [capacity]. -1 if the secret or the buffer is unavailable.
+ */
+jint readSecretBytes(JNIEnv* env, jobject /* this */, jint secretId,
+                     jobject buffer, jint offset, jint capacity) {
+    NOGHRESOD_STAT_SCOPE(KEY_PROVIDER_READ_SECRET_BYTES);
+    if (buffer == nullptr || offset < 0 || capacity < 0) {
+        return -1;
+    }
+    uint8_t* address = static_cast<uint8_t*>(env->GetDirectBufferAddress(buffer));
+    if (address == nullptr || static_cast<jlong>(offset) + capacity > env->GetDirectBufferCapacity(buffer)) {
+        return -1;
+    }
+
+    jint result = -1;
+    withSecretId(env, secretId, [&](const char* value, size_t length) {
+        result = static_cast<jint>(length);
+        if (length <= static_cast<size_t>(capacity)) {
+            std::memcpy(address + offset, value, length);
+        }
+    });
+    return result;
+}
+
+/**
+ * Copy a secret as UTF-16 into a char[], without a Java String.
+ *
+ * Converted through a small stack buffer that is wiped afterwards, so the
+ * only copy left behind is the caller's array.
+ *
+ * @param secretId SecretId ordinal
+ * @param offset Index in [chars] to write at
+ * @return Secret length in chars; nothing is written if it does not fit.
+ *         -1 if the secret or the array is unavailable.
+ */
+jint readSecretChars(JNIEnv* env, jobject /* this */, jint secretId, jcharArray chars, jint offset) {
+    NOGHRESOD_STAT_SCOPE(KEY_PROVIDER_READ_SECRET_CHARS);
+    if (chars == nullptr) {
+        return -1;
+    }
+    jsize arrayLength = env->GetArrayLength(chars);
+    if (offset < 0 || offset > arrayLength) {
+        return -1;
+    }
+
+    jint result = -1;
+    withSecretId(env, secretId, [&](const char* value, size_t length) {
+        const char* end = value + length;
+        size_t units = noghresod::utf8::utf16Length(value, length);
+        result = static_cast<jint>(units);
+        if (units > static_cast<size_t>(arrayLength - offset)) {
+            return;
+        }
+
+        // Room for a surrogate pair is kept at the end of every chunk
+        jchar chunk[128];
+        size_t filled = 0;
+        jsize position = offset;
+        for (const char* p = value; p < end;) {
+            filled += noghresod::utf8::encode(noghresod::utf8::next(p, end), chunk + filled);
+            if (filled >= sizeof(chunk) / sizeof(chunk[0]) - 1 || p == end) {
+                env->SetCharArrayRegion(chars, position, static_cast<jsize>(filled), chunk);
+                position += static_cast<jsize>(filled);
+                filled = 0;
+            }
+        }
+        noghresod::secureWipe(chunk, sizeof(chunk));
+    });
+    return result;
+}
+
+/**
+ * Clear sensitive data from memory
+ */
+void clearSensitiveData(JNIEnv* env, jobject /* this */) {
+    NOGHRESOD_STAT_SCOPE(KEY_PROVIDER_CLEAR_SENSITIVE_DATA);
+    NOGHRESOD_TRACE_SCOPE("KeyProvider.clearSensitiveData");
+    // Wipe every cached plaintext; the next lookup decrypts again
+    SecretCache::instance().clear();
+    clearCipherCache();
+    SecureArena::instance().wipe();
+    
+    // Off the hot path: re-derive the binding key only if the device changed
+    BuildFieldInputs device(env);
+    DeviceKeyService::instance().revalidate(device);
+    LOGD("Sensitive data cleared from memory");
+}
+
+const JNINativeMethod METHODS[] = {
+    {"getApiKey", "()Ljava/lang/String;", reinterpret_cast<void*>(getApiKey)},
+    {"getApiBaseUrl", "()Ljava/lang/String;", reinterpret_cast<void*>(getApiBaseUrl)},
+    {"getStripeKey", "()Ljava/lang/String;", reinterpret_cast<void*>(getStripeKey)},
+    {"getCertificatePins", "()Ljava/lang/String;", reinterpret_cast<void*>(getCertificatePins)},
+    {"clearSensitiveData", "()V", reinterpret_cast<void*>(clearSensitiveData)},
+    {"nativePrefetch", "(I)Z", reinterpret_cast<void*>(prefetch)},
+    {"nativeReadSecretBytes", "(ILjava/nio/ByteBuffer;II)I", reinterpret_cast<void*>(readSecretBytes)},
+    {"nativeReadSecretChars", "(I[CI)I", reinterpret_cast<void*>(readSecretChars)},
+};
+
+} // namespace
+
+namespace noghresod {
+    extern const JniClassBinding KEY_PROVIDER_BINDING = {
+        "com/noghre/sod/core/security/KeyProvider",
+        METHODS,
+        sizeof(METHODS) / sizeof(METHODS[0]),
+        nullptr
+    };
+}
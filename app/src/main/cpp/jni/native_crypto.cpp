@@ -0,0 +1,145 @@
+#include <jni.h>
+#include <cstdint>
+#include "jni_bindings.h"
+#include "local_crypto.h"
+#include "native_stats.h"
+
+// ==========================
+// JNI NATIVE METHODS
+// ==========================
+
+using noghresod::GcmStream;
+using noghresod::LocalDataCipher;
+
+namespace {
+
+/**
+ * Address of [length] bytes at [offset] inside a direct buffer, or nullptr
+ * if the buffer is not direct or too small.
+ */
+uint8_t* directRange(JNIEnv* env, jobject buffer, jint offset, jlong length) {
+    if (buffer == nullptr || offset < 0 || length < 0) {
+        return nullptr;
+    }
+    uint8_t* address = static_cast<uint8_t*>(env->GetDirectBufferAddress(buffer));
+    jlong capacity = env->GetDirectBufferCapacity(buffer);
+    if (address == nullptr || capacity < 0 || offset + length > capacity) {
+        return nullptr;
+    }
+    return address + offset;
+}
+
+GcmStream* streamFrom(jlong handle) {
+    return reinterpret_cast<GcmStream*>(static_cast<intptr_t>(handle));
+}
+
+/**
+ * Start an encryption stream; writes the container header into [header].
+ * @return Stream handle, or 0 on failure
+ */
+jlong beginEncrypt(JNIEnv* env, jobject /* this */, jobject header, jint offset) {
+    NOGHRESOD_STAT_SCOPE(NATIVE_CRYPTO_BEGIN_ENCRYPT);
+    uint8_t* out = directRange(env, header, offset, LocalDataCipher::HEADER_SIZE);
+    if (out == nullptr) {
+        return 0;
+    }
+    return reinterpret_cast<intptr_t>(LocalDataCipher::instance().beginEncrypt(out));
+}
+
+/**
+ * Start a decryption stream from a container header.
+ * @return Stream handle, or 0 if the header is invalid
+ */
+jlong beginDecrypt(JNIEnv* env, jobject /* this */, jobject header, jint offset) {
+    NOGHRESOD_STAT_SCOPE(NATIVE_CRYPTO_BEGIN_DECRYPT);
+    const uint8_t* in = directRange(env, header, offset, LocalDataCipher::HEADER_SIZE);
+    if (in == nullptr) {
+        return 0;
+    }
+    return reinterpret_cast<intptr_t>(LocalDataCipher::instance().beginDecrypt(in));
+}
+
+/**
+ * Process [length] bytes between two direct buffers (may be the same one).
+ * @return Bytes written, or -1 on invalid arguments
+ */
+jint update(JNIEnv* env, jobject /* this */, jlong handle,
+            jobject input, jint inOffset, jint length,
+            jobject output, jint outOffset) {
+    NOGHRESOD_STAT_SCOPE(NATIVE_CRYPTO_UPDATE);
+    GcmStream* stream = streamFrom(handle);
+    const uint8_t* in = directRange(env, input, inOffset, length);
+    uint8_t* out = directRange(env, output, outOffset, length);
+    if (stream == nullptr || in == nullptr || out == nullptr) {
+        return -1;
+    }
+    stream->update(in, static_cast<size_t>(length), out);
+    return length;
+}
+
+/**
+ * Write the tag of an encryption stream into [tag].
+ */
+jboolean finishEncrypt(JNIEnv* env, jobject /* this */, jlong handle, jobject tag, jint offset) {
+    NOGHRESOD_STAT_SCOPE(NATIVE_CRYPTO_FINISH_ENCRYPT);
+    GcmStream* stream = streamFrom(handle);
+    uint8_t* out = directRange(env, tag, offset, LocalDataCipher::TAG_SIZE);
+    if (stream == nullptr || out == nullptr) {
+        return JNI_FALSE;
+    }
+    stream->finish(out);
+    return JNI_TRUE;
+}
+
+/**
+ * Check the tag of a decryption stream.
+ * @return false if the data was tampered with or truncated
+ */
+jboolean finishDecrypt(JNIEnv* env, jobject /* this */, jlong handle, jobject tag, jint offset) {
+    NOGHRESOD_STAT_SCOPE(NATIVE_CRYPTO_FINISH_DECRYPT);
+    GcmStream* stream = streamFrom(handle);
+    const uint8_t* in = directRange(env, tag, offset, LocalDataCipher::TAG_SIZE);
+    if (stream == nullptr || in == nullptr) {
+        return JNI_FALSE;
+    }
+    return stream->verify(in) ? JNI_TRUE : JNI_FALSE;
+}
+
+/**
+ * Free a stream handle and wipe its state.
+ */
+void release(JNIEnv* /* env */, jobject /* this */, jlong handle) {
+    delete streamFrom(handle);
+}
+
+jboolean encryptFd(JNIEnv* /* env */, jobject /* this */, jint inFd, jint outFd) {
+    NOGHRESOD_STAT_SCOPE(NATIVE_CRYPTO_ENCRYPT_FD);
+    return LocalDataCipher::instance().encryptFd(inFd, outFd) ? JNI_TRUE : JNI_FALSE;
+}
+
+jboolean decryptFd(JNIEnv* /* env */, jobject /* this */, jint inFd, jint outFd) {
+    NOGHRESOD_STAT_SCOPE(NATIVE_CRYPTO_DECRYPT_FD);
+    return LocalDataCipher::instance().decryptFd(inFd, outFd) ? JNI_TRUE : JNI_FALSE;
+}
+
+const JNINativeMethod METHODS[] = {
+    {"nativeBeginEncrypt", "(Ljava/nio/ByteBuffer;I)J", reinterpret_cast<void*>(beginEncrypt)},
+    {"nativeBeginDecrypt", "(Ljava/nio/ByteBuffer;I)J", reinterpret_cast<void*>(beginDecrypt)},
+    {"nativeUpdate", "(JLjava/nio/ByteBuffer;IILjava/nio/ByteBuffer;I)I", reinterpret_cast<void*>(update)},
+    {"nativeFinishEncrypt", "(JLjava/nio/ByteBuffer;I)Z", reinterpret_cast<void*>(finishEncrypt)},
+    {"nativeFinishDecrypt", "(JLjava/nio/ByteBuffer;I)Z", reinterpret_cast<void*>(finishDecrypt)},
+    {"nativeRelease", "(J)V", reinterpret_cast<void*>(release)},
+    {"nativeEncryptFd", "(II)Z", reinterpret_cast<void*>(encryptFd)},
+    {"nativeDecryptFd", "(II)Z", reinterpret_cast<void*>(decryptFd)},
+};
+
+} // namespace
+
+namespace noghresod {
+    extern const JniClassBinding NATIVE_CRYPTO_BINDING = {
+        "com/noghre/sod/core/security/NativeCrypto",
+        METHODS,
+        sizeof(METHODS) / sizeof(METHODS[0]),
+        nullptr
+    };
+}
@@ -0,0 +1,154 @@
+#include <jni.h>
+#include <cstdint>
+#include <type_traits>
+#include "jalali_format.h"
+#include "jni_bindings.h"
+#include "native_stats.h"
+#include "native_trace.h"
+
+using noghresod::jalali::DatePattern;
+using noghresod::jalali::MAX_DATE_PATTERN;
+using noghresod::jalali::MAX_FORMATTED_DATE;
+
+namespace {
+
+// NativeDateFormatter.COMPILED_PATTERN_BYTES: the direct buffer a Pattern keeps its compiled form in
+const jlong COMPILED_PATTERN_BYTES = 512;
+static_assert(sizeof(DatePattern) <= COMPILED_PATTERN_BYTES, "DatePattern outgrew its buffer");
+static_assert(std::is_trivially_copyable<DatePattern>::value, "DatePattern must live in raw memory");
+
+/**
+ * The DatePattern held in [buffer], or nullptr if it is not a direct buffer
+ * large and aligned enough for one.
+ */
+DatePattern* patternIn(JNIEnv* env, jobject buffer) {
+    if (buffer == nullptr || env->GetDirectBufferCapacity(buffer) < COMPILED_PATTERN_BYTES) {
+        return nullptr;
+    }
+    void* address = env->GetDirectBufferAddress(buffer);
+    if (address == nullptr || reinterpret_cast<uintptr_t>(address) % alignof(DatePattern) != 0) {
+        return nullptr;
+    }
+    return static_cast<DatePattern*>(address);
+}
+
+/**
+ * Compile [pattern] once into [compiled], a direct buffer the Kotlin
+ * Pattern keeps; format() and formatAll() then read it without parsing.
+ * @return false on an overlong or invalid pattern, or an unusable buffer
+ */
+jboolean compile(JNIEnv* env, jobject /* this */, jcharArray pattern, jobject compiled) {
+    NOGHRESOD_STAT_SCOPE(NATIVE_DATE_FORMATTER_COMPILE);
+    DatePattern* out = patternIn(env, compiled);
+    if (pattern == nullptr || out == nullptr) {
+        return JNI_FALSE;
+    }
+    jsize length = env->GetArrayLength(pattern);
+    if (length > static_cast<jsize>(MAX_DATE_PATTERN)) {
+        return JNI_FALSE;
+    }
+    jchar units[MAX_DATE_PATTERN];
+    env->GetCharArrayRegion(pattern, 0, length, units);
+    return noghresod::jalali::compileDatePattern(reinterpret_cast<const uint16_t*>(units),
+                                                 static_cast<size_t>(length), out)
+        ? JNI_TRUE : JNI_FALSE;
+}
+
+/**
+ * The pattern compile() wrote into [compiled], or nullptr.
+ */
+const DatePattern* compiledPattern(JNIEnv* env, jobject compiled) {
+    const DatePattern* pattern = patternIn(env, compiled);
+    return pattern != nullptr && pattern->tokenCount <= MAX_DATE_PATTERN ? pattern : nullptr;
+}
+
+/**
+ * Format one instant into chars[offset...].
+ * @param compiled Pattern compiled by compile()
+ * @param flags DateFormatFlags
+ * @return Chars written, or -1 on an uncompiled pattern, an instant outside
+ *         the year table, or no room for the pattern's longest output
+ */
+jint format(JNIEnv* env, jobject /* this */, jlong millis, jlong offsetMillis,
+            jobject compiled, jint flags, jcharArray chars, jint offset) {
+    NOGHRESOD_STAT_SCOPE(NATIVE_DATE_FORMATTER_FORMAT);
+    const DatePattern* pattern = compiledPattern(env, compiled);
+    if (pattern == nullptr || chars == nullptr || offset < 0 ||
+        env->GetArrayLength(chars) - offset < static_cast<jint>(pattern->maxLength)) {
+        return -1;
+    }
+    jchar formatted[MAX_FORMATTED_DATE];
+    int32_t end;
+    const int64_t instant = static_cast<int64_t>(millis);
+    if (noghresod::jalali::formatDates(&instant, 1, static_cast<int64_t>(offsetMillis), *pattern,
+                                       static_cast<uint32_t>(flags),
+                                       reinterpret_cast<uint16_t*>(formatted),
+                                       MAX_FORMATTED_DATE, &end) != 1) {
+        return -1;
+    }
+    env->SetCharArrayRegion(chars, offset, end, formatted);
+    return end;
+}
+
+/**
+ * Format every instant back to back into [chars]; instant i ends at ends[i].
+ * One call and no allocation for a whole order timeline.
+ * @return Instants formatted (see formatDates()), or -1 on invalid arguments
+ */
+jint formatAll(JNIEnv* env, jobject /* this */, jlongArray millis, jlong offsetMillis,
+               jobject compiled, jint flags, jcharArray chars, jintArray ends) {
+    NOGHRESOD_STAT_SCOPE(NATIVE_DATE_FORMATTER_FORMAT_ALL);
+    NOGHRESOD_TRACE_SCOPE("NativeDateFormatter.formatAll");
+    const DatePattern* pattern = compiledPattern(env, compiled);
+    if (millis == nullptr || chars == nullptr || ends == nullptr || pattern == nullptr) {
+        return -1;
+    }
+    jsize count = env->GetArrayLength(millis);
+    jsize capacity = env->GetArrayLength(chars);
+    if (env->GetArrayLength(ends) < count) {
+        return -1;
+    }
+    if (count == 0) {
+        return 0;
+    }
+
+    // No JNI calls until the three arrays are released
+    auto* in = static_cast<jlong*>(env->GetPrimitiveArrayCritical(millis, nullptr));
+    auto* out = static_cast<jchar*>(env->GetPrimitiveArrayCritical(chars, nullptr));
+    auto* outEnds = static_cast<jint*>(env->GetPrimitiveArrayCritical(ends, nullptr));
+    jint formatted = -1;
+    if (in != nullptr && out != nullptr && outEnds != nullptr) {
+        formatted = static_cast<jint>(noghresod::jalali::formatDates(
+            reinterpret_cast<const int64_t*>(in), static_cast<size_t>(count),
+            static_cast<int64_t>(offsetMillis), *pattern, static_cast<uint32_t>(flags),
+            reinterpret_cast<uint16_t*>(out), static_cast<size_t>(capacity),
+            reinterpret_cast<int32_t*>(outEnds)));
+    }
+    if (outEnds != nullptr) {
+        env->ReleasePrimitiveArrayCritical(ends, outEnds, 0);
+    }
+    if (out != nullptr) {
+        env->ReleasePrimitiveArrayCritical(chars, out, 0);
+    }
+    if (in != nullptr) {
+        env->ReleasePrimitiveArrayCritical(millis, in, JNI_ABORT);
+    }
+    return formatted;
+}
+
+const JNINativeMethod METHODS[] = {
+    {"nativeCompile", "([CLjava/nio/ByteBuffer;)Z", reinterpret_cast<void*>(compile)},
+    {"nativeFormat", "(JJLjava/nio/ByteBuffer;I[CI)I", reinterpret_cast<void*>(format)},
+    {"nativeFormatAll", "([JJLjava/nio/ByteBuffer;I[C[I)I", reinterpret_cast<void*>(formatAll)},
+};
+
+} // namespace
+
+namespace noghresod {
+    extern const JniClassBinding NATIVE_DATE_FORMATTER_BINDING = {
+        "com/noghre/sod/core/util/NativeDateFormatter",
+        METHODS,
+        sizeof(METHODS) / sizeof(METHODS[0]),
+        nullptr
+    };
+}
@@ -0,0 +1,62 @@
+#include <jni.h>
+#include <cstdint>
+#include "digit_transcoder.h"
+#include "jni_bindings.h"
+#include "native_stats.h"
+#include "native_trace.h"
+
+using noghresod::DigitScript;
+
+namespace {
+
+/**
+ * Rewrite the digits of chars[offset, offset + length) as [target] in place.
+ *
+ * Batches arrive as one concatenated array, so thousands of strings cost a
+ * single call and a single pinned pass over their characters.
+ *
+ * @param target DigitScript value (NativeDigits.Script ordinal)
+ * @return Whether any character changed; false on invalid arguments
+ */
+jboolean transcode(JNIEnv* env, jobject /* this */, jcharArray chars,
+                   jint offset, jint length, jint target) {
+    NOGHRESOD_STAT_SCOPE(NATIVE_DIGITS_TRANSCODE);
+    NOGHRESOD_TRACE_SCOPE("NativeDigits.transcode");
+    if (chars == nullptr || target < 0 ||
+        target >= static_cast<jint>(noghresod::DIGIT_SCRIPT_COUNT)) {
+        return JNI_FALSE;
+    }
+    jsize arrayLength = env->GetArrayLength(chars);
+    if (offset < 0 || length < 0 || offset > arrayLength - length) {
+        return JNI_FALSE;
+    }
+    if (length == 0) {
+        return JNI_FALSE;
+    }
+
+    auto* elements = static_cast<jchar*>(env->GetPrimitiveArrayCritical(chars, nullptr));
+    if (elements == nullptr) {
+        return JNI_FALSE;
+    }
+    bool changed = noghresod::transcodeDigits(
+        reinterpret_cast<uint16_t*>(elements + offset), static_cast<size_t>(length),
+        static_cast<DigitScript>(target));
+    // Nothing to copy back into a copied array when no digit moved
+    env->ReleasePrimitiveArrayCritical(chars, elements, changed ? 0 : JNI_ABORT);
+    return changed ? JNI_TRUE : JNI_FALSE;
+}
+
+const JNINativeMethod METHODS[] = {
+    {"nativeTranscode", "([CIII)Z", reinterpret_cast<void*>(transcode)},
+};
+
+} // namespace
+
+namespace noghresod {
+    extern const JniClassBinding NATIVE_DIGITS_BINDING = {
+        "com/noghre/sod/core/util/NativeDigits",
+        METHODS,
+        sizeof(METHODS) / sizeof(METHODS[0]),
+        nullptr
+    };
+}
@@ -0,0 +1,83 @@
+#include <jni.h>
+#include <cstdint>
+#include "jalali.h"
+#include "jni_bindings.h"
+#include "native_stats.h"
+#include "native_trace.h"
+
+namespace {
+
+/**
+ * @return Packed Jalali date (jalali.h), or 0 outside the table
+ */
+jint fromEpochDay(JNIEnv* /* env */, jobject /* this */, jlong epochDay) {
+    NOGHRESOD_STAT_SCOPE(NATIVE_JALALI_FROM_EPOCH_DAY);
+    return static_cast<jint>(noghresod::jalali::fromEpochDay(static_cast<int64_t>(epochDay)));
+}
+
+/**
+ * @return Epoch day, or Long.MIN_VALUE for dates outside the table
+ */
+jlong toEpochDay(JNIEnv* /* env */, jobject /* this */, jint year, jint month, jint day) {
+    NOGHRESOD_STAT_SCOPE(NATIVE_JALALI_TO_EPOCH_DAY);
+    int64_t epochDay;
+    if (!noghresod::jalali::toEpochDay(year, month, day, &epochDay)) {
+        return INT64_MIN;
+    }
+    return static_cast<jlong>(epochDay);
+}
+
+/**
+ * Convert every instant of [millis] into out[i] in one pass.
+ * @param offsetMillis The zone's UTC offset, shared by the whole batch
+ * @return Instants converted, or -1 on invalid arguments
+ */
+jint fromEpochMillisAll(JNIEnv* env, jobject /* this */, jlongArray millis,
+                        jlong offsetMillis, jintArray out) {
+    NOGHRESOD_STAT_SCOPE(NATIVE_JALALI_FROM_EPOCH_MILLIS_ALL);
+    NOGHRESOD_TRACE_SCOPE("NativeJalali.fromEpochMillisAll");
+    if (millis == nullptr || out == nullptr) {
+        return -1;
+    }
+    jsize count = env->GetArrayLength(millis);
+    if (env->GetArrayLength(out) < count) {
+        return -1;
+    }
+    if (count == 0) {
+        return 0;
+    }
+
+    auto* in = static_cast<jlong*>(env->GetPrimitiveArrayCritical(millis, nullptr));
+    auto* packed = static_cast<jint*>(env->GetPrimitiveArrayCritical(out, nullptr));
+    jint converted = -1;
+    if (in != nullptr && packed != nullptr) {
+        noghresod::jalali::fromEpochMillis(reinterpret_cast<const int64_t*>(in), static_cast<size_t>(count),
+                                           static_cast<int64_t>(offsetMillis),
+                                           reinterpret_cast<uint32_t*>(packed));
+        converted = count;
+    }
+    if (packed != nullptr) {
+        env->ReleasePrimitiveArrayCritical(out, packed, 0);
+    }
+    if (in != nullptr) {
+        env->ReleasePrimitiveArrayCritical(millis, in, JNI_ABORT);
+    }
+    return converted;
+}
+
+const JNINativeMethod METHODS[] = {
+    {"nativeFromEpochDay", "(J)I", reinterpret_cast<void*>(fromEpochDay)},
+    {"nativeToEpochDay", "(III)J", reinterpret_cast<void*>(toEpochDay)},
+    {"nativeFromEpochMillisAll", "([JJ[I)I", reinterpret_cast<void*>(fromEpochMillisAll)},
+};
+
+} // namespace
+
+namespace noghresod {
+    extern const JniClassBinding NATIVE_JALALI_BINDING = {
+        "com/noghre/sod/core/util/NativeJalali",
+        METHODS,
+        sizeof(METHODS) / sizeof(METHODS[0]),
+        nullptr
+    };
+}
@@ -0,0 +1,187 @@
+#include <jni.h>
+#include <cstdint>
+#include <vector>
+#include "jni_bindings.h"
+#include "jstring_pool.h"
+#include "native_stats.h"
+#include "network_config.h"
+
+// ============================================
+// 🔐 Native Keys Management (C++)
+// JNI layer over src/network_config.h
+// ============================================
+
+using namespace noghresod::network_config;
+using noghresod::networkConfigBundle;
+
+namespace {
+    // Index into CONSTANT_STRINGS / the interned pool
+    enum ConstantString : size_t {
+        STR_API_URL = 0,
+        STR_CERTIFICATE_PIN_SHA,
+        STR_BACKUP_CERTIFICATE_PIN,
+        STR_PAYMENT_GATEWAY_KEY,
+        STR_FIREBASE_KEY,
+        STR_COUNT
+    };
+
+    const char* const CONSTANT_STRINGS[STR_COUNT] = {
+        API_URL,
+        CERTIFICATE_PIN_SHA,
+        BACKUP_CERTIFICATE_PIN,
+        PAYMENT_GATEWAY_KEY,
+        FIREBASE_KEY
+    };
+
+    /**
+     * Global-ref jstrings for the constants above, interned in JNI_OnLoad.
+     */
+    noghresod::JStringPool& constantPool() {
+        static noghresod::JStringPool pool(CONSTANT_STRINGS, STR_COUNT);
+        return pool;
+    }
+}
+
+namespace {
+
+/**
+ * Get API Base URL from native code
+ * @return API endpoint URL
+ * NOTE: Replace with your actual backend URL
+ */
+jstring getApiUrl(JNIEnv *env, jobject /* this */) {
+    NOGHRESOD_STAT_SCOPE(NATIVE_KEYS_GET_API_URL);
+    return constantPool().get(env, STR_API_URL);
+}
+
+/**
+ * Get Certificate Pinning SHA256 hashes
+ * @return SHA256 hash for pinning
+ */
+jstring getCertificatePinSha(JNIEnv *env, jobject /* this */) {
+    NOGHRESOD_STAT_SCOPE(NATIVE_KEYS_GET_CERTIFICATE_PIN_SHA);
+    return constantPool().get(env, STR_CERTIFICATE_PIN_SHA);
+}
+
+/**
+ * Get backup Certificate for pinning
+ * @return Backup SHA256 hash
+ */
+jstring getBackupCertificatePin(JNIEnv *env, jobject /* this */) {
+    NOGHRESOD_STAT_SCOPE(NATIVE_KEYS_GET_BACKUP_CERTIFICATE_PIN);
+    return constantPool().get(env, STR_BACKUP_CERTIFICATE_PIN);
+}
+
+/**
+ * Get both certificate pins
+ * @return Primary and backup SHA256 hashes, in that order
+ */
+jobjectArray getCertificatePins(JNIEnv *env, jobject /* this */) {
+    NOGHRESOD_STAT_SCOPE(NATIVE_KEYS_GET_CERTIFICATE_PINS);
+    jclass stringClass = env->FindClass("java/lang/String");
+    if (stringClass == nullptr) {
+        return nullptr;
+    }
+    jobjectArray pins = env->NewObjectArray(2, stringClass, nullptr);
+    env->DeleteLocalRef(stringClass);
+    if (pins == nullptr) {
+        return nullptr;
+    }
+
+    const ConstantString entries[] = { STR_CERTIFICATE_PIN_SHA, STR_BACKUP_CERTIFICATE_PIN };
+    for (jsize i = 0; i < 2; i++) {
+        env->SetObjectArrayElement(pins, i, constantPool().get(env, entries[i]));
+    }
+    return pins;
+}
+
+/**
+ * Get ZarinPal Merchant ID for payment processing
+ * @return Merchant ID from ZarinPal dashboard
+ * NOTE: Replace with actual credentials before production
+ */
+jstring getPaymentGatewayKey(JNIEnv *env, jobject /* this */) {
+    NOGHRESOD_STAT_SCOPE(NATIVE_KEYS_GET_PAYMENT_GATEWAY_KEY);
+    return constantPool().get(env, STR_PAYMENT_GATEWAY_KEY);
+}
+
+/**
+ * Get Firebase Project ID
+ * @return Firebase project ID
+ * NOTE: Replace with actual credentials before production
+ */
+jstring getFirebaseKey(JNIEnv *env, jobject /* this */) {
+    NOGHRESOD_STAT_SCOPE(NATIVE_KEYS_GET_FIREBASE_KEY);
+    return constantPool().get(env, STR_FIREBASE_KEY);
+}
+
+/**
+ * Get API timeout duration
+ * @return Timeout in seconds
+ */
+jint getApiTimeout(JNIEnv * /* env */, jobject /* this */) {
+    NOGHRESOD_STAT_SCOPE(NATIVE_KEYS_GET_API_TIMEOUT);
+    return API_TIMEOUT_SECONDS;
+}
+
+/**
+ * Get maximum retry attempts
+ * @return Number of retries
+ */
+jint getMaxRetries(JNIEnv * /* env */, jobject /* this */) {
+    NOGHRESOD_STAT_SCOPE(NATIVE_KEYS_GET_MAX_RETRIES);
+    return MAX_RETRIES;
+}
+
+/**
+ * Get initial retry delay
+ * @return Delay in milliseconds
+ */
+jint getRetryDelay(JNIEnv * /* env */, jobject /* this */) {
+    NOGHRESOD_STAT_SCOPE(NATIVE_KEYS_GET_RETRY_DELAY);
+    return RETRY_DELAY_MS;
+}
+
+/**
+ * Get every network setting in one call.
+ * Replaces nine separate getter transitions during network setup.
+ * @return Direct ByteBuffer over the packed bundle (layout in network_config.h).
+ *         The memory is shared, so the Kotlin external is private to
+ *         NativeKeys and only read through a read-only view.
+ */
+jobject getNetworkConfigBundle(JNIEnv *env, jobject /* this */) {
+    NOGHRESOD_STAT_SCOPE(NATIVE_KEYS_GET_NETWORK_CONFIG_BUNDLE);
+    const std::vector<uint8_t>& bundle = networkConfigBundle();
+    return env->NewDirectByteBuffer(
+        const_cast<uint8_t*>(bundle.data()),
+        static_cast<jlong>(bundle.size())
+    );
+}
+
+const JNINativeMethod METHODS[] = {
+    {"getApiUrl", "()Ljava/lang/String;", reinterpret_cast<void*>(getApiUrl)},
+    {"getCertificatePinSha", "()Ljava/lang/String;", reinterpret_cast<void*>(getCertificatePinSha)},
+    {"getBackupCertificatePin", "()Ljava/lang/String;", reinterpret_cast<void*>(getBackupCertificatePin)},
+    {"getCertificatePins", "()[Ljava/lang/String;", reinterpret_cast<void*>(getCertificatePins)},
+    {"getPaymentGatewayKey", "()Ljava/lang/String;", reinterpret_cast<void*>(getPaymentGatewayKey)},
+    {"getFirebaseKey", "()Ljava/lang/String;", reinterpret_cast<void*>(getFirebaseKey)},
+    {"getApiTimeout", "()I", reinterpret_cast<void*>(getApiTimeout)},
+    {"getMaxRetries", "()I", reinterpret_cast<void*>(getMaxRetries)},
+    {"getRetryDelay", "()I", reinterpret_cast<void*>(getRetryDelay)},
+    {"getNetworkConfigBundle", "()Ljava/nio/ByteBuffer;", reinterpret_cast<void*>(getNetworkConfigBundle)},
+};
+
+void onLoad(JNIEnv *env) {
+    constantPool().intern(env);
+}
+
+} // namespace
+
+namespace noghresod {
+    extern const JniClassBinding NATIVE_KEYS_BINDING = {
+        "com/noghre/sod/core/security/NativeKeys",
+        METHODS,
+        sizeof(METHODS) / sizeof(METHODS[0]),
+        onLoad
+    };
+}
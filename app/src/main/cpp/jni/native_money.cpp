@@ -0,0 +1,81 @@
+#include <jni.h>
+#include <cstdint>
+#include "jni_bindings.h"
+#include "money.h"
+#include "native_stats.h"
+#include "native_trace.h"
+
+using noghresod::money::ROUNDING_MODE_COUNT;
+using noghresod::money::RoundingMode;
+
+namespace {
+
+/**
+ * Reprice every product at [pricePerGram] into totals[i] in one pass.
+ * @param discountBps Per product, or null for no discounts
+ * @param rounding NativeMoney.Rounding ordinal
+ * @return Products priced (see priceProducts()), or -1 on invalid arguments
+ */
+jint priceAll(JNIEnv* env, jobject /* this */, jlongArray weightMg, jlongArray wage,
+              jintArray discountBps, jlong pricePerGram, jint taxBps, jint rounding,
+              jlongArray totals) {
+    NOGHRESOD_STAT_SCOPE(NATIVE_MONEY_PRICE_ALL);
+    NOGHRESOD_TRACE_SCOPE("NativeMoney.priceAll");
+    if (weightMg == nullptr || wage == nullptr || totals == nullptr ||
+        rounding < 0 || rounding >= static_cast<jint>(ROUNDING_MODE_COUNT)) {
+        return -1;
+    }
+    jsize count = env->GetArrayLength(weightMg);
+    if (env->GetArrayLength(wage) < count || env->GetArrayLength(totals) < count ||
+        (discountBps != nullptr && env->GetArrayLength(discountBps) < count)) {
+        return -1;
+    }
+    if (count == 0) {
+        return 0;
+    }
+
+    // No JNI calls until the arrays are released
+    auto* weights = static_cast<jlong*>(env->GetPrimitiveArrayCritical(weightMg, nullptr));
+    auto* wages = static_cast<jlong*>(env->GetPrimitiveArrayCritical(wage, nullptr));
+    auto* discounts = discountBps != nullptr
+        ? static_cast<jint*>(env->GetPrimitiveArrayCritical(discountBps, nullptr))
+        : nullptr;
+    auto* out = static_cast<jlong*>(env->GetPrimitiveArrayCritical(totals, nullptr));
+    jint priced = -1;
+    if (weights != nullptr && wages != nullptr && out != nullptr &&
+        (discountBps == nullptr || discounts != nullptr)) {
+        priced = static_cast<jint>(noghresod::money::priceProducts(
+            reinterpret_cast<const int64_t*>(weights), reinterpret_cast<const int64_t*>(wages),
+            reinterpret_cast<const int32_t*>(discounts), static_cast<size_t>(count),
+            static_cast<int64_t>(pricePerGram), static_cast<int32_t>(taxBps),
+            static_cast<RoundingMode>(rounding), reinterpret_cast<int64_t*>(out)));
+    }
+    if (out != nullptr) {
+        env->ReleasePrimitiveArrayCritical(totals, out, 0);
+    }
+    if (discounts != nullptr) {
+        env->ReleasePrimitiveArrayCritical(discountBps, discounts, JNI_ABORT);
+    }
+    if (wages != nullptr) {
+        env->ReleasePrimitiveArrayCritical(wage, wages, JNI_ABORT);
+    }
+    if (weights != nullptr) {
+        env->ReleasePrimitiveArrayCritical(weightMg, weights, JNI_ABORT);
+    }
+    return priced;
+}
+
+const JNINativeMethod METHODS[] = {
+    {"nativePriceAll", "([J[J[IJII[J)I", reinterpret_cast<void*>(priceAll)},
+};
+
+} // namespace
+
+namespace noghresod {
+    extern const JniClassBinding NATIVE_MONEY_BINDING = {
+        "com/noghre/sod/core/util/NativeMoney",
+        METHODS,
+        sizeof(METHODS) / sizeof(METHODS[0]),
+        nullptr
+    };
+}
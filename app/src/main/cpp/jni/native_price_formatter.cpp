@@ -0,0 +1,90 @@
+#include <jni.h>
+#include <cstdint>
+#include "jni_bindings.h"
+#include "native_stats.h"
+#include "native_trace.h"
+#include "number_format.h"
+
+using noghresod::MAX_FORMATTED_NUMBER;
+
+namespace {
+
+/**
+ * Format one value into chars[offset...].
+ * @param flags NumberFormatFlags
+ * @return Chars written, or -1 if [chars] has no room for
+ *         MAX_FORMATTED_NUMBER chars at [offset]
+ */
+jint format(JNIEnv* env, jobject /* this */, jlong value, jint flags,
+            jcharArray chars, jint offset) {
+    NOGHRESOD_STAT_SCOPE(NATIVE_PRICE_FORMATTER_FORMAT);
+    if (chars == nullptr || offset < 0 ||
+        env->GetArrayLength(chars) - offset < static_cast<jint>(MAX_FORMATTED_NUMBER)) {
+        return -1;
+    }
+    jchar formatted[MAX_FORMATTED_NUMBER];
+    size_t length = noghresod::formatNumber(static_cast<int64_t>(value), static_cast<uint32_t>(flags),
+                                            reinterpret_cast<uint16_t*>(formatted));
+    env->SetCharArrayRegion(chars, offset, static_cast<jsize>(length), formatted);
+    return static_cast<jint>(length);
+}
+
+/**
+ * Format every value back to back into [chars]; value i ends at ends[i].
+ * One call and no allocation for a whole page of prices.
+ * @return Values formatted (see formatNumbers()), or -1 on invalid arguments
+ */
+jint formatAll(JNIEnv* env, jobject /* this */, jlongArray values, jint flags,
+               jcharArray chars, jintArray ends) {
+    NOGHRESOD_STAT_SCOPE(NATIVE_PRICE_FORMATTER_FORMAT_ALL);
+    NOGHRESOD_TRACE_SCOPE("NativePriceFormatter.formatAll");
+    if (values == nullptr || chars == nullptr || ends == nullptr) {
+        return -1;
+    }
+    jsize count = env->GetArrayLength(values);
+    jsize capacity = env->GetArrayLength(chars);
+    if (env->GetArrayLength(ends) < count) {
+        return -1;
+    }
+    if (count == 0) {
+        return 0;
+    }
+
+    // No JNI calls until the three arrays are released
+    auto* in = static_cast<jlong*>(env->GetPrimitiveArrayCritical(values, nullptr));
+    auto* out = static_cast<jchar*>(env->GetPrimitiveArrayCritical(chars, nullptr));
+    auto* outEnds = static_cast<jint*>(env->GetPrimitiveArrayCritical(ends, nullptr));
+    jint formatted = -1;
+    if (in != nullptr && out != nullptr && outEnds != nullptr) {
+        formatted = static_cast<jint>(noghresod::formatNumbers(
+            reinterpret_cast<const int64_t*>(in), static_cast<size_t>(count),
+            static_cast<uint32_t>(flags), reinterpret_cast<uint16_t*>(out),
+            static_cast<size_t>(capacity), reinterpret_cast<int32_t*>(outEnds)));
+    }
+    if (outEnds != nullptr) {
+        env->ReleasePrimitiveArrayCritical(ends, outEnds, 0);
+    }
+    if (out != nullptr) {
+        env->ReleasePrimitiveArrayCritical(chars, out, 0);
+    }
+    if (in != nullptr) {
+        env->ReleasePrimitiveArrayCritical(values, in, JNI_ABORT);
+    }
+    return formatted;
+}
+
+const JNINativeMethod METHODS[] = {
+    {"nativeFormat", "(JI[CI)I", reinterpret_cast<void*>(format)},
+    {"nativeFormatAll", "([JI[C[I)I", reinterpret_cast<void*>(formatAll)},
+};
+
+} // namespace
+
+namespace noghresod {
+    extern const JniClassBinding NATIVE_PRICE_FORMATTER_BINDING = {
+        "com/noghre/sod/core/util/NativePriceFormatter",
+        METHODS,
+        sizeof(METHODS) / sizeof(METHODS[0]),
+        nullptr
+    };
+}
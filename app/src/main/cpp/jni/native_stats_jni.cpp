@@ -0,0 +1,55 @@
+#include <jni.h>
+#include <cstdint>
+#include <vector>
+#include "jni_bindings.h"
+#include "native_stats.h"
+
+using noghresod::NativeStats;
+
+namespace {
+
+jbyteArray toByteArray(JNIEnv* env, const std::vector<uint8_t>& snapshot) {
+    jbyteArray result = env->NewByteArray(static_cast<jsize>(snapshot.size()));
+    if (result == nullptr) {
+        return nullptr;
+    }
+    env->SetByteArrayRegion(result, 0, static_cast<jsize>(snapshot.size()),
+                            reinterpret_cast<const jbyte*>(snapshot.data()));
+    return result;
+}
+
+/**
+ * Packed counters and latency histograms of every called entry point.
+ * Layout is documented on NativeStats::snapshot(); decoded by NativeStats.kt.
+ */
+jbyteArray dumpNativeStats(JNIEnv* env, jobject /* this */) {
+    return toByteArray(env, NativeStats::snapshot());
+}
+
+/**
+ * dumpNativeStats() with every counter zeroed as it is read.
+ */
+jbyteArray dumpAndResetNativeStats(JNIEnv* env, jobject /* this */) {
+    return toByteArray(env, NativeStats::snapshotAndReset());
+}
+
+void resetNativeStats(JNIEnv* /* env */, jobject /* this */) {
+    NativeStats::reset();
+}
+
+const JNINativeMethod METHODS[] = {
+    {"dumpNativeStats", "()[B", reinterpret_cast<void*>(dumpNativeStats)},
+    {"dumpAndResetNativeStats", "()[B", reinterpret_cast<void*>(dumpAndResetNativeStats)},
+    {"resetNativeStats", "()V", reinterpret_cast<void*>(resetNativeStats)},
+};
+
+} // namespace
+
+namespace noghresod {
+    extern const JniClassBinding NATIVE_STATS_BINDING = {
+        "com/noghre/sod/core/monitoring/NativeStats",
+        METHODS,
+        sizeof(METHODS) / sizeof(METHODS[0]),
+        nullptr
+    };
+}
@@ -0,0 +1,646 @@
+#include "aes_gcm.h"
+
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include "cpu_features.h"
+#include "secure_memory.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define NOGHRESOD_AES_X86 1
+#endif
+
+namespace noghresod {
+
+using aes_gcm_internal::CipherBackend;
+using aes_gcm_internal::GhashKey;
+using aes_gcm_internal::HashBackend;
+using aes_gcm_internal::ROUNDS;
+
+namespace {
+
+    // ============================================
+    // Portable AES (T-tables built at compile time)
+    // ============================================
+
+    constexpr uint8_t xtime(uint8_t x) {
+        return static_cast<uint8_t>((x << 1) ^ ((x & 0x80) ? 0x1B : 0x00));
+    }
+
+    constexpr uint8_t rotl8(uint8_t x, int shift) {
+        return static_cast<uint8_t>((x << shift) | (x >> (8 - shift)));
+    }
+
+    constexpr std::array<uint8_t, 256> makeSbox() {
+        std::array<uint8_t, 256> sbox{};
+        uint8_t p = 1;
+        uint8_t q = 1;
+        // Walk the multiplicative group with generator 3; q tracks p's inverse
+        do {
+            p = static_cast<uint8_t>(p ^ xtime(p));
+            q = static_cast<uint8_t>(q ^ (q << 1));
+            q = static_cast<uint8_t>(q ^ (q << 2));
+            q = static_cast<uint8_t>(q ^ (q << 4));
+            if (q & 0x80) {
+                q ^= 0x09;
+            }
+            uint8_t x = static_cast<uint8_t>(
+                q ^ rotl8(q, 1) ^ rotl8(q, 2) ^ rotl8(q, 3) ^ rotl8(q, 4));
+            sbox[p] = static_cast<uint8_t>(x ^ 0x63);
+        } while (p != 1);
+        sbox[0] = 0x63;
+        return sbox;
+    }
+
+    constexpr std::array<uint8_t, 256> SBOX = makeSbox();
+
+    constexpr uint32_t ror32(uint32_t x, int shift) {
+        return (x >> shift) | (x << (32 - shift));
+    }
+
+    /**
+     * Te0[x] = (2·S[x], S[x], S[x], 3·S[x]); TeN is Te0 rotated right by 8·N.
+     */
+    constexpr std::array<uint32_t, 256> makeTe(int rotation) {
+        std::array<uint32_t, 256> table{};
+        for (int i = 0; i < 256; i++) {
+            uint8_t s = SBOX[i];
+            uint8_t s2 = xtime(s);
+            uint8_t s3 = static_cast<uint8_t>(s2 ^ s);
+            uint32_t word = (uint32_t(s2) << 24) | (uint32_t(s) << 16) | (uint32_t(s) << 8) | s3;
+            table[i] = rotation == 0 ? word : ror32(word, rotation * 8);
+        }
+        return table;
+    }
+
+    constexpr std::array<uint32_t, 256> TE0 = makeTe(0);
+    constexpr std::array<uint32_t, 256> TE1 = makeTe(1);
+    constexpr std::array<uint32_t, 256> TE2 = makeTe(2);
+    constexpr std::array<uint32_t, 256> TE3 = makeTe(3);
+
+    inline uint32_t loadBe32(const uint8_t* p) {
+        return (uint32_t(p[0]) << 24) | (uint32_t(p[1]) << 16) | (uint32_t(p[2]) << 8) | p[3];
+    }
+
+    inline void storeBe32(uint8_t* p, uint32_t v) {
+        p[0] = static_cast<uint8_t>(v >> 24);
+        p[1] = static_cast<uint8_t>(v >> 16);
+        p[2] = static_cast<uint8_t>(v >> 8);
+        p[3] = static_cast<uint8_t>(v);
+    }
+
+    inline uint64_t loadBe64(const uint8_t* p) {
+        return (uint64_t(loadBe32(p)) << 32) | loadBe32(p + 4);
+    }
+
+    inline void storeBe64(uint8_t* p, uint64_t v) {
+        storeBe32(p, static_cast<uint32_t>(v >> 32));
+        storeBe32(p + 4, static_cast<uint32_t>(v));
+    }
+
+    inline uint32_t subWord(uint32_t w) {
+        return (uint32_t(SBOX[w >> 24]) << 24) | (uint32_t(SBOX[(w >> 16) & 0xFF]) << 16) |
+               (uint32_t(SBOX[(w >> 8) & 0xFF]) << 8) | SBOX[w & 0xFF];
+    }
+
+    /**
+     * AES-256 key expansion (FIPS 197, 5.2). Round keys are stored as bytes in
+     * the standard order, which is also what AES-NI and ARMv8 CE consume.
+     */
+    void expandKey(const uint8_t* key, uint8_t* roundKeys) {
+        const size_t words = 4 * (ROUNDS + 1);
+        uint32_t w[4 * (ROUNDS + 1)];
+        uint8_t rcon = 0x01;
+
+        for (size_t i = 0; i < 8; i++) {
+            w[i] = loadBe32(key + i * 4);
+        }
+        for (size_t i = 8; i < words; i++) {
+            uint32_t temp = w[i - 1];
+            if (i % 8 == 0) {
+                temp = subWord((temp << 8) | (temp >> 24)) ^ (uint32_t(rcon) << 24);
+                rcon = xtime(rcon);
+            } else if (i % 8 == 4) {
+                temp = subWord(temp);
+            }
+            w[i] = w[i - 8] ^ temp;
+        }
+
+        for (size_t i = 0; i < words; i++) {
+            storeBe32(roundKeys + i * 4, w[i]);
+        }
+        secureWipe(w, sizeof(w));
+    }
+
+    void portableEncryptBlock(const uint8_t* roundKeys, const uint8_t* in, uint8_t* out) {
+        const uint8_t* rk = roundKeys;
+        uint32_t s0 = loadBe32(in) ^ loadBe32(rk);
+        uint32_t s1 = loadBe32(in + 4) ^ loadBe32(rk + 4);
+        uint32_t s2 = loadBe32(in + 8) ^ loadBe32(rk + 8);
+        uint32_t s3 = loadBe32(in + 12) ^ loadBe32(rk + 12);
+
+        for (size_t round = 1; round < ROUNDS; round++) {
+            rk += 16;
+            uint32_t t0 = TE0[s0 >> 24] ^ TE1[(s1 >> 16) & 0xFF] ^ TE2[(s2 >> 8) & 0xFF] ^ TE3[s3 & 0xFF] ^ loadBe32(rk);
+            uint32_t t1 = TE0[s1 >> 24] ^ TE1[(s2 >> 16) & 0xFF] ^ TE2[(s3 >> 8) & 0xFF] ^ TE3[s0 & 0xFF] ^ loadBe32(rk + 4);
+            uint32_t t2 = TE0[s2 >> 24] ^ TE1[(s3 >> 16) & 0xFF] ^ TE2[(s0 >> 8) & 0xFF] ^ TE3[s1 & 0xFF] ^ loadBe32(rk + 8);
+            uint32_t t3 = TE0[s3 >> 24] ^ TE1[(s0 >> 16) & 0xFF] ^ TE2[(s1 >> 8) & 0xFF] ^ TE3[s2 & 0xFF] ^ loadBe32(rk + 12);
+            s0 = t0;
+            s1 = t1;
+            s2 = t2;
+            s3 = t3;
+        }
+
+        rk += 16;
+        auto last = [](uint32_t a, uint32_t b, uint32_t c, uint32_t d) {
+            return (uint32_t(SBOX[a >> 24]) << 24) | (uint32_t(SBOX[(b >> 16) & 0xFF]) << 16) |
+                   (uint32_t(SBOX[(c >> 8) & 0xFF]) << 8) | SBOX[d & 0xFF];
+        };
+        storeBe32(out, last(s0, s1, s2, s3) ^ loadBe32(rk));
+        storeBe32(out + 4, last(s1, s2, s3, s0) ^ loadBe32(rk + 4));
+        storeBe32(out + 8, last(s2, s3, s0, s1) ^ loadBe32(rk + 8));
+        storeBe32(out + 12, last(s3, s0, s1, s2) ^ loadBe32(rk + 12));
+    }
+
+    void portableCtr32(const uint8_t* roundKeys, uint8_t* counter,
+                       const uint8_t* in, uint8_t* out, size_t blocks) {
+        uint8_t keystream[16];
+        uint32_t ctr = loadBe32(counter + 12);
+        for (size_t b = 0; b < blocks; b++) {
+            portableEncryptBlock(roundKeys, counter, keystream);
+            for (size_t i = 0; i < 16; i++) {
+                out[i] = in[i] ^ keystream[i];
+            }
+            storeBe32(counter + 12, ++ctr);
+            in += 16;
+            out += 16;
+        }
+        secureWipe(keystream, sizeof(keystream));
+    }
+
+    // ============================================
+    // Portable GHASH (4-bit tables, Shoup's method)
+    // ============================================
+
+    const uint64_t GHASH_REDUCE4[16] = {
+        0x0000, 0x1C20, 0x3840, 0x2460, 0x7080, 0x6CA0, 0x48C0, 0x54E0,
+        0xE100, 0xFD20, 0xD940, 0xC560, 0x9180, 0x8DA0, 0xA9C0, 0xB5E0
+    };
+
+    /**
+     * Precompute i·H for every 4-bit i (bit-reflected GF(2^128) order).
+     */
+    void buildGhashTables(GhashKey& key) {
+        uint64_t vh = loadBe64(key.h);
+        uint64_t vl = loadBe64(key.h + 8);
+
+        key.tableHigh[8] = vh;
+        key.tableLow[8] = vl;
+        key.tableHigh[0] = 0;
+        key.tableLow[0] = 0;
+
+        for (int i = 4; i > 0; i >>= 1) {
+            uint64_t carry = (vl & 1) ? 0xE100000000000000ULL : 0;
+            vl = (vh << 63) | (vl >> 1);
+            vh = (vh >> 1) ^ carry;
+            key.tableHigh[i] = vh;
+            key.tableLow[i] = vl;
+        }
+
+        for (int i = 2; i <= 8; i *= 2) {
+            for (int j = 1; j < i; j++) {
+                key.tableHigh[i + j] = key.tableHigh[i] ^ key.tableHigh[j];
+                key.tableLow[i + j] = key.tableLow[i] ^ key.tableLow[j];
+            }
+        }
+    }
+
+    void portableGhashMultiply(const GhashKey& key, uint8_t* x) {
+        uint8_t lo = x[15] & 0x0F;
+        uint64_t zh = key.tableHigh[lo];
+        uint64_t zl = key.tableLow[lo];
+
+        for (int i = 15; i >= 0; i--) {
+            lo = x[i] & 0x0F;
+            uint8_t hi = (x[i] >> 4) & 0x0F;
+
+            if (i != 15) {
+                uint8_t rem = zl & 0x0F;
+                zl = (zh << 60) | (zl >> 4);
+                zh = (zh >> 4) ^ (GHASH_REDUCE4[rem] << 48);
+                zh ^= key.tableHigh[lo];
+                zl ^= key.tableLow[lo];
+            }
+
+            uint8_t rem = zl & 0x0F;
+            zl = (zh << 60) | (zl >> 4);
+            zh = (zh >> 4) ^ (GHASH_REDUCE4[rem] << 48);
+            zh ^= key.tableHigh[hi];
+            zl ^= key.tableLow[hi];
+        }
+
+        storeBe64(x, zh);
+        storeBe64(x + 8, zl);
+    }
+
+    void portableGhash(const GhashKey& key, uint8_t* state, const uint8_t* data, size_t blocks) {
+        for (size_t b = 0; b < blocks; b++) {
+            for (size_t i = 0; i < 16; i++) {
+                state[i] ^= data[i];
+            }
+            portableGhashMultiply(key, state);
+            data += 16;
+        }
+    }
+
+    const CipherBackend PORTABLE_CIPHER = { "portable", portableEncryptBlock, portableCtr32 };
+    const HashBackend PORTABLE_HASH = { "portable", portableGhash };
+
+    // ============================================
+    // x86: AES-NI + PCLMULQDQ
+    // ============================================
+
+#ifdef NOGHRESOD_AES_X86
+    __attribute__((target("aes,sse4.1")))
+    inline __m128i aesniEncrypt(const __m128i* keys, __m128i block) {
+        block = _mm_xor_si128(block, keys[0]);
+        for (size_t r = 1; r < ROUNDS; r++) {
+            block = _mm_aesenc_si128(block, keys[r]);
+        }
+        return _mm_aesenclast_si128(block, keys[ROUNDS]);
+    }
+
+    __attribute__((target("aes,sse4.1")))
+    inline __m128i counterBlock(__m128i base, uint32_t value) {
+        return _mm_insert_epi32(base, static_cast<int>(__builtin_bswap32(value)), 3);
+    }
+
+    __attribute__((target("aes,sse4.1")))
+    void aesniEncryptBlock(const uint8_t* roundKeys, const uint8_t* in, uint8_t* out) {
+        __m128i keys[ROUNDS + 1];
+        for (size_t r = 0; r <= ROUNDS; r++) {
+            keys[r] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(roundKeys + r * 16));
+        }
+        __m128i block = aesniEncrypt(keys, _mm_loadu_si128(reinterpret_cast<const __m128i*>(in)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), block);
+    }
+
+    __attribute__((target("aes,sse4.1")))
+    void aesniCtr32(const uint8_t* roundKeys, uint8_t* counter,
+                    const uint8_t* in, uint8_t* out, size_t blocks) {
+        __m128i keys[ROUNDS + 1];
+        for (size_t r = 0; r <= ROUNDS; r++) {
+            keys[r] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(roundKeys + r * 16));
+        }
+
+        __m128i base = _mm_loadu_si128(reinterpret_cast<const __m128i*>(counter));
+        uint32_t ctr = loadBe32(counter + 12);
+
+        // Four independent blocks keep the AES unit's pipeline full
+        while (blocks >= 4) {
+            __m128i b0 = _mm_xor_si128(counterBlock(base, ctr), keys[0]);
+            __m128i b1 = _mm_xor_si128(counterBlock(base, ctr + 1), keys[0]);
+            __m128i b2 = _mm_xor_si128(counterBlock(base, ctr + 2), keys[0]);
+            __m128i b3 = _mm_xor_si128(counterBlock(base, ctr + 3), keys[0]);
+            for (size_t r = 1; r < ROUNDS; r++) {
+                b0 = _mm_aesenc_si128(b0, keys[r]);
+                b1 = _mm_aesenc_si128(b1, keys[r]);
+                b2 = _mm_aesenc_si128(b2, keys[r]);
+                b3 = _mm_aesenc_si128(b3, keys[r]);
+            }
+            b0 = _mm_aesenclast_si128(b0, keys[ROUNDS]);
+            b1 = _mm_aesenclast_si128(b1, keys[ROUNDS]);
+            b2 = _mm_aesenclast_si128(b2, keys[ROUNDS]);
+            b3 = _mm_aesenclast_si128(b3, keys[ROUNDS]);
+
+            const __m128i* src = reinterpret_cast<const __m128i*>(in);
+            __m128i* dst = reinterpret_cast<__m128i*>(out);
+            _mm_storeu_si128(dst, _mm_xor_si128(b0, _mm_loadu_si128(src)));
+            _mm_storeu_si128(dst + 1, _mm_xor_si128(b1, _mm_loadu_si128(src + 1)));
+            _mm_storeu_si128(dst + 2, _mm_xor_si128(b2, _mm_loadu_si128(src + 2)));
+            _mm_storeu_si128(dst + 3, _mm_xor_si128(b3, _mm_loadu_si128(src + 3)));
+
+            ctr += 4;
+            blocks -= 4;
+            in += 64;
+            out += 64;
+        }
+
+        while (blocks > 0) {
+            __m128i block = aesniEncrypt(keys, counterBlock(base, ctr));
+            __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_xor_si128(block, data));
+            ctr++;
+            blocks--;
+            in += 16;
+            out += 16;
+        }
+
+        storeBe32(counter + 12, ctr);
+    }
+
+    /**
+     * GF(2^128) multiply of byte-reflected operands
+     * (Intel carry-less multiplication white paper, algorithm 5).
+     */
+    __attribute__((target("pclmul,sse4.1")))
+    inline __m128i clmulMultiply(__m128i a, __m128i b) {
+        __m128i lo = _mm_clmulepi64_si128(a, b, 0x00);
+        __m128i mid = _mm_xor_si128(_mm_clmulepi64_si128(a, b, 0x10),
+                                    _mm_clmulepi64_si128(a, b, 0x01));
+        __m128i hi = _mm_clmulepi64_si128(a, b, 0x11);
+
+        lo = _mm_xor_si128(lo, _mm_slli_si128(mid, 8));
+        hi = _mm_xor_si128(hi, _mm_srli_si128(mid, 8));
+
+        // Shift the 256-bit product left by one bit
+        __m128i loCarry = _mm_srli_epi32(lo, 31);
+        __m128i hiCarry = _mm_srli_epi32(hi, 31);
+        lo = _mm_slli_epi32(lo, 1);
+        hi = _mm_slli_epi32(hi, 1);
+        __m128i cross = _mm_srli_si128(loCarry, 12);
+        hiCarry = _mm_slli_si128(hiCarry, 4);
+        loCarry = _mm_slli_si128(loCarry, 4);
+        lo = _mm_or_si128(lo, loCarry);
+        hi = _mm_or_si128(hi, hiCarry);
+        hi = _mm_or_si128(hi, cross);
+
+        // Reduce modulo x^128 + x^7 + x^2 + x + 1
+        __m128i a1 = _mm_slli_epi32(lo, 31);
+        __m128i a2 = _mm_slli_epi32(lo, 30);
+        __m128i a3 = _mm_slli_epi32(lo, 25);
+        a1 = _mm_xor_si128(a1, _mm_xor_si128(a2, a3));
+        __m128i spill = _mm_srli_si128(a1, 4);
+        a1 = _mm_slli_si128(a1, 12);
+        lo = _mm_xor_si128(lo, a1);
+
+        __m128i b1 = _mm_srli_epi32(lo, 1);
+        __m128i b2 = _mm_srli_epi32(lo, 2);
+        __m128i b3 = _mm_srli_epi32(lo, 7);
+        b1 = _mm_xor_si128(b1, _mm_xor_si128(b2, b3));
+        b1 = _mm_xor_si128(b1, spill);
+        lo = _mm_xor_si128(lo, b1);
+        return _mm_xor_si128(hi, lo);
+    }
+
+    __attribute__((target("pclmul,sse4.1")))
+    void pclmulGhash(const GhashKey& key, uint8_t* state, const uint8_t* data, size_t blocks) {
+        const __m128i reverse = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+        __m128i h = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(key.h)), reverse);
+        __m128i x = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(state)), reverse);
+
+        for (size_t b = 0; b < blocks; b++) {
+            __m128i block = _mm_shuffle_epi8(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), reverse);
+            x = clmulMultiply(_mm_xor_si128(x, block), h);
+            data += 16;
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(state), _mm_shuffle_epi8(x, reverse));
+    }
+
+    const CipherBackend AESNI_CIPHER = { "aesni", aesniEncryptBlock, aesniCtr32 };
+    const HashBackend PCLMUL_HASH = { "pclmul", pclmulGhash };
+#endif
+
+    // ============================================
+    // Backend selection
+    // ============================================
+
+    struct Backends {
+        const CipherBackend* cipher;
+        const HashBackend* hash;
+        char name[32];
+    };
+
+    Backends selectBackends() {
+        // The ARMv8 backends are nullptr unless built with +crypto (arm64-v8a)
+        static const DispatchEntry<const CipherBackend*> CIPHERS[] = {
+#ifdef NOGHRESOD_AES_X86
+            { CPU_AESNI | CPU_SSE41, &AESNI_CIPHER, "aesni" },
+#endif
+            { CPU_ARM_AES, aes_gcm_internal::armv8CipherBackend(), "armv8" },
+            { 0, &PORTABLE_CIPHER, "portable" },
+        };
+        static const DispatchEntry<const HashBackend*> HASHES[] = {
+#ifdef NOGHRESOD_AES_X86
+            { CPU_PCLMUL | CPU_SSE41, &PCLMUL_HASH, "pclmul" },
+#endif
+            { CPU_ARM_PMULL, aes_gcm_internal::armv8HashBackend(), "pmull" },
+            { 0, &PORTABLE_HASH, "portable" },
+        };
+
+        Backends selected = { selectKernel(CIPHERS).fn, selectKernel(HASHES).fn, {} };
+        std::snprintf(selected.name, sizeof(selected.name), "%s+%s",
+                      selected.cipher->name, selected.hash->name);
+        return selected;
+    }
+
+    const Backends& backends() {
+        static const Backends selected = selectBackends();
+        return selected;
+    }
+
+    inline void incrementCounter(uint8_t* counter) {
+        storeBe32(counter + 12, loadBe32(counter + 12) + 1);
+    }
+}
+
+// ============================================
+// AesGcm
+// ============================================
+
+AesGcm::AesGcm(const uint8_t* key) {
+    expandKey(key, roundKeys_);
+
+    uint8_t zero[16] = {};
+    backends().cipher->encryptBlock(roundKeys_, zero, hashKey_.h);
+    buildGhashTables(hashKey_);
+}
+
+AesGcm::~AesGcm() {
+    secureWipe(roundKeys_, sizeof(roundKeys_));
+    secureWipe(&hashKey_, sizeof(hashKey_));
+}
+
+void AesGcm::encrypt(const uint8_t* iv, const uint8_t* aad, size_t aadSize,
+                     const uint8_t* in, size_t size, uint8_t* out, uint8_t* tag) const {
+    GcmStream stream(*this, iv, GcmStream::Mode::ENCRYPT);
+    stream.updateAad(aad, aadSize);
+    stream.update(in, size, out);
+    stream.finish(tag);
+}
+
+bool AesGcm::decrypt(const uint8_t* iv, const uint8_t* aad, size_t aadSize,
+                     const uint8_t* in, size_t size, const uint8_t* tag, uint8_t* out) const {
+    GcmStream stream(*this, iv, GcmStream::Mode::DECRYPT);
+    stream.updateAad(aad, aadSize);
+    stream.update(in, size, out);
+    if (!stream.verify(tag)) {
+        secureWipe(out, size);
+        return false;
+    }
+    return true;
+}
+
+const char* AesGcm::backendName() {
+    return backends().name;
+}
+
+// ============================================
+// GcmStream
+// ============================================
+
+GcmStream::GcmStream(const AesGcm& cipher, const uint8_t* iv, Mode mode)
+    : cipher_(cipher), mode_(mode) {
+    // 96-bit IV: J0 = IV || 0^31 || 1
+    std::memcpy(counter_, iv, AesGcm::IV_SIZE);
+    storeBe32(counter_ + 12, 1);
+    backends().cipher->encryptBlock(cipher_.roundKeys_, counter_, tagMask_);
+    incrementCounter(counter_);
+
+    std::memset(hash_, 0, sizeof(hash_));
+    std::memset(keystream_, 0, sizeof(keystream_));
+    std::memset(pending_, 0, sizeof(pending_));
+}
+
+GcmStream::~GcmStream() {
+    secureWipe(counter_, sizeof(counter_));
+    secureWipe(tagMask_, sizeof(tagMask_));
+    secureWipe(hash_, sizeof(hash_));
+    secureWipe(keystream_, sizeof(keystream_));
+    secureWipe(pending_, sizeof(pending_));
+}
+
+void GcmStream::absorb(const uint8_t* data, size_t size) {
+    const HashBackend* hash = backends().hash;
+
+    if (pendingSize_ > 0) {
+        size_t take = 16 - pendingSize_ < size ? 16 - pendingSize_ : size;
+        std::memcpy(pending_ + pendingSize_, data, take);
+        pendingSize_ += take;
+        data += take;
+        size -= take;
+        if (pendingSize_ < 16) {
+            return;
+        }
+        hash->ghash(cipher_.hashKey_, hash_, pending_, 1);
+        pendingSize_ = 0;
+    }
+
+    size_t blocks = size / 16;
+    if (blocks > 0) {
+        hash->ghash(cipher_.hashKey_, hash_, data, blocks);
+        data += blocks * 16;
+        size -= blocks * 16;
+    }
+
+    if (size > 0) {
+        std::memcpy(pending_, data, size);
+        pendingSize_ = size;
+    }
+}
+
+void GcmStream::updateAad(const uint8_t* aad, size_t size) {
+    if (aadDone_ || size == 0) {
+        return;
+    }
+    absorb(aad, size);
+    aadSize_ += size;
+}
+
+void GcmStream::flushAad() {
+    if (aadDone_) {
+        return;
+    }
+    // AAD is zero-padded to a block boundary before the ciphertext starts
+    if (pendingSize_ > 0) {
+        std::memset(pending_ + pendingSize_, 0, 16 - pendingSize_);
+        backends().hash->ghash(cipher_.hashKey_, hash_, pending_, 1);
+        pendingSize_ = 0;
+    }
+    aadDone_ = true;
+}
+
+void GcmStream::update(const uint8_t* in, size_t size, uint8_t* out) {
+    flushAad();
+    const CipherBackend* cipher = backends().cipher;
+
+    // Finish a block left partially used by the previous call
+    size_t offset = static_cast<size_t>(textSize_ % 16);
+    if (offset != 0 && size > 0) {
+        size_t take = 16 - offset < size ? 16 - offset : size;
+        for (size_t i = 0; i < take; i++) {
+            uint8_t c = in[i];
+            out[i] = c ^ keystream_[offset + i];
+            absorb(mode_ == Mode::ENCRYPT ? out + i : &c, 1);
+        }
+        in += take;
+        out += take;
+        size -= take;
+        textSize_ += take;
+    }
+
+    size_t blocks = size / 16;
+    if (blocks > 0) {
+        size_t bytes = blocks * 16;
+        if (mode_ == Mode::DECRYPT) {
+            // Hash the ciphertext before an in-place decrypt overwrites it
+            absorb(in, bytes);
+            cipher->ctr32(cipher_.roundKeys_, counter_, in, out, blocks);
+        } else {
+            cipher->ctr32(cipher_.roundKeys_, counter_, in, out, blocks);
+            absorb(out, bytes);
+        }
+        in += bytes;
+        out += bytes;
+        size -= bytes;
+        textSize_ += bytes;
+    }
+
+    if (size > 0) {
+        cipher->encryptBlock(cipher_.roundKeys_, counter_, keystream_);
+        incrementCounter(counter_);
+        for (size_t i = 0; i < size; i++) {
+            uint8_t c = in[i];
+            out[i] = c ^ keystream_[i];
+            absorb(mode_ == Mode::ENCRYPT ? out + i : &c, 1);
+        }
+        textSize_ += size;
+    }
+}
+
+void GcmStream::finish(uint8_t* tag) {
+    flushAad();
+    const HashBackend* hash = backends().hash;
+
+    if (pendingSize_ > 0) {
+        std::memset(pending_ + pendingSize_, 0, 16 - pendingSize_);
+        hash->ghash(cipher_.hashKey_, hash_, pending_, 1);
+        pendingSize_ = 0;
+    }
+
+    uint8_t lengths[16];
+    storeBe64(lengths, aadSize_ * 8);
+    storeBe64(lengths + 8, textSize_ * 8);
+    hash->ghash(cipher_.hashKey_, hash_, lengths, 1);
+
+    for (size_t i = 0; i < AesGcm::TAG_SIZE; i++) {
+        tag[i] = hash_[i] ^ tagMask_[i];
+    }
+}
+
+bool GcmStream::verify(const uint8_t* tag) {
+    uint8_t computed[AesGcm::TAG_SIZE];
+    finish(computed);
+
+    uint8_t diff = 0;
+    for (size_t i = 0; i < AesGcm::TAG_SIZE; i++) {
+        diff |= computed[i] ^ tag[i];
+    }
+    secureWipe(computed, sizeof(computed));
+    return diff == 0;
+}
+
+} // namespace noghresod
@@ -0,0 +1,124 @@
+#ifndef NOGHRESOD_AES_GCM_H
+#define NOGHRESOD_AES_GCM_H
+
+#include <cstddef>
+#include <cstdint>
+#include "aes_gcm_internal.h"
+
+namespace noghresod {
+
+/**
+ * AES-256-GCM with the key schedule expanded once per key.
+ *
+ * Construct one AesGcm per key and keep it: the round keys and the GHASH
+ * key tables are derived in the constructor and reused by every message.
+ * Block encryption runs on ARMv8 Crypto Extensions or AES-NI and GHASH on
+ * PMULL or PCLMULQDQ when the CPU has them, with a table-driven portable
+ * fallback otherwise. The backend is chosen once per process.
+ *
+ * An AesGcm is immutable after construction and may be shared between
+ * threads; each message needs its own GcmStream.
+ */
+class AesGcm {
+public:
+    static const size_t KEY_SIZE = 32;
+    static const size_t IV_SIZE = 12;
+    static const size_t TAG_SIZE = 16;
+    static const size_t BLOCK_SIZE = 16;
+
+    /**
+     * @param key KEY_SIZE bytes
+     */
+    explicit AesGcm(const uint8_t* key);
+    ~AesGcm();
+
+    AesGcm(const AesGcm&) = delete;
+    AesGcm& operator=(const AesGcm&) = delete;
+
+    /**
+     * One-shot encryption. [in] and [out] may be the same buffer.
+     */
+    void encrypt(const uint8_t* iv, const uint8_t* aad, size_t aadSize,
+                 const uint8_t* in, size_t size, uint8_t* out, uint8_t* tag) const;
+
+    /**
+     * One-shot decryption. [in] and [out] may be the same buffer.
+     * @return false if the tag does not match; [out] is wiped in that case
+     */
+    bool decrypt(const uint8_t* iv, const uint8_t* aad, size_t aadSize,
+                 const uint8_t* in, size_t size, const uint8_t* tag, uint8_t* out) const;
+
+    /**
+     * Backends in use, e.g. "aesni+pclmul", "armv8-ce+pmull" or "portable+portable".
+     */
+    static const char* backendName();
+
+private:
+    friend class GcmStream;
+
+    alignas(16) uint8_t roundKeys_[aes_gcm_internal::ROUND_KEY_BYTES];
+    aes_gcm_internal::GhashKey hashKey_;
+};
+
+/**
+ * Incremental AES-256-GCM over a single message.
+ *
+ * Call updateAad() any number of times first, then update() with chunks of
+ * any size, then finish() (encryption) or verify() (decryption). Chunks do
+ * not need to be block-aligned. When decrypting, plaintext released before
+ * verify() succeeds is unauthenticated.
+ */
+class GcmStream {
+public:
+    enum class Mode {
+        ENCRYPT,
+        DECRYPT
+    };
+
+    /**
+     * @param cipher Must outlive the stream
+     * @param iv AesGcm::IV_SIZE bytes; never reuse an IV with the same key
+     */
+    GcmStream(const AesGcm& cipher, const uint8_t* iv, Mode mode);
+    ~GcmStream();
+
+    GcmStream(const GcmStream&) = delete;
+    GcmStream& operator=(const GcmStream&) = delete;
+
+    void updateAad(const uint8_t* aad, size_t size);
+
+    /**
+     * Encrypt or decrypt [size] bytes. [in] and [out] may be the same buffer.
+     */
+    void update(const uint8_t* in, size_t size, uint8_t* out);
+
+    /**
+     * Compute the tag over everything processed so far.
+     */
+    void finish(uint8_t* tag);
+
+    /**
+     * Compare the computed tag with [tag] in constant time.
+     */
+    bool verify(const uint8_t* tag);
+
+private:
+    void flushAad();
+    void absorb(const uint8_t* data, size_t size);
+
+    const AesGcm& cipher_;
+    Mode mode_;
+    alignas(16) uint8_t counter_[16];
+    alignas(16) uint8_t tagMask_[16];
+    alignas(16) uint8_t hash_[16];
+    alignas(16) uint8_t keystream_[16];
+    alignas(16) uint8_t pending_[16];
+    size_t pendingSize_ = 0;
+    uint64_t aadSize_ = 0;
+    uint64_t textSize_ = 0;
+    bool aadDone_ = false;
+};
+
+} // namespace noghresod
+
+#endif // NOGHRESOD_AES_GCM_H
@@ -0,0 +1,225 @@
+#include "aes_gcm_internal.h"
+
+/**
+ * ARMv8 Crypto Extension backends for aes_gcm.cpp.
+ *
+ * Only compiled in when the translation unit targets the crypto extension
+ * (-march=armv8-a+crypto); CMake sets that flag for this file alone so the
+ * rest of the library still runs on cores without it. Whether the running
+ * CPU has AES/PMULL is checked by the caller's dispatch table (cpu_features.h).
+ */
+#if defined(__aarch64__) && (defined(__ARM_FEATURE_CRYPTO) || defined(__ARM_FEATURE_AES))
+
+#include <arm_neon.h>
+
+namespace noghresod {
+namespace aes_gcm_internal {
+
+namespace {
+
+    using RoundKeys = uint8x16_t[ROUNDS + 1];
+
+    inline void loadRoundKeys(const uint8_t* roundKeys, uint8x16_t* keys) {
+        for (size_t r = 0; r <= ROUNDS; r++) {
+            keys[r] = vld1q_u8(roundKeys + r * 16);
+        }
+    }
+
+    /**
+     * AESE performs AddRoundKey before SubBytes/ShiftRows, so the last
+     * round key is applied with a plain XOR.
+     */
+    inline uint8x16_t encrypt(const uint8x16_t* keys, uint8x16_t block) {
+        for (size_t r = 0; r < ROUNDS - 1; r++) {
+            block = vaesmcq_u8(vaeseq_u8(block, keys[r]));
+        }
+        block = vaeseq_u8(block, keys[ROUNDS - 1]);
+        return veorq_u8(block, keys[ROUNDS]);
+    }
+
+    inline uint32_t loadBe32(const uint8_t* p) {
+        return (uint32_t(p[0]) << 24) | (uint32_t(p[1]) << 16) | (uint32_t(p[2]) << 8) | p[3];
+    }
+
+    inline uint8x16_t counterBlock(uint8x16_t base, uint32_t value) {
+        return vreinterpretq_u8_u32(
+            vsetq_lane_u32(__builtin_bswap32(value), vreinterpretq_u32_u8(base), 3));
+    }
+
+    void ceEncryptBlock(const uint8_t* roundKeys, const uint8_t* in, uint8_t* out) {
+        RoundKeys keys;
+        loadRoundKeys(roundKeys, keys);
+        vst1q_u8(out, encrypt(keys, vld1q_u8(in)));
+    }
+
+    void ceCtr32(const uint8_t* roundKeys, uint8_t* counter,
+                 const uint8_t* in, uint8_t* out, size_t blocks) {
+        RoundKeys keys;
+        loadRoundKeys(roundKeys, keys);
+
+        uint8x16_t base = vld1q_u8(counter);
+        uint32_t ctr = loadBe32(counter + 12);
+
+        // Four independent blocks hide the AESE/AESMC latency
+        while (blocks >= 4) {
+            uint8x16_t b0 = counterBlock(base, ctr);
+            uint8x16_t b1 = counterBlock(base, ctr + 1);
+            uint8x16_t b2 = counterBlock(base, ctr + 2);
+            uint8x16_t b3 = counterBlock(base, ctr + 3);
+            for (size_t r = 0; r < ROUNDS - 1; r++) {
+                b0 = vaesmcq_u8(vaeseq_u8(b0, keys[r]));
+                b1 = vaesmcq_u8(vaeseq_u8(b1, keys[r]));
+                b2 = vaesmcq_u8(vaeseq_u8(b2, keys[r]));
+                b3 = vaesmcq_u8(vaeseq_u8(b3, keys[r]));
+            }
+            b0 = veorq_u8(vaeseq_u8(b0, keys[ROUNDS - 1]), keys[ROUNDS]);
+            b1 = veorq_u8(vaeseq_u8(b1, keys[ROUNDS - 1]), keys[ROUNDS]);
+            b2 = veorq_u8(vaeseq_u8(b2, keys[ROUNDS - 1]), keys[ROUNDS]);
+            b3 = veorq_u8(vaeseq_u8(b3, keys[ROUNDS - 1]), keys[ROUNDS]);
+
+            vst1q_u8(out, veorq_u8(b0, vld1q_u8(in)));
+            vst1q_u8(out + 16, veorq_u8(b1, vld1q_u8(in + 16)));
+            vst1q_u8(out + 32, veorq_u8(b2, vld1q_u8(in + 32)));
+            vst1q_u8(out + 48, veorq_u8(b3, vld1q_u8(in + 48)));
+
+            ctr += 4;
+            blocks -= 4;
+            in += 64;
+            out += 64;
+        }
+
+        while (blocks > 0) {
+            uint8x16_t block = encrypt(keys, counterBlock(base, ctr));
+            vst1q_u8(out, veorq_u8(block, vld1q_u8(in)));
+            ctr++;
+            blocks--;
+            in += 16;
+            out += 16;
+        }
+
+        counter[12] = static_cast<uint8_t>(ctr >> 24);
+        counter[13] = static_cast<uint8_t>(ctr >> 16);
+        counter[14] = static_cast<uint8_t>(ctr >> 8);
+        counter[15] = static_cast<uint8_t>(ctr);
+    }
+
+    // Byte shifts across the whole register, matching SSE's pslldq/psrldq
+    template <int BYTES>
+    inline uint32x4_t shiftLeftBytes(uint32x4_t v) {
+        return vreinterpretq_u32_u8(vextq_u8(vdupq_n_u8(0), vreinterpretq_u8_u32(v), 16 - BYTES));
+    }
+
+    template <int BYTES>
+    inline uint32x4_t shiftRightBytes(uint32x4_t v) {
+        return vreinterpretq_u32_u8(vextq_u8(vreinterpretq_u8_u32(v), vdupq_n_u8(0), BYTES));
+    }
+
+    inline uint32x4_t clmul(uint64x2_t a, uint64x2_t b, int laneA, int laneB) {
+        poly64_t x = static_cast<poly64_t>(vgetq_lane_u64(a, 0));
+        poly64_t y = static_cast<poly64_t>(vgetq_lane_u64(b, 0));
+        if (laneA) {
+            x = static_cast<poly64_t>(vgetq_lane_u64(a, 1));
+        }
+        if (laneB) {
+            y = static_cast<poly64_t>(vgetq_lane_u64(b, 1));
+        }
+        return vreinterpretq_u32_p128(vmull_p64(x, y));
+    }
+
+    /**
+     * GF(2^128) multiply of byte-reflected operands; a lane-for-lane
+     * translation of the PCLMULQDQ version in aes_gcm.cpp.
+     */
+    inline uint32x4_t pmullMultiply(uint32x4_t a32, uint32x4_t b32) {
+        uint64x2_t a = vreinterpretq_u64_u32(a32);
+        uint64x2_t b = vreinterpretq_u64_u32(b32);
+
+        uint32x4_t lo = clmul(a, b, 0, 0);
+        uint32x4_t mid = veorq_u32(clmul(a, b, 0, 1), clmul(a, b, 1, 0));
+        uint32x4_t hi = clmul(a, b, 1, 1);
+
+        lo = veorq_u32(lo, shiftLeftBytes<8>(mid));
+        hi = veorq_u32(hi, shiftRightBytes<8>(mid));
+
+        uint32x4_t loCarry = vshrq_n_u32(lo, 31);
+        uint32x4_t hiCarry = vshrq_n_u32(hi, 31);
+        lo = vshlq_n_u32(lo, 1);
+        hi = vshlq_n_u32(hi, 1);
+        uint32x4_t cross = shiftRightBytes<12>(loCarry);
+        hiCarry = shiftLeftBytes<4>(hiCarry);
+        loCarry = shiftLeftBytes<4>(loCarry);
+        lo = vorrq_u32(lo, loCarry);
+        hi = vorrq_u32(hi, hiCarry);
+        hi = vorrq_u32(hi, cross);
+
+        uint32x4_t a1 = vshlq_n_u32(lo, 31);
+        uint32x4_t a2 = vshlq_n_u32(lo, 30);
+        uint32x4_t a3 = vshlq_n_u32(lo, 25);
+        a1 = veorq_u32(a1, veorq_u32(a2, a3));
+        uint32x4_t spill = shiftRightBytes<4>(a1);
+        a1 = shiftLeftBytes<12>(a1);
+        lo = veorq_u32(lo, a1);
+
+        uint32x4_t b1 = vshrq_n_u32(lo, 1);
+        uint32x4_t b2 = vshrq_n_u32(lo, 2);
+        uint32x4_t b3 = vshrq_n_u32(lo, 7);
+        b1 = veorq_u32(b1, veorq_u32(b2, b3));
+        b1 = veorq_u32(b1, spill);
+        lo = veorq_u32(lo, b1);
+        return veorq_u32(hi, lo);
+    }
+
+    inline uint32x4_t loadReversed(const uint8_t* p) {
+        uint8x16_t v = vrev64q_u8(vld1q_u8(p));
+        return vreinterpretq_u32_u8(vextq_u8(v, v, 8));
+    }
+
+    inline void storeReversed(uint8_t* p, uint32x4_t v) {
+        uint8x16_t bytes = vrev64q_u8(vreinterpretq_u8_u32(v));
+        vst1q_u8(p, vextq_u8(bytes, bytes, 8));
+    }
+
+    void pmullGhash(const GhashKey& key, uint8_t* state, const uint8_t* data, size_t blocks) {
+        uint32x4_t h = loadReversed(key.h);
+        uint32x4_t x = loadReversed(state);
+
+        for (size_t b = 0; b < blocks; b++) {
+            x = pmullMultiply(veorq_u32(x, loadReversed(data)), h);
+            data += 16;
+        }
+
+        storeReversed(state, x);
+    }
+
+    const CipherBackend CE_CIPHER = { "armv8-ce", ceEncryptBlock, ceCtr32 };
+    const HashBackend PMULL_HASH = { "pmull", pmullGhash };
+}
+
+const CipherBackend* armv8CipherBackend() {
+    return &CE_CIPHER;
+}
+
+const HashBackend* armv8HashBackend() {
+    return &PMULL_HASH;
+}
+
+} // namespace aes_gcm_internal
+} // namespace noghresod
+
+#else
+
+namespace noghresod {
+namespace aes_gcm_internal {
+
+const CipherBackend* armv8CipherBackend() {
+    return nullptr;
+}
+
+const HashBackend* armv8HashBackend() {
+    return nullptr;
+}
+
+} // namespace aes_gcm_internal
+} // namespace noghresod
+
+#endif
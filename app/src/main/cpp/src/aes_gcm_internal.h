@@ -0,0 +1,68 @@
+#ifndef NOGHRESOD_AES_GCM_INTERNAL_H
+#define NOGHRESOD_AES_GCM_INTERNAL_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace noghresod {
+
+/**
+ * Backend plumbing shared by the AES-GCM translation units.
+ * Not part of the public API; use aes_gcm.h.
+ */
+namespace aes_gcm_internal {
+
+    const size_t ROUNDS = 14;
+    const size_t ROUND_KEY_BYTES = (ROUNDS + 1) * 16;
+
+    /**
+     * GHASH subkey H (big-endian bytes) plus the 4-bit multiplication
+     * tables used by the portable backend.
+     */
+    struct GhashKey {
+        alignas(16) uint8_t h[16];
+        uint64_t tableHigh[16];
+        uint64_t tableLow[16];
+    };
+
+    /**
+     * Encrypt one block with the expanded round keys.
+     */
+    using BlockFn = void (*)(const uint8_t* roundKeys, const uint8_t* in, uint8_t* out);
+
+    /**
+     * XOR [blocks] full blocks of [in] with the CTR keystream into [out],
+     * advancing the 32-bit big-endian counter in the last 4 bytes of [counter].
+     */
+    using Ctr32Fn = void (*)(const uint8_t* roundKeys, uint8_t* counter,
+                             const uint8_t* in, uint8_t* out, size_t blocks);
+
+    /**
+     * Fold [blocks] full blocks of [data] into the GHASH [state].
+     */
+    using GhashFn = void (*)(const GhashKey& key, uint8_t* state,
+                             const uint8_t* data, size_t blocks);
+
+    struct CipherBackend {
+        const char* name;
+        BlockFn encryptBlock;
+        Ctr32Fn ctr32;
+    };
+
+    struct HashBackend {
+        const char* name;
+        GhashFn ghash;
+    };
+
+    /**
+     * ARMv8 Crypto Extension backends from aes_gcm_armv8.cpp, or nullptr
+     * when this build does not target them. The caller checks the CPU.
+     */
+    const CipherBackend* armv8CipherBackend();
+    const HashBackend* armv8HashBackend();
+
+} // namespace aes_gcm_internal
+
+} // namespace noghresod
+
+#endif // NOGHRESOD_AES_GCM_INTERNAL_H
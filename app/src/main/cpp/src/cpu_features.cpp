@@ -0,0 +1,119 @@
+#include "cpu_features.h"
+
+#include <cstring>
+
+#if (defined(__aarch64__) || defined(__arm__)) && defined(__linux__)
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#define NOGHRESOD_CPU_AUXV 1
+#endif
+
+// Older kernel headers lack the newer bits; the values are ABI and never change
+#if defined(__aarch64__)
+#ifndef HWCAP_ASIMDDP
+#define HWCAP_ASIMDDP (1 << 20)
+#endif
+#elif defined(__arm__)
+#ifndef HWCAP_ASIMDDP
+#define HWCAP_ASIMDDP (1 << 24)
+#endif
+#ifndef HWCAP2_AES
+#define HWCAP2_AES (1 << 0)
+#define HWCAP2_PMULL (1 << 1)
+#define HWCAP2_SHA2 (1 << 3)
+#define HWCAP2_CRC32 (1 << 4)
+#endif
+#endif
+
+namespace noghresod {
+
+namespace {
+    const struct {
+        uint32_t feature;
+        const char* name;
+    } FEATURE_NAMES[] = {
+        { CPU_NEON, "neon" },
+        { CPU_ARM_AES, "aes" },
+        { CPU_ARM_PMULL, "pmull" },
+        { CPU_ARM_SHA2, "sha2" },
+        { CPU_ARM_CRC32, "crc32" },
+        { CPU_ARM_DOTPROD, "dotprod" },
+        { CPU_SSE2, "sse2" },
+        { CPU_SSSE3, "ssse3" },
+        { CPU_SSE41, "sse4.1" },
+        { CPU_SSE42, "sse4.2" },
+        { CPU_AVX2, "avx2" },
+        { CPU_AESNI, "aesni" },
+        { CPU_PCLMUL, "pclmul" },
+    };
+
+    uint32_t probe() {
+        uint32_t bits = 0;
+
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("sse2")) bits |= CPU_SSE2;
+        if (__builtin_cpu_supports("ssse3")) bits |= CPU_SSSE3;
+        if (__builtin_cpu_supports("sse4.1")) bits |= CPU_SSE41;
+        if (__builtin_cpu_supports("sse4.2")) bits |= CPU_SSE42;
+        if (__builtin_cpu_supports("avx2")) bits |= CPU_AVX2;
+        if (__builtin_cpu_supports("aes")) bits |= CPU_AESNI;
+        if (__builtin_cpu_supports("pclmul")) bits |= CPU_PCLMUL;
+#elif defined(__aarch64__) && defined(NOGHRESOD_CPU_AUXV)
+        unsigned long hwcap = getauxval(AT_HWCAP);
+        // Advanced SIMD is mandatory on AArch64
+        bits |= CPU_NEON;
+        if (hwcap & HWCAP_AES) bits |= CPU_ARM_AES;
+        if (hwcap & HWCAP_PMULL) bits |= CPU_ARM_PMULL;
+        if (hwcap & HWCAP_SHA2) bits |= CPU_ARM_SHA2;
+        if (hwcap & HWCAP_CRC32) bits |= CPU_ARM_CRC32;
+        if (hwcap & HWCAP_ASIMDDP) bits |= CPU_ARM_DOTPROD;
+#elif defined(__aarch64__)
+        bits |= CPU_NEON;
+#elif defined(__arm__) && defined(NOGHRESOD_CPU_AUXV)
+        // NEON is optional on ARMv7, and the v8 extensions show up in
+        // AT_HWCAP2 when a 32-bit process runs on an ARMv8 core
+        unsigned long hwcap = getauxval(AT_HWCAP);
+        unsigned long hwcap2 = getauxval(AT_HWCAP2);
+        if (hwcap & HWCAP_NEON) bits |= CPU_NEON;
+        if (hwcap & HWCAP_ASIMDDP) bits |= CPU_ARM_DOTPROD;
+        if (hwcap2 & HWCAP2_AES) bits |= CPU_ARM_AES;
+        if (hwcap2 & HWCAP2_PMULL) bits |= CPU_ARM_PMULL;
+        if (hwcap2 & HWCAP2_SHA2) bits |= CPU_ARM_SHA2;
+        if (hwcap2 & HWCAP2_CRC32) bits |= CPU_ARM_CRC32;
+#endif
+
+        return bits;
+    }
+}
+
+const CpuFeatures& cpuFeatures() {
+    static const CpuFeatures features = { probe() };
+    return features;
+}
+
+size_t CpuFeatures::describe(char* out, size_t capacity) const {
+    if (capacity == 0) {
+        return 0;
+    }
+    size_t length = 0;
+    for (const auto& entry : FEATURE_NAMES) {
+        if (!has(entry.feature)) {
+            continue;
+        }
+        size_t nameLength = std::strlen(entry.name);
+        size_t needed = nameLength + (length > 0 ? 1 : 0);
+        if (length + needed >= capacity) {
+            break;
+        }
+        if (length > 0) {
+            out[length++] = ' ';
+        }
+        std::memcpy(out + length, entry.name, nameLength);
+        length += nameLength;
+    }
+    out[length] = '\0';
+    return length;
+}
+
+} // namespace noghresod
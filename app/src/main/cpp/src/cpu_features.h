@@ -0,0 +1,87 @@
+#ifndef NOGHRESOD_CPU_FEATURES_H
+#define NOGHRESOD_CPU_FEATURES_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace noghresod {
+
+/**
+ * CPU features the native kernels can dispatch on.
+ */
+enum CpuFeature : uint32_t {
+    // ARM (armeabi-v7a, arm64-v8a)
+    CPU_NEON = 1u << 0,
+    CPU_ARM_AES = 1u << 1,
+    CPU_ARM_PMULL = 1u << 2,
+    CPU_ARM_SHA2 = 1u << 3,
+    CPU_ARM_CRC32 = 1u << 4,
+    CPU_ARM_DOTPROD = 1u << 5,
+
+    // x86 (x86, x86_64)
+    CPU_SSE2 = 1u << 8,
+    CPU_SSSE3 = 1u << 9,
+    CPU_SSE41 = 1u << 10,
+    CPU_SSE42 = 1u << 11,
+    CPU_AVX2 = 1u << 12,
+    CPU_AESNI = 1u << 13,
+    CPU_PCLMUL = 1u << 14,
+};
+
+/**
+ * Features of the running CPU, probed once per process.
+ *
+ * ARM features come from the kernel (getauxval AT_HWCAP/AT_HWCAP2), x86
+ * features from CPUID with the OS support checks the compiler runtime does.
+ * JNI_OnLoad probes eagerly, so kernels never pay for it on a hot path.
+ */
+struct CpuFeatures {
+    uint32_t bits;
+
+    bool has(uint32_t features) const { return (bits & features) == features; }
+
+    /**
+     * Space-separated feature names, e.g. "neon aes pmull crc32".
+     * @return Characters written, excluding the NUL
+     */
+    size_t describe(char* out, size_t capacity) const;
+};
+
+const CpuFeatures& cpuFeatures();
+
+/**
+ * One implementation of a kernel.
+ *
+ * @param required Features the implementation needs (0 for portable code)
+ * @param fn Implementation, or nullptr when not compiled for this target
+ */
+template <typename Fn>
+struct DispatchEntry {
+    uint32_t required;
+    Fn fn;
+    const char* name;
+};
+
+/**
+ * Pick the first usable entry of a dispatch table.
+ *
+ * Tables list the fastest implementation first and end with a portable
+ * one (required = 0). Callers resolve once and keep the result:
+ *
+ *     static const auto& kernel = selectKernel(TABLE);
+ *     kernel.fn(...);
+ */
+template <typename Fn, size_t N>
+const DispatchEntry<Fn>& selectKernel(const DispatchEntry<Fn> (&table)[N]) {
+    const CpuFeatures& cpu = cpuFeatures();
+    for (const DispatchEntry<Fn>& entry : table) {
+        if (entry.fn != nullptr && cpu.has(entry.required)) {
+            return entry;
+        }
+    }
+    return table[N - 1];
+}
+
+} // namespace noghresod
+
+#endif // NOGHRESOD_CPU_FEATURES_H
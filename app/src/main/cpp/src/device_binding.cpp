@@ -0,0 +1,77 @@
+#include "device_binding.h"
+
+#include <cstring>
+#include "native_trace.h"
+
+#define LOG_TAG "NoghreSod_Keys"
+#include "native_log.h"
+
+namespace noghresod {
+
+namespace {
+    // Domain tag so the binding key never equals a plain hash of the inputs
+    const char KEY_DOMAIN[] = "noghresod-device-binding-v1";
+}
+
+DeviceKeyService& DeviceKeyService::instance() {
+    static DeviceKeyService service;
+    return service;
+}
+
+DeviceKeyService::DeviceKeyService() : region_(2 * KEY_SIZE) {}
+
+bool DeviceKeyService::derive(DeviceInputs& source) {
+    NOGHRESOD_TRACE_SCOPE("deviceKeyDerive");
+    SecureString inputs;
+    if (!source.collect(inputs)) {
+        LOGE("Failed to read device fingerprint");
+        secureWipe(inputs);
+        return false;
+    }
+
+    uint8_t digest[KEY_SIZE];
+    Sha256::hash(inputs.data(), inputs.size(), digest);
+
+    if (ready_ && std::memcmp(digest, region_.data() + KEY_SIZE, KEY_SIZE) == 0) {
+        secureWipe(inputs);
+        secureWipe(digest, sizeof(digest));
+        return false;
+    }
+
+    Sha256 kdf;
+    kdf.update(KEY_DOMAIN, sizeof(KEY_DOMAIN));
+    kdf.update(inputs.data(), inputs.size());
+    kdf.finish(region_.data());
+    std::memcpy(region_.data() + KEY_SIZE, digest, KEY_SIZE);
+
+    secureWipe(inputs);
+    secureWipe(digest, sizeof(digest));
+    ready_ = true;
+    return true;
+}
+
+SecureString DeviceKeyService::getKey(DeviceInputs& source) {
+    NOGHRESOD_TRACE_SCOPE("deviceKey");
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!region_.valid()) {
+        return "";
+    }
+    if (!ready_ && !derive(source)) {
+        return "";
+    }
+    return SecureString(reinterpret_cast<const char*>(region_.data()), KEY_SIZE);
+}
+
+bool DeviceKeyService::revalidate(DeviceInputs& source) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!region_.valid() || !ready_) {
+        return false;
+    }
+    bool changed = derive(source);
+    if (changed) {
+        LOGD("Device fingerprint changed - binding key re-derived");
+    }
+    return changed;
+}
+
+} // namespace noghresod
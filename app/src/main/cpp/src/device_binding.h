@@ -0,0 +1,71 @@
+#ifndef NOGHRESOD_DEVICE_BINDING_H
+#define NOGHRESOD_DEVICE_BINDING_H
+
+#include <mutex>
+#include <string>
+#include "secure_arena.h"
+#include "secure_memory.h"
+#include "sha256.h"
+
+namespace noghresod {
+
+/**
+ * Source of the device fingerprint. The Android library reads it from
+ * android.os.Build (jni/keys.cpp); host builds supply fixed values.
+ */
+class DeviceInputs {
+public:
+    virtual ~DeviceInputs() = default;
+
+    /**
+     * Append the fingerprint fields to [out], each followed by 0x1F so
+     * adjacent values cannot run together.
+     * @return false if the fields could not be read
+     */
+    virtual bool collect(SecureString& out) = 0;
+};
+
+/**
+ * Derives and caches the device-binding key used by the secret pipeline.
+ *
+ * The key is SHA-256 over a domain tag and the device fingerprint.
+ * Collecting the fingerprint costs several JNI round-trips, so the key is
+ * derived once and kept in a locked page together with a digest of its
+ * inputs. revalidate() re-reads the inputs off the hot path and re-derives
+ * only if they no longer match.
+ */
+class DeviceKeyService {
+public:
+    static const size_t KEY_SIZE = Sha256::DIGEST_SIZE;
+
+    static DeviceKeyService& instance();
+
+    /**
+     * Binding key as raw bytes, derived on first use.
+     * @return Empty string if the device identifiers could not be read
+     */
+    SecureString getKey(DeviceInputs& source);
+
+    /**
+     * Re-read the fingerprint inputs and re-derive the key if they changed.
+     * @return true if a previously derived key was replaced
+     */
+    bool revalidate(DeviceInputs& source);
+
+    DeviceKeyService(const DeviceKeyService&) = delete;
+    DeviceKeyService& operator=(const DeviceKeyService&) = delete;
+
+private:
+    DeviceKeyService();
+
+    bool derive(DeviceInputs& source);
+
+    std::mutex mutex_;
+    // [0, KEY_SIZE): binding key, [KEY_SIZE, 2 * KEY_SIZE): digest of inputs
+    LockedRegion region_;
+    bool ready_ = false;
+};
+
+} // namespace noghresod
+
+#endif // NOGHRESOD_DEVICE_BINDING_H
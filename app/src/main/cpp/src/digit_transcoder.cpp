@@ -0,0 +1,202 @@
+#include "digit_transcoder.h"
+
+#include "cpu_features.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define NOGHRESOD_DIGITS_X86 1
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define NOGHRESOD_DIGITS_NEON 1
+#endif
+
+namespace noghresod {
+
+namespace {
+    const uint16_t ZEROS[DIGIT_SCRIPT_COUNT] = { 0x0030, 0x06F0, 0x0660 };
+
+    /**
+     * The two scripts that are rewritten into [zero], as their digit zeros
+     * and the amount a digit of each moves by.
+     */
+    struct Sources {
+        uint16_t zero[DIGIT_SCRIPT_COUNT - 1];
+        uint16_t delta[DIGIT_SCRIPT_COUNT - 1];
+
+        explicit Sources(uint16_t target) {
+            size_t n = 0;
+            for (uint16_t source : ZEROS) {
+                if (source != target && n < DIGIT_SCRIPT_COUNT - 1) {
+                    zero[n] = source;
+                    delta[n] = static_cast<uint16_t>(target - source);
+                    n++;
+                }
+            }
+        }
+    };
+}
+
+uint16_t digitZero(DigitScript script) {
+    return ZEROS[static_cast<size_t>(script)];
+}
+
+namespace digit_kernels {
+
+bool scalar(uint16_t* chars, size_t length, uint16_t zero) {
+    bool changed = false;
+    for (size_t i = 0; i < length; i++) {
+        uint16_t c = chars[i];
+        for (uint16_t source : ZEROS) {
+            uint16_t digit = static_cast<uint16_t>(c - source);
+            if (digit < 10) {
+                c = static_cast<uint16_t>(zero + digit);
+                break;
+            }
+        }
+        changed |= c != chars[i];
+        chars[i] = c;
+    }
+    return changed;
+}
+
+// Every vector kernel does the same per lane: digit = c - sourceZero is
+// below 10 (unsigned) only for that source's digits, so the compare mask
+// selects which lanes get the source's delta added. Both sources are tested
+// against the original value; their ranges are disjoint, so at most one
+// delta applies and a rewritten digit is never rewritten again.
+namespace {
+#ifdef NOGHRESOD_DIGITS_X86
+    bool sse2Kernel(uint16_t* chars, size_t length, uint16_t zero) {
+        Sources sources(zero);
+        const __m128i zero0 = _mm_set1_epi16(static_cast<short>(sources.zero[0]));
+        const __m128i zero1 = _mm_set1_epi16(static_cast<short>(sources.zero[1]));
+        const __m128i delta0 = _mm_set1_epi16(static_cast<short>(sources.delta[0]));
+        const __m128i delta1 = _mm_set1_epi16(static_cast<short>(sources.delta[1]));
+        const __m128i nine = _mm_set1_epi16(9);
+        const __m128i none = _mm_setzero_si128();
+        __m128i changed = none;
+
+        size_t i = 0;
+        for (; i + 8 <= length; i += 8) {
+            __m128i* p = reinterpret_cast<__m128i*>(chars + i);
+            __m128i c = _mm_loadu_si128(p);
+            // SSE2 has no unsigned 16-bit compare: d <= 9 <=> saturating d - 9 == 0
+            __m128i in0 = _mm_cmpeq_epi16(_mm_subs_epu16(_mm_sub_epi16(c, zero0), nine), none);
+            __m128i in1 = _mm_cmpeq_epi16(_mm_subs_epu16(_mm_sub_epi16(c, zero1), nine), none);
+            __m128i add = _mm_or_si128(_mm_and_si128(in0, delta0), _mm_and_si128(in1, delta1));
+            changed = _mm_or_si128(changed, add);
+            _mm_storeu_si128(p, _mm_add_epi16(c, add));
+        }
+        bool any = _mm_movemask_epi8(_mm_cmpeq_epi16(changed, none)) != 0xFFFF;
+        return scalar(chars + i, length - i, zero) || any;
+    }
+
+    __attribute__((target("avx2")))
+    bool avx2Kernel(uint16_t* chars, size_t length, uint16_t zero) {
+        Sources sources(zero);
+        const __m256i zero0 = _mm256_set1_epi16(static_cast<short>(sources.zero[0]));
+        const __m256i zero1 = _mm256_set1_epi16(static_cast<short>(sources.zero[1]));
+        const __m256i delta0 = _mm256_set1_epi16(static_cast<short>(sources.delta[0]));
+        const __m256i delta1 = _mm256_set1_epi16(static_cast<short>(sources.delta[1]));
+        const __m256i nine = _mm256_set1_epi16(9);
+        const __m256i none = _mm256_setzero_si256();
+        __m256i changed = none;
+
+        size_t i = 0;
+        for (; i + 16 <= length; i += 16) {
+            __m256i* p = reinterpret_cast<__m256i*>(chars + i);
+            __m256i c = _mm256_loadu_si256(p);
+            __m256i in0 = _mm256_cmpeq_epi16(_mm256_subs_epu16(_mm256_sub_epi16(c, zero0), nine), none);
+            __m256i in1 = _mm256_cmpeq_epi16(_mm256_subs_epu16(_mm256_sub_epi16(c, zero1), nine), none);
+            __m256i add = _mm256_or_si256(_mm256_and_si256(in0, delta0), _mm256_and_si256(in1, delta1));
+            changed = _mm256_or_si256(changed, add);
+            _mm256_storeu_si256(p, _mm256_add_epi16(c, add));
+        }
+        bool any = !_mm256_testz_si256(changed, changed);
+        return scalar(chars + i, length - i, zero) || any;
+    }
+#endif
+
+#ifdef NOGHRESOD_DIGITS_NEON
+    bool neonKernel(uint16_t* chars, size_t length, uint16_t zero) {
+        Sources sources(zero);
+        const uint16x8_t zero0 = vdupq_n_u16(sources.zero[0]);
+        const uint16x8_t zero1 = vdupq_n_u16(sources.zero[1]);
+        const uint16x8_t delta0 = vdupq_n_u16(sources.delta[0]);
+        const uint16x8_t delta1 = vdupq_n_u16(sources.delta[1]);
+        const uint16x8_t ten = vdupq_n_u16(10);
+        uint16x8_t changed = vdupq_n_u16(0);
+
+        size_t i = 0;
+        for (; i + 8 <= length; i += 8) {
+            uint16x8_t c = vld1q_u16(chars + i);
+            uint16x8_t in0 = vcltq_u16(vsubq_u16(c, zero0), ten);
+            uint16x8_t in1 = vcltq_u16(vsubq_u16(c, zero1), ten);
+            uint16x8_t add = vorrq_u16(vandq_u16(in0, delta0), vandq_u16(in1, delta1));
+            changed = vorrq_u16(changed, add);
+            vst1q_u16(chars + i, vaddq_u16(c, add));
+        }
+        // No across-vector max on armeabi-v7a; fold the two halves instead
+        uint64x2_t halves = vreinterpretq_u64_u16(changed);
+        bool any = (vgetq_lane_u64(halves, 0) | vgetq_lane_u64(halves, 1)) != 0;
+        return scalar(chars + i, length - i, zero) || any;
+    }
+#endif
+}
+
+DigitFn sse2() {
+#ifdef NOGHRESOD_DIGITS_X86
+    return sse2Kernel;
+#else
+    return nullptr;
+#endif
+}
+
+DigitFn avx2() {
+#ifdef NOGHRESOD_DIGITS_X86
+    return avx2Kernel;
+#else
+    return nullptr;
+#endif
+}
+
+DigitFn neon() {
+#ifdef NOGHRESOD_DIGITS_NEON
+    return neonKernel;
+#else
+    return nullptr;
+#endif
+}
+
+} // namespace digit_kernels
+
+namespace {
+    using DigitEntry = DispatchEntry<digit_kernels::DigitFn>;
+
+    const DigitEntry& dispatch() {
+        // SSE2 is the baseline of every x86 Android ABI, so it needs no check
+        static const DigitEntry TABLE[] = {
+            { CPU_NEON, digit_kernels::neon(), "neon" },
+            { CPU_AVX2, digit_kernels::avx2(), "avx2" },
+            { 0, digit_kernels::sse2(), "sse2" },
+            { 0, digit_kernels::scalar, "scalar" },
+        };
+        static const DigitEntry& selected = selectKernel(TABLE);
+        return selected;
+    }
+}
+
+bool transcodeDigits(uint16_t* chars, size_t length, DigitScript target) {
+    if (length == 0) {
+        return false;
+    }
+    return dispatch().fn(chars, length, digitZero(target));
+}
+
+const char* digitKernelName() {
+    return dispatch().name;
+}
+
+} // namespace noghresod
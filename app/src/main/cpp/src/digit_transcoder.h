@@ -0,0 +1,64 @@
+#ifndef NOGHRESOD_DIGIT_TRANSCODER_H
+#define NOGHRESOD_DIGIT_TRANSCODER_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace noghresod {
+
+/**
+ * Decimal digit blocks of UTF-16 text. Values match NativeDigits.Script.
+ */
+enum class DigitScript : uint8_t {
+    LATIN = 0,          // U+0030..U+0039
+    PERSIAN = 1,        // U+06F0..U+06F9 (Extended Arabic-Indic)
+    ARABIC_INDIC = 2,   // U+0660..U+0669
+};
+
+const size_t DIGIT_SCRIPT_COUNT = 3;
+
+/**
+ * First code unit (digit zero) of [script].
+ */
+uint16_t digitZero(DigitScript script);
+
+/**
+ * Rewrite every Latin, Persian and Arabic-Indic digit of [chars] in place
+ * as the same digit of [target]; every other code unit is left untouched.
+ *
+ * One pass over the buffer whatever the source scripts are. The fastest
+ * kernel for the running CPU is picked from a dispatch table on first use
+ * (NEON on ARM, AVX2/SSE2 on x86, the scalar loop otherwise).
+ *
+ * @return Whether any code unit changed
+ */
+bool transcodeDigits(uint16_t* chars, size_t length, DigitScript target);
+
+/**
+ * Name of the kernel transcodeDigits() dispatches to ("neon", "avx2", "sse2" or "scalar").
+ */
+const char* digitKernelName();
+
+namespace digit_kernels {
+
+    /**
+     * @param zero digitZero() of the target script
+     */
+    using DigitFn = bool (*)(uint16_t* chars, size_t length, uint16_t zero);
+
+    // One code unit per step; also finishes the vector kernels' tails
+    bool scalar(uint16_t* chars, size_t length, uint16_t zero);
+
+    /**
+     * Kernels compiled into this build, or nullptr when the target has none.
+     * Availability on the running CPU is checked by transcodeDigits(), not here.
+     */
+    DigitFn sse2();
+    DigitFn avx2();
+    DigitFn neon();
+
+} // namespace digit_kernels
+
+} // namespace noghresod
+
+#endif // NOGHRESOD_DIGIT_TRANSCODER_H
@@ -0,0 +1,157 @@
+#include "encryption.h"
+
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include "aes_gcm.h"
+#include "native_trace.h"
+#include "secure_memory.h"
+
+using noghresod::AesGcm;
+using noghresod::LockedRegion;
+using noghresod::SecureString;
+
+namespace {
+
+    int base64Value(unsigned char c) {
+        if (c >= 'A' && c <= 'Z') return c - 'A';
+        if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+        if (c >= '0' && c <= '9') return c - '0' + 52;
+        if (c == '+') return 62;
+        if (c == '/') return 63;
+        return -1;
+    }
+
+    /**
+     * Single-entry cache of the expanded cipher for the last key used.
+     *
+     * The raw key and the AesGcm (round keys + GHASH tables) live in one
+     * locked page: [0, 64) holds the key, the cipher object follows.
+     */
+    class CipherCache {
+    public:
+        static CipherCache& instance() {
+            static CipherCache cache;
+            return cache;
+        }
+
+        /**
+         * Run [use] with a cipher for [key], expanding it only on a key change.
+         */
+        template <typename Use>
+        auto withCipher(const uint8_t* key, Use&& use) -> decltype(use(std::declval<const AesGcm&>())) {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            if (!region_.valid()) {
+                AesGcm cipher(key);
+                return use(cipher);
+            }
+
+            unsigned char* cachedKey = region_.data();
+            if (cipher_ == nullptr || std::memcmp(cachedKey, key, AesGcm::KEY_SIZE) != 0) {
+                NOGHRESOD_TRACE_SCOPE("aesKeyExpand");
+                reset();
+                std::memcpy(cachedKey, key, AesGcm::KEY_SIZE);
+                cipher_ = new (region_.data() + CIPHER_OFFSET) AesGcm(key);
+            }
+            return use(*cipher_);
+        }
+
+        void clear() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            reset();
+        }
+
+    private:
+        static const size_t CIPHER_OFFSET = 64;
+
+        CipherCache() : region_(CIPHER_OFFSET + sizeof(AesGcm)) {}
+
+        void reset() {
+            if (cipher_ != nullptr) {
+                cipher_->~AesGcm();
+                cipher_ = nullptr;
+            }
+            region_.wipe();
+        }
+
+        std::mutex mutex_;
+        LockedRegion region_;
+        AesGcm* cipher_ = nullptr;
+    };
+}
+
+SecureString base64Decode(const char* encoded, size_t size) {
+    NOGHRESOD_TRACE_SCOPE("base64Decode");
+    SecureString decoded;
+    decoded.reserve(size / 4 * 3);
+
+    uint32_t buffer = 0;
+    int bits = 0;
+    size_t padding = 0;
+
+    for (size_t i = 0; i < size; i++) {
+        unsigned char c = static_cast<unsigned char>(encoded[i]);
+        if (c == ' ' || c == '\n' || c == '\r' || c == '\t') {
+            continue;
+        }
+        if (c == '=') {
+            padding++;
+            continue;
+        }
+        int value = base64Value(c);
+        if (value < 0 || padding > 0) {
+            noghresod::secureWipe(decoded);
+            throw std::invalid_argument("Invalid Base64 input");
+        }
+
+        buffer = (buffer << 6) | static_cast<uint32_t>(value);
+        bits += 6;
+        if (bits >= 8) {
+            bits -= 8;
+            decoded.push_back(static_cast<char>((buffer >> bits) & 0xFF));
+        }
+    }
+
+    if (padding > 2 || bits >= 6) {
+        noghresod::secureWipe(decoded);
+        throw std::invalid_argument("Invalid Base64 padding");
+    }
+    return decoded;
+}
+
+SecureString aesDecrypt(const SecureString& payload, const SecureString& key) {
+    NOGHRESOD_TRACE_SCOPE("aesGcmDecrypt");
+    if (key.size() != AesGcm::KEY_SIZE) {
+        throw std::invalid_argument("AES-256-GCM key must be 32 bytes");
+    }
+    if (payload.size() < AesGcm::IV_SIZE + AesGcm::TAG_SIZE) {
+        throw std::invalid_argument("AES-256-GCM payload too short");
+    }
+
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(payload.data());
+    const uint8_t* iv = bytes;
+    const uint8_t* ciphertext = bytes + AesGcm::IV_SIZE;
+    size_t size = payload.size() - AesGcm::IV_SIZE - AesGcm::TAG_SIZE;
+    const uint8_t* tag = ciphertext + size;
+
+    SecureString plain(size, '\0');
+    bool ok = CipherCache::instance().withCipher(
+        reinterpret_cast<const uint8_t*>(key.data()),
+        [&](const AesGcm& cipher) {
+            return cipher.decrypt(iv, nullptr, 0, ciphertext, size, tag,
+                                  reinterpret_cast<uint8_t*>(&plain[0]));
+        });
+
+    if (!ok) {
+        throw std::runtime_error("AES-256-GCM authentication failed");
+    }
+    return plain;
+}
+
+void clearCipherCache() {
+    CipherCache::instance().clear();
+}
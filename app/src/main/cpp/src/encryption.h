@@ -0,0 +1,32 @@
+#ifndef NOGHRESOD_ENCRYPTION_H
+#define NOGHRESOD_ENCRYPTION_H
+
+#include <cstddef>
+#include "secure_arena.h"
+
+/**
+ * Decode standard (RFC 4648) Base64 into the secure arena. Whitespace is ignored.
+ * @throws std::invalid_argument on malformed input
+ */
+noghresod::SecureString base64Decode(const char* encoded, size_t size);
+
+/**
+ * Decrypt an AES-256-GCM payload laid out as IV (12) || ciphertext || tag (16).
+ *
+ * The expanded cipher for the most recent key is kept in a locked page, so
+ * repeated decryptions with the device key skip the key schedule.
+ *
+ * @param payload Raw (already Base64-decoded) payload
+ * @param key 32 raw key bytes
+ * @throws std::invalid_argument if the payload or key has the wrong size
+ * @throws std::runtime_error if authentication fails
+ */
+noghresod::SecureString aesDecrypt(const noghresod::SecureString& payload,
+                                   const noghresod::SecureString& key);
+
+/**
+ * Drop the cached cipher context and wipe its key material.
+ */
+void clearCipherCache();
+
+#endif // NOGHRESOD_ENCRYPTION_H
@@ -0,0 +1,162 @@
+#include "jalali.h"
+
+namespace noghresod {
+
+namespace jalali {
+
+namespace {
+    // Build-time only: the arithmetic of jalaali-js / PersianDateConverter.kt.
+    // Division truncates toward zero, as in Kotlin and JavaScript.
+
+    constexpr int32_t BREAKS[] = {
+        -61, 9, 38, 199, 426, 686, 756, 818, 1111, 1181, 1210,
+        1635, 2060, 2097, 2192, 2262, 2324, 2394, 2456, 3178
+    };
+
+    constexpr int32_t UNIX_EPOCH_JDN = 2440588;
+
+    /**
+     * Julian day number of a Gregorian date.
+     */
+    constexpr int32_t gregorianToJdn(int32_t gy, int32_t gm, int32_t gd) {
+        int32_t d = (gy + (gm - 8) / 6 + 100100) * 1461 / 4
+            + (153 * ((gm + 9) % 12) + 2) / 5 + gd - 34840408;
+        return d - (gy + 100100 + (gm - 8) / 6) / 100 * 3 / 4 + 752;
+    }
+
+    /**
+     * Julian day number of 1 Farvardin of [jy].
+     */
+    constexpr int32_t farvardinFirstJdn(int32_t jy) {
+        int32_t gy = jy + 621;
+        int32_t leapJ = -14;
+        int32_t jp = BREAKS[0];
+        int32_t jump = 0;
+        for (size_t i = 1; i < sizeof(BREAKS) / sizeof(BREAKS[0]); i++) {
+            int32_t jm = BREAKS[i];
+            jump = jm - jp;
+            if (jy < jm) {
+                break;
+            }
+            leapJ += jump / 33 * 8 + jump % 33 / 4;
+            jp = jm;
+        }
+        int32_t n = jy - jp;
+        leapJ += n / 33 * 8 + (n % 33 + 3) / 4;
+        if (jump % 33 == 4 && jump - n == 4) {
+            leapJ++;
+        }
+        int32_t leapG = gy / 4 - (gy / 100 + 1) * 3 / 4 - 150;
+        int32_t march = 20 + leapJ - leapG;
+        return gregorianToJdn(gy, 3, march);
+    }
+
+    const int32_t YEAR_COUNT = LAST_YEAR - FIRST_YEAR + 1;
+
+    struct YearTable {
+        // Days from 1 Farvardin FIRST_YEAR to 1 Farvardin of each year
+        int32_t offset[YEAR_COUNT + 1];
+        int32_t firstEpochDay;
+    };
+
+    constexpr YearTable buildTable() {
+        YearTable table{};
+        int32_t first = farvardinFirstJdn(FIRST_YEAR);
+        for (int32_t i = 0; i <= YEAR_COUNT; i++) {
+            table.offset[i] = farvardinFirstJdn(FIRST_YEAR + i) - first;
+        }
+        table.firstEpochDay = first - UNIX_EPOCH_JDN;
+        return table;
+    }
+
+    constexpr YearTable TABLE = buildTable();
+    constexpr int32_t SPAN = TABLE.offset[YEAR_COUNT];
+
+    // 33 years are 12053 days, so this never overshoots the year and is
+    // at most one short of it; checked for every day of the table here
+    constexpr uint32_t estimateYear(uint32_t rel) {
+        return rel * 33u / 12053u;
+    }
+
+    constexpr bool estimateWithinOneYear() {
+        for (int32_t year = 0; year < YEAR_COUNT; year++) {
+            for (int32_t rel = TABLE.offset[year]; rel < TABLE.offset[year + 1]; rel++) {
+                uint32_t estimate = estimateYear(static_cast<uint32_t>(rel));
+                if (estimate != static_cast<uint32_t>(year) && estimate + 1 != static_cast<uint32_t>(year)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    static_assert(TABLE.firstEpochDay == -17818, "1 Farvardin 1300 is 1921-03-21");
+    static_assert(TABLE.firstEpochDay + TABLE.offset[1403 - FIRST_YEAR] == 19802,
+                  "1 Farvardin 1403 is 2024-03-20");
+    static_assert(estimateWithinOneYear(), "one correction step finds every year");
+
+    /**
+     * Pack the date [rel] days after 1 Farvardin FIRST_YEAR; rel < SPAN.
+     */
+    inline uint32_t packRelative(uint32_t rel) {
+        uint32_t index = estimateYear(rel);
+        index += rel >= static_cast<uint32_t>(TABLE.offset[index + 1]) ? 1 : 0;
+        uint32_t dayOfYear = rel - static_cast<uint32_t>(TABLE.offset[index]);
+
+        // Six 31-day months, then 30-day ones; both halves are computed and
+        // one is selected, so month boundaries cost no branch
+        uint32_t late = dayOfYear >= 186 ? 1 : 0;
+        uint32_t lateDay = dayOfYear - 186 * late;
+        uint32_t month = late != 0 ? 7 + lateDay / 30 : 1 + dayOfYear / 31;
+        uint32_t day = late != 0 ? 1 + lateDay % 30 : 1 + dayOfYear % 31;
+        // 1 Farvardin FIRST_YEAR was a Monday
+        uint32_t weekday = (rel + 2) % 7;
+
+        return (static_cast<uint32_t>(FIRST_YEAR) + index) << PACKED_YEAR_SHIFT
+            | month << PACKED_MONTH_SHIFT
+            | day << PACKED_DAY_SHIFT
+            | weekday;
+    }
+
+    inline int64_t floorDiv(int64_t value, int64_t divisor) {
+        int64_t quotient = value / divisor;
+        return quotient - (value % divisor < 0 ? 1 : 0);
+    }
+}
+
+uint32_t fromEpochDay(int64_t epochDay) {
+    int64_t rel = epochDay - TABLE.firstEpochDay;
+    if (rel < 0 || rel >= SPAN) {
+        return 0;
+    }
+    return packRelative(static_cast<uint32_t>(rel));
+}
+
+bool toEpochDay(int32_t year, int32_t month, int32_t day, int64_t* epochDay) {
+    if (year < FIRST_YEAR || year > LAST_YEAR || month < 1 || month > 12 || day < 1) {
+        return false;
+    }
+    int32_t index = year - FIRST_YEAR;
+    int32_t yearLength = TABLE.offset[index + 1] - TABLE.offset[index];
+    int32_t monthLength = month <= 6 ? 31 : month <= 11 ? 30 : yearLength - 336;
+    if (day > monthLength) {
+        return false;
+    }
+    int32_t dayOfYear = month <= 6 ? (month - 1) * 31 : 186 + (month - 7) * 30;
+    *epochDay = static_cast<int64_t>(TABLE.firstEpochDay) + TABLE.offset[index] + dayOfYear + day - 1;
+    return true;
+}
+
+void fromEpochMillis(const int64_t* millis, size_t count, int64_t offsetMillis, uint32_t* out) {
+    for (size_t i = 0; i < count; i++) {
+        int64_t rel = floorDiv(millis[i] + offsetMillis, MILLIS_PER_DAY) - TABLE.firstEpochDay;
+        // Out-of-range days are packed as day 0 and masked to 0, not branched around
+        uint32_t inRange = static_cast<uint32_t>(rel >= 0) & static_cast<uint32_t>(rel < SPAN);
+        uint32_t packed = packRelative(inRange != 0 ? static_cast<uint32_t>(rel) : 0);
+        out[i] = packed & (0u - inRange);
+    }
+}
+
+} // namespace jalali
+
+} // namespace noghresod
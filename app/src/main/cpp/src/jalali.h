@@ -0,0 +1,57 @@
+#ifndef NOGHRESOD_JALALI_H
+#define NOGHRESOD_JALALI_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace noghresod {
+
+/**
+ * Jalali (Solar Hijri) calendar over a precomputed year table.
+ *
+ * The table holds the epoch day (days since 1970-01-01) of 1 Farvardin of
+ * every year from FIRST_YEAR to LAST_YEAR + 1, computed at compile time
+ * with the 33-year break-point rules PersianDateConverter.kt uses. A
+ * conversion is then an estimate of the year, two table compares to
+ * correct it, and month/day arithmetic selected without branches.
+ *
+ * Dates are packed into one uint32 (PACKED_* below), with 0 reserved for
+ * days outside the table.
+ */
+namespace jalali {
+
+    const int32_t FIRST_YEAR = 1300;    // 1921-03-21
+    const int32_t LAST_YEAR = 1500;     // ends 2122-03-20
+
+    // Packed layout: year << 12 | month << 8 | day << 3 | weekday
+    const uint32_t PACKED_YEAR_SHIFT = 12;
+    const uint32_t PACKED_MONTH_SHIFT = 8;
+    const uint32_t PACKED_DAY_SHIFT = 3;
+    const uint32_t PACKED_WEEKDAY_MASK = 0x7;   // 0 = Saturday (شنبه) ... 6 = Friday
+
+    const int64_t MILLIS_PER_DAY = 86400000;
+
+    /**
+     * @return Packed date, or 0 if [epochDay] is outside the table
+     */
+    uint32_t fromEpochDay(int64_t epochDay);
+
+    /**
+     * Epoch day of a Jalali date.
+     * @return false if the date is outside the table or invalid
+     */
+    bool toEpochDay(int32_t year, int32_t month, int32_t day, int64_t* epochDay);
+
+    /**
+     * Convert [count] instants to packed dates in one pass.
+     *
+     * @param offsetMillis Added to every instant first: the zone's UTC offset
+     * @param out Packed date per instant, 0 outside the table
+     */
+    void fromEpochMillis(const int64_t* millis, size_t count, int64_t offsetMillis, uint32_t* out);
+
+} // namespace jalali
+
+} // namespace noghresod
+
+#endif // NOGHRESOD_JALALI_H
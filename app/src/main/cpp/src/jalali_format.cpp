@@ -0,0 +1,218 @@
+#include "jalali_format.h"
+
+#include <cstring>
+#include "jalali.h"
+
+namespace noghresod {
+
+namespace jalali {
+
+namespace {
+    enum DateField : uint8_t {
+        LITERAL,
+        YEAR,
+        YEAR_SHORT,
+        MONTH,
+        MONTH_PADDED,
+        MONTH_NAME,
+        DAY,
+        DAY_PADDED,
+        WEEKDAY_NAME,
+        HOUR,
+        HOUR_PADDED,
+        MINUTE,
+        MINUTE_PADDED,
+        SECOND,
+        SECOND_PADDED,
+    };
+
+    struct Run {
+        const char16_t* units;
+        size_t length;
+    };
+
+    template <size_t N>
+    constexpr Run run(const char16_t (&units)[N]) {
+        return { units, N - 1 };
+    }
+
+    const Run MONTH_NAMES[] = {
+        run(u"فروردین"), run(u"اردیبهشت"), run(u"خرداد"), run(u"تیر"),
+        run(u"مرداد"), run(u"شهریور"), run(u"مهر"), run(u"آبان"),
+        run(u"آذر"), run(u"دی"), run(u"بهمن"), run(u"اسفند"),
+    };
+
+    // From Saturday, as packed weekdays count; U+200C is the zero-width non-joiner
+    const Run WEEKDAY_NAMES[] = {
+        run(u"شنبه"), run(u"یکشنبه"), run(u"دوشنبه"), run(u"سه\u200Cشنبه"),
+        run(u"چهارشنبه"), run(u"پنج\u200Cشنبه"), run(u"جمعه"),
+    };
+
+    // اردیبهشت, چهارشنبه and پنج‌شنبه
+    const size_t MAX_NAME_LENGTH = 8;
+    static_assert(MAX_FORMATTED_DATE == MAX_DATE_PATTERN * MAX_NAME_LENGTH, "no field is longer than a name");
+
+    const int32_t MILLIS_PER_SECOND = 1000;
+
+    bool isAsciiLetter(uint16_t unit) {
+        return (unit >= 'a' && unit <= 'z') || (unit >= 'A' && unit <= 'Z');
+    }
+
+    /**
+     * Field of [count] repeats of [letter], or LITERAL if the letter is reserved.
+     */
+    DateField fieldOf(uint16_t letter, size_t count) {
+        switch (letter) {
+            case 'y': return count == 2 ? YEAR_SHORT : YEAR;
+            case 'M': return count == 1 ? MONTH : count == 2 ? MONTH_PADDED : MONTH_NAME;
+            case 'd': return count == 1 ? DAY : DAY_PADDED;
+            case 'E': return WEEKDAY_NAME;
+            case 'H': return count == 1 ? HOUR : HOUR_PADDED;
+            case 'm': return count == 1 ? MINUTE : MINUTE_PADDED;
+            case 's': return count == 1 ? SECOND : SECOND_PADDED;
+            default: return LITERAL;
+        }
+    }
+
+    size_t maxLengthOf(DateField field) {
+        switch (field) {
+            case YEAR: return 4;
+            case MONTH_NAME:
+            case WEEKDAY_NAME: return MAX_NAME_LENGTH;
+            default: return 2;
+        }
+    }
+
+    /**
+     * Append [unit] to the pattern's trailing literal run, starting one if needed.
+     */
+    void appendLiteral(DatePattern* pattern, size_t* literalCount, uint16_t unit) {
+        if (pattern->tokenCount == 0 || pattern->tokens[pattern->tokenCount - 1].field != LITERAL) {
+            pattern->tokens[pattern->tokenCount++] = { LITERAL, static_cast<uint8_t>(*literalCount), 0 };
+        }
+        pattern->tokens[pattern->tokenCount - 1].length++;
+        pattern->literals[(*literalCount)++] = unit;
+        pattern->maxLength++;
+    }
+
+    inline uint16_t* writeNumber(uint16_t* out, uint32_t value, uint16_t zero, bool padded) {
+        if (padded || value >= 10) {
+            *out++ = static_cast<uint16_t>(zero + value / 10 % 10);
+        }
+        *out++ = static_cast<uint16_t>(zero + value % 10);
+        return out;
+    }
+
+    inline uint16_t* writeRun(uint16_t* out, const Run& run) {
+        std::memcpy(out, run.units, run.length * sizeof(uint16_t));
+        return out + run.length;
+    }
+
+    inline int64_t floorDiv(int64_t value, int64_t divisor) {
+        int64_t quotient = value / divisor;
+        return quotient - (value % divisor < 0 ? 1 : 0);
+    }
+}
+
+bool compileDatePattern(const uint16_t* pattern, size_t length, DatePattern* out) {
+    if (length > MAX_DATE_PATTERN) {
+        return false;
+    }
+    out->tokenCount = 0;
+    out->maxLength = 0;
+    size_t literalCount = 0;
+
+    bool quoted = false;
+    for (size_t i = 0; i < length;) {
+        uint16_t unit = pattern[i];
+        if (unit == '\'') {
+            // '' is a quote, inside or outside quoted text
+            if (i + 1 < length && pattern[i + 1] == '\'') {
+                appendLiteral(out, &literalCount, unit);
+                i += 2;
+            } else {
+                quoted = !quoted;
+                i++;
+            }
+            continue;
+        }
+        if (quoted || !isAsciiLetter(unit)) {
+            appendLiteral(out, &literalCount, unit);
+            i++;
+            continue;
+        }
+
+        size_t count = 1;
+        while (i + count < length && pattern[i + count] == unit) {
+            count++;
+        }
+        DateField field = fieldOf(unit, count);
+        if (field == LITERAL) {
+            return false;
+        }
+        out->tokens[out->tokenCount++] = { field, 0, 0 };
+        out->maxLength += maxLengthOf(field);
+        i += count;
+    }
+    return !quoted;
+}
+
+size_t formatDate(uint32_t packedDate, int32_t millisOfDay, const DatePattern& pattern,
+                  uint32_t flags, uint16_t* out) {
+    const uint16_t zero = (flags & DATE_LATIN) != 0 ? 0x0030 : 0x06F0;
+    const uint32_t year = packedDate >> PACKED_YEAR_SHIFT;
+    const uint32_t month = packedDate >> PACKED_MONTH_SHIFT & 0xF;
+    const uint32_t day = packedDate >> PACKED_DAY_SHIFT & 0x1F;
+    const uint32_t seconds = static_cast<uint32_t>(millisOfDay / MILLIS_PER_SECOND);
+
+    uint16_t* p = out;
+    for (size_t i = 0; i < pattern.tokenCount; i++) {
+        const DatePattern::Token& token = pattern.tokens[i];
+        switch (token.field) {
+            case LITERAL:
+                std::memcpy(p, pattern.literals + token.start, token.length * sizeof(uint16_t));
+                p += token.length;
+                break;
+            case YEAR:
+                p = writeNumber(p, year / 100 % 100, zero, true);
+                p = writeNumber(p, year % 100, zero, true);
+                break;
+            case YEAR_SHORT: p = writeNumber(p, year % 100, zero, true); break;
+            case MONTH: p = writeNumber(p, month, zero, false); break;
+            case MONTH_PADDED: p = writeNumber(p, month, zero, true); break;
+            case MONTH_NAME: p = writeRun(p, MONTH_NAMES[month - 1]); break;
+            case DAY: p = writeNumber(p, day, zero, false); break;
+            case DAY_PADDED: p = writeNumber(p, day, zero, true); break;
+            case WEEKDAY_NAME: p = writeRun(p, WEEKDAY_NAMES[packedDate & PACKED_WEEKDAY_MASK]); break;
+            case HOUR: p = writeNumber(p, seconds / 3600, zero, false); break;
+            case HOUR_PADDED: p = writeNumber(p, seconds / 3600, zero, true); break;
+            case MINUTE: p = writeNumber(p, seconds / 60 % 60, zero, false); break;
+            case MINUTE_PADDED: p = writeNumber(p, seconds / 60 % 60, zero, true); break;
+            case SECOND: p = writeNumber(p, seconds % 60, zero, false); break;
+            case SECOND_PADDED: p = writeNumber(p, seconds % 60, zero, true); break;
+        }
+    }
+    return static_cast<size_t>(p - out);
+}
+
+size_t formatDates(const int64_t* millis, size_t count, int64_t offsetMillis,
+                   const DatePattern& pattern, uint32_t flags,
+                   uint16_t* out, size_t capacity, int32_t* ends) {
+    size_t position = 0;
+    for (size_t i = 0; i < count; i++) {
+        int64_t local = millis[i] + offsetMillis;
+        int64_t epochDay = floorDiv(local, MILLIS_PER_DAY);
+        uint32_t packed = fromEpochDay(epochDay);
+        if (packed == 0 || capacity - position < pattern.maxLength) {
+            return i;
+        }
+        int32_t millisOfDay = static_cast<int32_t>(local - epochDay * MILLIS_PER_DAY);
+        position += formatDate(packed, millisOfDay, pattern, flags, out + position);
+        ends[i] = static_cast<int32_t>(position);
+    }
+    return count;
+}
+
+} // namespace jalali
+
+} // namespace noghresod
@@ -0,0 +1,82 @@
+#ifndef NOGHRESOD_JALALI_FORMAT_H
+#define NOGHRESOD_JALALI_FORMAT_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace noghresod {
+
+namespace jalali {
+
+/**
+ * Options of formatDate(). Values match NativeDateFormatter.kt.
+ */
+enum DateFormatFlags : uint32_t {
+    // ASCII digits instead of Persian ones
+    DATE_LATIN = 1u << 0,
+};
+
+// Longest pattern accepted, in UTF-16 units
+const size_t MAX_DATE_PATTERN = 64;
+// Longest output of any pattern: a weekday name for every unit ("E")
+const size_t MAX_FORMATTED_DATE = MAX_DATE_PATTERN * 8;
+
+/**
+ * A date pattern split into fields and literal runs once, so a batch of
+ * dates formats without parsing it again.
+ *
+ *   yyyy, y  year, four digits     yy    year, last two digits
+ *   MMMM     month name            MM, M month, padded / plain
+ *   EEEE     weekday name          dd, d day, padded / plain
+ *   HH, H    hour (0-23)           mm, m minute       ss, s second
+ *
+ * Any count of M from three up gives the name, as does any count of E.
+ * Text inside '...' is literal ('' is a quote); other ASCII letters are
+ * reserved and make the pattern invalid. Everything else is literal.
+ */
+struct DatePattern {
+    struct Token {
+        uint8_t field;      // DateField in jalali_format.cpp
+        uint8_t start;      // literal runs: offset into literals
+        uint8_t length;
+    };
+
+    Token tokens[MAX_DATE_PATTERN];
+    size_t tokenCount;
+    uint16_t literals[MAX_DATE_PATTERN];
+    // Longest output of one date, in UTF-16 units
+    size_t maxLength;
+};
+
+/**
+ * @return false if [pattern] is longer than MAX_DATE_PATTERN or invalid
+ */
+bool compileDatePattern(const uint16_t* pattern, size_t length, DatePattern* out);
+
+/**
+ * Write one date (packed as by fromEpochDay(), not 0) and time of day.
+ * Month and weekday names are copied from pre-encoded UTF-16 runs.
+ *
+ * @param out Room for pattern.maxLength units
+ * @return Units written
+ */
+size_t formatDate(uint32_t packedDate, int32_t millisOfDay, const DatePattern& pattern,
+                  uint32_t flags, uint16_t* out);
+
+/**
+ * Format [count] instants back to back into [out]; instant i ends at ends[i].
+ *
+ * @param offsetMillis Added to every instant first: the zone's UTC offset
+ * @param capacity Units available in [out]
+ * @return Instants formatted; fewer than [count] when [out] runs out of
+ *         room or an instant falls outside the year table
+ */
+size_t formatDates(const int64_t* millis, size_t count, int64_t offsetMillis,
+                   const DatePattern& pattern, uint32_t flags,
+                   uint16_t* out, size_t capacity, int32_t* ends);
+
+} // namespace jalali
+
+} // namespace noghresod
+
+#endif // NOGHRESOD_JALALI_FORMAT_H
@@ -0,0 +1,227 @@
+#include "local_crypto.h"
+
+#include <cerrno>
+#include <cstring>
+#include <new>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+#include "native_trace.h"
+#include "obfuscation.h"
+#include "sha256.h"
+
+#define LOG_TAG "NoghreSod_Keys"
+#include "native_log.h"
+
+namespace noghresod {
+
+namespace {
+    // TODO: Generate a strong encryption key
+    // Use: openssl rand -base64 32
+    constexpr auto ENCRYPTION_KEY = NOGHRESOD_OBFUSCATE("YourStrongEncryptionKeyHere32BytesBase64");
+
+    // Domain tag so the local-data key is not a plain hash of the material
+    const char KEY_DOMAIN[] = "noghresod-local-data-v1";
+
+    const uint8_t MAGIC[4] = { 'N', 'S', 'E', '1' };
+
+    bool randomBytes(uint8_t* out, size_t size) {
+        int fd = open("/dev/urandom", O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            return false;
+        }
+        size_t done = 0;
+        while (done < size) {
+            ssize_t n = read(fd, out + done, size - done);
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            if (n <= 0) {
+                break;
+            }
+            done += static_cast<size_t>(n);
+        }
+        close(fd);
+        return done == size;
+    }
+
+    /**
+     * Fill [buffer] from [fd] until it is full or the input ends.
+     * @return Bytes read, or -1 on error
+     */
+    ssize_t readFully(int fd, uint8_t* buffer, size_t size) {
+        size_t done = 0;
+        while (done < size) {
+            ssize_t n = read(fd, buffer + done, size - done);
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            if (n < 0) {
+                return -1;
+            }
+            if (n == 0) {
+                break;
+            }
+            done += static_cast<size_t>(n);
+        }
+        return static_cast<ssize_t>(done);
+    }
+
+    bool writeFully(int fd, const uint8_t* data, size_t size) {
+        while (size > 0) {
+            ssize_t n = write(fd, data, size);
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            if (n <= 0) {
+                return false;
+            }
+            data += n;
+            size -= static_cast<size_t>(n);
+        }
+        return true;
+    }
+}
+
+LocalDataCipher& LocalDataCipher::instance() {
+    static LocalDataCipher cipher;
+    return cipher;
+}
+
+LocalDataCipher::LocalDataCipher() : region_(sizeof(AesGcm)) {
+    if (!region_.valid()) {
+        LOGE("Local data key region unavailable - native encryption disabled");
+    }
+}
+
+const AesGcm* LocalDataCipher::cipher() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (cipher_ == nullptr && region_.valid()) {
+        NOGHRESOD_TRACE_SCOPE("localDataKeyDerive");
+        uint8_t key[AesGcm::KEY_SIZE];
+        {
+            auto material = ENCRYPTION_KEY.reveal();
+            Sha256 sha;
+            sha.update(KEY_DOMAIN, sizeof(KEY_DOMAIN));
+            sha.update(material.c_str(), material.size());
+            sha.finish(key);
+        }
+        cipher_ = new (region_.data()) AesGcm(key);
+        secureWipe(key, sizeof(key));
+    }
+    return cipher_;
+}
+
+GcmStream* LocalDataCipher::beginEncrypt(uint8_t* header) {
+    const AesGcm* gcm = cipher();
+    if (gcm == nullptr) {
+        return nullptr;
+    }
+
+    std::memcpy(header, MAGIC, sizeof(MAGIC));
+    if (!randomBytes(header + sizeof(MAGIC), AesGcm::IV_SIZE)) {
+        LOGE("No randomness available for the IV");
+        return nullptr;
+    }
+
+    GcmStream* stream = new GcmStream(*gcm, header + sizeof(MAGIC), GcmStream::Mode::ENCRYPT);
+    stream->updateAad(header, HEADER_SIZE);
+    return stream;
+}
+
+GcmStream* LocalDataCipher::beginDecrypt(const uint8_t* header) {
+    const AesGcm* gcm = cipher();
+    if (gcm == nullptr || std::memcmp(header, MAGIC, sizeof(MAGIC)) != 0) {
+        return nullptr;
+    }
+
+    GcmStream* stream = new GcmStream(*gcm, header + sizeof(MAGIC), GcmStream::Mode::DECRYPT);
+    stream->updateAad(header, HEADER_SIZE);
+    return stream;
+}
+
+bool LocalDataCipher::encryptFd(int inFd, int outFd) {
+    NOGHRESOD_TRACE_SCOPE("LocalDataCipher.encryptFd");
+    uint8_t header[HEADER_SIZE];
+    GcmStream* stream = beginEncrypt(header);
+    if (stream == nullptr) {
+        return false;
+    }
+
+    std::vector<uint8_t> buffer(CHUNK_SIZE);
+    bool ok = writeFully(outFd, header, HEADER_SIZE);
+    while (ok) {
+        ssize_t n = readFully(inFd, buffer.data(), buffer.size());
+        if (n < 0) {
+            ok = false;
+            break;
+        }
+        if (n == 0) {
+            break;
+        }
+        stream->update(buffer.data(), static_cast<size_t>(n), buffer.data());
+        ok = writeFully(outFd, buffer.data(), static_cast<size_t>(n));
+    }
+
+    if (ok) {
+        uint8_t tag[TAG_SIZE];
+        stream->finish(tag);
+        ok = writeFully(outFd, tag, TAG_SIZE);
+    }
+
+    delete stream;
+    secureWipe(buffer.data(), buffer.size());
+    return ok;
+}
+
+bool LocalDataCipher::decryptFd(int inFd, int outFd) {
+    NOGHRESOD_TRACE_SCOPE("LocalDataCipher.decryptFd");
+    uint8_t header[HEADER_SIZE];
+    if (readFully(inFd, header, HEADER_SIZE) != static_cast<ssize_t>(HEADER_SIZE)) {
+        return false;
+    }
+    GcmStream* stream = beginDecrypt(header);
+    if (stream == nullptr) {
+        return false;
+    }
+
+    // The last TAG_SIZE bytes of the input are the tag, so always hold back
+    // that many bytes until the input ends
+    std::vector<uint8_t> buffer(CHUNK_SIZE + TAG_SIZE);
+    size_t held = 0;
+    bool ok = true;
+    while (true) {
+        ssize_t n = readFully(inFd, buffer.data() + held, CHUNK_SIZE);
+        if (n < 0) {
+            ok = false;
+            break;
+        }
+        size_t available = held + static_cast<size_t>(n);
+        if (available > TAG_SIZE) {
+            size_t body = available - TAG_SIZE;
+            stream->update(buffer.data(), body, buffer.data());
+            if (!writeFully(outFd, buffer.data(), body)) {
+                ok = false;
+                break;
+            }
+            std::memmove(buffer.data(), buffer.data() + body, TAG_SIZE);
+            held = TAG_SIZE;
+        } else {
+            held = available;
+        }
+        if (n == 0) {
+            break;
+        }
+    }
+
+    ok = ok && held == TAG_SIZE && stream->verify(buffer.data());
+    delete stream;
+    secureWipe(buffer.data(), buffer.size());
+
+    if (!ok && ftruncate(outFd, 0) != 0) {
+        LOGE("Could not discard unauthenticated output");
+    }
+    return ok;
+}
+
+} // namespace noghresod
@@ -0,0 +1,77 @@
+#ifndef NOGHRESOD_LOCAL_CRYPTO_H
+#define NOGHRESOD_LOCAL_CRYPTO_H
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include "aes_gcm.h"
+#include "secure_memory.h"
+
+namespace noghresod {
+
+/**
+ * AES-256-GCM for local payloads (Room exports, cached responses, log files)
+ * under the app's local-data key.
+ *
+ * The key is derived from the obfuscated material in native code and only
+ * ever exists as an expanded AesGcm inside a locked page; nothing key-related
+ * is returned to Java.
+ *
+ * Container format:
+ *   header (MAGIC "NSE1" || 12-byte random IV) || ciphertext || 16-byte tag
+ * The header is authenticated as AAD. When decrypting in chunks, plaintext
+ * is released before the tag is checked and must be discarded if
+ * finish fails.
+ */
+class LocalDataCipher {
+public:
+    static const size_t HEADER_SIZE = 4 + AesGcm::IV_SIZE;
+    static const size_t TAG_SIZE = AesGcm::TAG_SIZE;
+    // Read/write granularity for the fd paths
+    static const size_t CHUNK_SIZE = 64 * 1024;
+
+    static LocalDataCipher& instance();
+
+    /**
+     * Expanded cipher for the local-data key, derived on first use.
+     * @return nullptr if the key region could not be mapped
+     */
+    const AesGcm* cipher();
+
+    /**
+     * Start encrypting: writes a fresh header into [header].
+     * @return nullptr if no cipher or randomness is available
+     */
+    GcmStream* beginEncrypt(uint8_t* header);
+
+    /**
+     * Start decrypting a payload whose first HEADER_SIZE bytes are [header].
+     * @return nullptr if the header is not ours
+     */
+    GcmStream* beginDecrypt(const uint8_t* header);
+
+    /**
+     * Encrypt everything readable from [inFd] into [outFd] as one container.
+     */
+    bool encryptFd(int inFd, int outFd);
+
+    /**
+     * Decrypt a container from [inFd] into [outFd]. On failure whatever was
+     * written to [outFd] is truncated away where the descriptor allows it.
+     */
+    bool decryptFd(int inFd, int outFd);
+
+    LocalDataCipher(const LocalDataCipher&) = delete;
+    LocalDataCipher& operator=(const LocalDataCipher&) = delete;
+
+private:
+    LocalDataCipher();
+
+    std::mutex mutex_;
+    LockedRegion region_;
+    const AesGcm* cipher_ = nullptr;
+};
+
+} // namespace noghresod
+
+#endif // NOGHRESOD_LOCAL_CRYPTO_H
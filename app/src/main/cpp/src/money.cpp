@@ -0,0 +1,141 @@
+#include "money.h"
+
+namespace noghresod {
+
+namespace money {
+
+namespace {
+    /**
+     * n / d for n >= 0, d > 0, rounded with MODE. Branch-free once MODE is fixed.
+     */
+    template <RoundingMode MODE>
+    inline uint64_t divideRounded(uint64_t n, uint64_t d) {
+        // n < 2^63 and d < 2^63, so neither n + d nor 2r can wrap
+        if constexpr (MODE == RoundingMode::HALF_UP) {
+            // 2r >= d, i.e. r >= ceil(d / 2), without the remainder
+            return (n + d / 2) / d;
+        } else if constexpr (MODE == RoundingMode::HALF_EVEN) {
+            uint64_t q = n / d;
+            uint64_t r = n - q * d;
+            return q + (2 * r > d || (2 * r == d && (q & 1) != 0) ? 1 : 0);
+        } else if constexpr (MODE == RoundingMode::DOWN) {
+            return n / d;
+        } else {
+            return (n + d - 1) / d;
+        }
+    }
+
+    template <RoundingMode MODE>
+    inline int64_t mulDivNonNegative(int64_t value, int64_t numerator, int64_t denominator) {
+        return static_cast<int64_t>(divideRounded<MODE>(static_cast<uint64_t>(value * numerator),
+                                                        static_cast<uint64_t>(denominator)));
+    }
+
+    inline bool validRate(int32_t bps) {
+        return bps >= 0 && bps <= BASIS_POINTS;
+    }
+
+    inline bool validInputs(int64_t weightMg, int64_t pricePerGram, int64_t wage,
+                            int32_t discountBps, int32_t taxBps) {
+        return weightMg >= 0 && weightMg <= MAX_WEIGHT_MG &&
+               pricePerGram >= 0 && pricePerGram <= MAX_PRICE_PER_GRAM &&
+               wage >= 0 && wage <= MAX_WAGE &&
+               validRate(discountBps) && validRate(taxBps);
+    }
+
+    template <RoundingMode MODE>
+    inline PriceBreakdown price(int64_t weightMg, int64_t pricePerGram, int64_t wage,
+                                int32_t discountBps, int32_t taxBps) {
+        PriceBreakdown out;
+        out.metal = mulDivNonNegative<MODE>(weightMg, pricePerGram, MILLIGRAMS_PER_GRAM);
+        out.wage = wage;
+        int64_t subtotal = out.metal + wage;
+        out.discount = mulDivNonNegative<MODE>(subtotal, discountBps, BASIS_POINTS);
+        int64_t discounted = subtotal - out.discount;
+        out.tax = mulDivNonNegative<MODE>(discounted, taxBps, BASIS_POINTS);
+        out.total = discounted + out.tax;
+        return out;
+    }
+
+    template <RoundingMode MODE>
+    size_t priceAll(const int64_t* weightMg, const int64_t* wage, const int32_t* discountBps,
+                    size_t count, int64_t pricePerGram, int32_t taxBps, int64_t* totals) {
+        // Bounds first, so the pricing loop below has no early exit
+        size_t valid = 0;
+        if (pricePerGram >= 0 && pricePerGram <= MAX_PRICE_PER_GRAM && validRate(taxBps)) {
+            while (valid < count &&
+                   validInputs(weightMg[valid], pricePerGram, wage[valid],
+                               discountBps != nullptr ? discountBps[valid] : 0, taxBps)) {
+                valid++;
+            }
+        }
+        if (discountBps != nullptr) {
+            for (size_t i = 0; i < valid; i++) {
+                totals[i] = price<MODE>(weightMg[i], pricePerGram, wage[i], discountBps[i], taxBps).total;
+            }
+        } else {
+            for (size_t i = 0; i < valid; i++) {
+                totals[i] = price<MODE>(weightMg[i], pricePerGram, wage[i], 0, taxBps).total;
+            }
+        }
+        return valid;
+    }
+}
+
+int64_t mulDiv(int64_t value, int64_t numerator, int64_t denominator, RoundingMode mode) {
+    int64_t product = value * numerator;
+    // Unsigned negation, so the magnitude of any product is representable
+    uint64_t magnitude = product < 0 ? 0 - static_cast<uint64_t>(product) : static_cast<uint64_t>(product);
+    uint64_t d = static_cast<uint64_t>(denominator);
+    uint64_t rounded;
+    switch (mode) {
+        case RoundingMode::HALF_UP: rounded = divideRounded<RoundingMode::HALF_UP>(magnitude, d); break;
+        case RoundingMode::HALF_EVEN: rounded = divideRounded<RoundingMode::HALF_EVEN>(magnitude, d); break;
+        case RoundingMode::DOWN: rounded = divideRounded<RoundingMode::DOWN>(magnitude, d); break;
+        default: rounded = divideRounded<RoundingMode::UP>(magnitude, d); break;
+    }
+    return product < 0 ? static_cast<int64_t>(0 - rounded) : static_cast<int64_t>(rounded);
+}
+
+bool priceProduct(int64_t weightMg, int64_t pricePerGram, int64_t wage,
+                  int32_t discountBps, int32_t taxBps, RoundingMode mode,
+                  PriceBreakdown* out) {
+    if (!validInputs(weightMg, pricePerGram, wage, discountBps, taxBps)) {
+        return false;
+    }
+    switch (mode) {
+        case RoundingMode::HALF_UP:
+            *out = price<RoundingMode::HALF_UP>(weightMg, pricePerGram, wage, discountBps, taxBps);
+            break;
+        case RoundingMode::HALF_EVEN:
+            *out = price<RoundingMode::HALF_EVEN>(weightMg, pricePerGram, wage, discountBps, taxBps);
+            break;
+        case RoundingMode::DOWN:
+            *out = price<RoundingMode::DOWN>(weightMg, pricePerGram, wage, discountBps, taxBps);
+            break;
+        default:
+            *out = price<RoundingMode::UP>(weightMg, pricePerGram, wage, discountBps, taxBps);
+            break;
+    }
+    return true;
+}
+
+size_t priceProducts(const int64_t* weightMg, const int64_t* wage, const int32_t* discountBps,
+                     size_t count, int64_t pricePerGram, int32_t taxBps, RoundingMode mode,
+                     int64_t* totals) {
+    // One loop per mode, so the rounding inside it is fixed at compile time
+    switch (mode) {
+        case RoundingMode::HALF_UP:
+            return priceAll<RoundingMode::HALF_UP>(weightMg, wage, discountBps, count, pricePerGram, taxBps, totals);
+        case RoundingMode::HALF_EVEN:
+            return priceAll<RoundingMode::HALF_EVEN>(weightMg, wage, discountBps, count, pricePerGram, taxBps, totals);
+        case RoundingMode::DOWN:
+            return priceAll<RoundingMode::DOWN>(weightMg, wage, discountBps, count, pricePerGram, taxBps, totals);
+        default:
+            return priceAll<RoundingMode::UP>(weightMg, wage, discountBps, count, pricePerGram, taxBps, totals);
+    }
+}
+
+} // namespace money
+
+} // namespace noghresod
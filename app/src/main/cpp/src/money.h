@@ -0,0 +1,85 @@
+#ifndef NOGHRESOD_MONEY_H
+#define NOGHRESOD_MONEY_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace noghresod {
+
+/**
+ * Fixed-point money arithmetic: amounts are int64 Rial, rates are basis
+ * points (1/100 of a percent, so 9% VAT is 900) and weights are
+ * milligrams. Every division rounds with an explicit RoundingMode.
+ *
+ * Only 64-bit integer operations are used, with inputs bounded (MAX_*
+ * below) so that no intermediate product can overflow. The same inputs
+ * therefore give the same Rial on every ABI, with or without __int128,
+ * and in the Kotlin twin in NativeMoney.kt.
+ */
+namespace money {
+
+    /**
+     * Rounding of a quotient. Values match NativeMoney.Rounding.
+     */
+    enum class RoundingMode : uint8_t {
+        HALF_UP = 0,      // ties away from zero
+        HALF_EVEN = 1,    // ties to the even neighbour (banker's rounding)
+        DOWN = 2,         // toward zero
+        UP = 3,           // away from zero
+    };
+
+    const size_t ROUNDING_MODE_COUNT = 4;
+
+    const int32_t BASIS_POINTS = 10000;          // 100%
+    const int32_t VAT_BASIS_POINTS = 900;        // Iranian VAT, 9%
+    const int64_t MILLIGRAMS_PER_GRAM = 1000;
+
+    // Input bounds; a subtotal (metal + wage) stays below 2^63 / BASIS_POINTS
+    const int64_t MAX_WEIGHT_MG = INT64_C(10000000);                 // 10 kg
+    const int64_t MAX_PRICE_PER_GRAM = INT64_C(10000000000);         // 10^10 Rial
+    const int64_t MAX_WAGE = INT64_C(100000000000000);               // 10^14 Rial
+
+    /**
+     * value * numerator / denominator, rounded with [mode].
+     * The caller keeps |value * numerator| below 2^63; denominator > 0.
+     */
+    int64_t mulDiv(int64_t value, int64_t numerator, int64_t denominator, RoundingMode mode);
+
+    struct PriceBreakdown {
+        int64_t metal;      // weight x price per gram
+        int64_t wage;       // making charge (اجرت)
+        int64_t discount;   // off metal + wage
+        int64_t tax;        // on the discounted subtotal
+        int64_t total;      // metal + wage - discount + tax
+    };
+
+    /**
+     * Price one product, every step rounded with [mode]:
+     * metal = weight x price per gram, discount off metal + wage, then tax
+     * on what is left.
+     *
+     * @return false if an input is outside its MAX_* bound, negative, or a
+     *         rate is outside 0..BASIS_POINTS
+     */
+    bool priceProduct(int64_t weightMg, int64_t pricePerGram, int64_t wage,
+                      int32_t discountBps, int32_t taxBps, RoundingMode mode,
+                      PriceBreakdown* out);
+
+    /**
+     * Reprice [count] products at one silver price in a single pass:
+     * totals[i] = priceProduct(weightMg[i], pricePerGram, wage[i],
+     * discountBps[i], taxBps).total.
+     *
+     * @param discountBps Per product, or nullptr for no discounts
+     * @return Products priced; fewer than [count] only at the first
+     *         product priceProduct() would reject
+     */
+    size_t priceProducts(const int64_t* weightMg, const int64_t* wage, const int32_t* discountBps,
+                         size_t count, int64_t pricePerGram, int32_t taxBps, RoundingMode mode,
+                         int64_t* totals);
+
+} // namespace money
+
+} // namespace noghresod
+
+#endif // NOGHRESOD_MONEY_H
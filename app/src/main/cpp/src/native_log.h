@@ -0,0 +1,29 @@
+#ifndef NOGHRESOD_NATIVE_LOG_H
+#define NOGHRESOD_NATIVE_LOG_H
+
+/**
+ * LOGD/LOGI/LOGE for code shared by the Android library and the host build.
+ * Define LOG_TAG before including.
+ *
+ * On Android these go to logcat. Host builds keep errors on stderr and
+ * compile the rest out so benchmark output stays clean.
+ */
+#ifdef __ANDROID__
+
+#include <android/log.h>
+
+#define LOGD(...) __android_log_print(ANDROID_LOG_DEBUG, LOG_TAG, __VA_ARGS__)
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
+
+#else
+
+#include <cstdio>
+
+#define LOGD(...) ((void)0)
+#define LOGI(...) ((void)0)
+#define LOGE(...) (std::fprintf(stderr, LOG_TAG ": " __VA_ARGS__), std::fputc('\n', stderr))
+
+#endif
+
+#endif // NOGHRESOD_NATIVE_LOG_H
@@ -0,0 +1,183 @@
+#include "native_stats.h"
+
+#include <atomic>
+#include <cstring>
+#include <ctime>
+
+namespace noghresod {
+
+namespace {
+    const size_t SUB_BUCKETS = size_t(1) << NativeStats::SUB_BUCKET_BITS;
+    const size_t ENTRY_COUNT = static_cast<size_t>(StatId::COUNT);
+
+    const char* const NAMES[] = {
+        "NativeKeyManager.getMerchantId",
+        "NativeKeyManager.getApiKey",
+        "KeyProvider.getApiKey",
+        "KeyProvider.getApiBaseUrl",
+        "KeyProvider.getStripeKey",
+        "KeyProvider.getCertificatePins",
+        "KeyProvider.clearSensitiveData",
+        "KeyProvider.nativePrefetch",
+        "KeyProvider.nativeReadSecretBytes",
+        "KeyProvider.nativeReadSecretChars",
+        "NativeKeys.getApiUrl",
+        "NativeKeys.getCertificatePinSha",
+        "NativeKeys.getBackupCertificatePin",
+        "NativeKeys.getCertificatePins",
+        "NativeKeys.getPaymentGatewayKey",
+        "NativeKeys.getFirebaseKey",
+        "NativeKeys.getApiTimeout",
+        "NativeKeys.getMaxRetries",
+        "NativeKeys.getRetryDelay",
+        "NativeKeys.getNetworkConfigBundle",
+        "NativeCrypto.nativeBeginEncrypt",
+        "NativeCrypto.nativeBeginDecrypt",
+        "NativeCrypto.nativeUpdate",
+        "NativeCrypto.nativeFinishEncrypt",
+        "NativeCrypto.nativeFinishDecrypt",
+        "NativeCrypto.nativeEncryptFd",
+        "NativeCrypto.nativeDecryptFd",
+        "NativeDigits.nativeTranscode",
+        "NativePriceFormatter.nativeFormat",
+        "NativePriceFormatter.nativeFormatAll",
+        "NativeJalali.nativeFromEpochDay",
+        "NativeJalali.nativeToEpochDay",
+        "NativeJalali.nativeFromEpochMillisAll",
+        "NativeDateFormatter.nativeFormat",
+        "NativeDateFormatter.nativeFormatAll",
+        "NativeMoney.nativePriceAll",
+        "NativeDateFormatter.nativeCompile",
+    };
+    static_assert(sizeof(NAMES) / sizeof(NAMES[0]) == ENTRY_COUNT, "one name per StatId");
+
+    // Static storage is zero-initialized, so no constructor runs before use
+    struct Entry {
+        std::atomic<uint64_t> calls;
+        std::atomic<uint64_t> totalNs;
+        std::atomic<uint64_t> maxNs;
+        std::atomic<uint32_t> buckets[NativeStats::BUCKET_COUNT];
+    };
+
+    Entry entries[ENTRY_COUNT];
+
+    void appendInt(std::vector<uint8_t>& out, int32_t value) {
+        uint8_t bytes[sizeof(value)];
+        std::memcpy(bytes, &value, sizeof(value));
+        out.insert(out.end(), bytes, bytes + sizeof(value));
+    }
+
+    void appendLong(std::vector<uint8_t>& out, uint64_t value) {
+        uint8_t bytes[sizeof(value)];
+        std::memcpy(bytes, &value, sizeof(value));
+        out.insert(out.end(), bytes, bytes + sizeof(value));
+    }
+
+    template <typename T>
+    T take(std::atomic<T>& counter, bool reset) {
+        return reset ? counter.exchange(0, std::memory_order_relaxed)
+                     : counter.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * NativeStats::snapshot(), zeroing each counter as it is read if [reset].
+     */
+    std::vector<uint8_t> collect(bool reset) {
+        std::vector<uint8_t> out;
+        appendInt(out, NativeStats::SNAPSHOT_VERSION);
+        size_t countOffset = out.size();
+        appendInt(out, 0);
+        appendInt(out, static_cast<int32_t>(NativeStats::SUB_BUCKET_BITS));
+
+        int32_t entryCount = 0;
+        for (size_t i = 0; i < ENTRY_COUNT; i++) {
+            Entry& entry = entries[i];
+            uint64_t calls = take(entry.calls, reset);
+            if (calls == 0) {
+                continue;
+            }
+            entryCount++;
+
+            size_t nameLength = std::strlen(NAMES[i]);
+            appendInt(out, static_cast<int32_t>(nameLength));
+            out.insert(out.end(), NAMES[i], NAMES[i] + nameLength);
+            appendLong(out, calls);
+            appendLong(out, take(entry.totalNs, reset));
+            appendLong(out, take(entry.maxNs, reset));
+
+            size_t bucketCountOffset = out.size();
+            appendInt(out, 0);
+            int32_t bucketCount = 0;
+            for (size_t b = 0; b < NativeStats::BUCKET_COUNT; b++) {
+                uint32_t count = take(entry.buckets[b], reset);
+                if (count != 0) {
+                    appendInt(out, static_cast<int32_t>(b));
+                    appendInt(out, static_cast<int32_t>(count));
+                    bucketCount++;
+                }
+            }
+            std::memcpy(out.data() + bucketCountOffset, &bucketCount, sizeof(bucketCount));
+        }
+
+        std::memcpy(out.data() + countOffset, &entryCount, sizeof(entryCount));
+        return out;
+    }
+}
+
+uint64_t NativeStats::nowNs() {
+    timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<uint64_t>(now.tv_sec) * 1000000000ULL + static_cast<uint64_t>(now.tv_nsec);
+}
+
+size_t NativeStats::bucketFor(uint64_t ns) {
+    if (ns < SUB_BUCKETS) {
+        return static_cast<size_t>(ns);
+    }
+    size_t exponent = 63 - static_cast<size_t>(__builtin_clzll(ns));
+    size_t sub = static_cast<size_t>(ns >> (exponent - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1);
+    size_t bucket = (exponent - SUB_BUCKET_BITS + 1) * SUB_BUCKETS + sub;
+    return bucket < BUCKET_COUNT ? bucket : BUCKET_COUNT - 1;
+}
+
+uint64_t NativeStats::bucketLowerBound(size_t bucket) {
+    if (bucket < SUB_BUCKETS) {
+        return bucket;
+    }
+    size_t exponent = bucket / SUB_BUCKETS + SUB_BUCKET_BITS - 1;
+    uint64_t mantissa = SUB_BUCKETS + bucket % SUB_BUCKETS;
+    return mantissa << (exponent - SUB_BUCKET_BITS);
+}
+
+void NativeStats::record(StatId id, uint64_t elapsedNs) {
+    Entry& entry = entries[static_cast<size_t>(id)];
+    entry.calls.fetch_add(1, std::memory_order_relaxed);
+    entry.totalNs.fetch_add(elapsedNs, std::memory_order_relaxed);
+    entry.buckets[bucketFor(elapsedNs)].fetch_add(1, std::memory_order_relaxed);
+
+    uint64_t max = entry.maxNs.load(std::memory_order_relaxed);
+    while (elapsedNs > max &&
+           !entry.maxNs.compare_exchange_weak(max, elapsedNs, std::memory_order_relaxed)) {
+    }
+}
+
+std::vector<uint8_t> NativeStats::snapshot() {
+    return collect(false);
+}
+
+std::vector<uint8_t> NativeStats::snapshotAndReset() {
+    return collect(true);
+}
+
+void NativeStats::reset() {
+    for (Entry& entry : entries) {
+        entry.calls.store(0, std::memory_order_relaxed);
+        entry.totalNs.store(0, std::memory_order_relaxed);
+        entry.maxNs.store(0, std::memory_order_relaxed);
+        for (auto& bucket : entry.buckets) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+} // namespace noghresod
@@ -0,0 +1,142 @@
+#ifndef NOGHRESOD_NATIVE_STATS_H
+#define NOGHRESOD_NATIVE_STATS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// ============================================
+// Hot-path instrumentation for the JNI entry points
+// ============================================
+
+namespace noghresod {
+
+/**
+ * Instrumented entry points. Names are in native_stats.cpp.
+ */
+enum class StatId : uint16_t {
+    NATIVE_KEY_MANAGER_GET_MERCHANT_ID = 0,
+    NATIVE_KEY_MANAGER_GET_API_KEY,
+    KEY_PROVIDER_GET_API_KEY,
+    KEY_PROVIDER_GET_API_BASE_URL,
+    KEY_PROVIDER_GET_STRIPE_KEY,
+    KEY_PROVIDER_GET_CERTIFICATE_PINS,
+    KEY_PROVIDER_CLEAR_SENSITIVE_DATA,
+    KEY_PROVIDER_PREFETCH,
+    KEY_PROVIDER_READ_SECRET_BYTES,
+    KEY_PROVIDER_READ_SECRET_CHARS,
+    NATIVE_KEYS_GET_API_URL,
+    NATIVE_KEYS_GET_CERTIFICATE_PIN_SHA,
+    NATIVE_KEYS_GET_BACKUP_CERTIFICATE_PIN,
+    NATIVE_KEYS_GET_CERTIFICATE_PINS,
+    NATIVE_KEYS_GET_PAYMENT_GATEWAY_KEY,
+    NATIVE_KEYS_GET_FIREBASE_KEY,
+    NATIVE_KEYS_GET_API_TIMEOUT,
+    NATIVE_KEYS_GET_MAX_RETRIES,
+    NATIVE_KEYS_GET_RETRY_DELAY,
+    NATIVE_KEYS_GET_NETWORK_CONFIG_BUNDLE,
+    NATIVE_CRYPTO_BEGIN_ENCRYPT,
+    NATIVE_CRYPTO_BEGIN_DECRYPT,
+    NATIVE_CRYPTO_UPDATE,
+    NATIVE_CRYPTO_FINISH_ENCRYPT,
+    NATIVE_CRYPTO_FINISH_DECRYPT,
+    NATIVE_CRYPTO_ENCRYPT_FD,
+    NATIVE_CRYPTO_DECRYPT_FD,
+    NATIVE_DIGITS_TRANSCODE,
+    NATIVE_PRICE_FORMATTER_FORMAT,
+    NATIVE_PRICE_FORMATTER_FORMAT_ALL,
+    NATIVE_JALALI_FROM_EPOCH_DAY,
+    NATIVE_JALALI_TO_EPOCH_DAY,
+    NATIVE_JALALI_FROM_EPOCH_MILLIS_ALL,
+    NATIVE_DATE_FORMATTER_FORMAT,
+    NATIVE_DATE_FORMATTER_FORMAT_ALL,
+    NATIVE_MONEY_PRICE_ALL,
+    NATIVE_DATE_FORMATTER_COMPILE,
+    COUNT
+};
+
+/**
+ * Lock-free call counters and latency histograms, one set per StatId.
+ *
+ * Every record() is a handful of relaxed atomic adds on static storage: no
+ * locks and no allocation. Latencies go into log-linear buckets, i.e.
+ * powers of two split into 2^SUB_BUCKET_BITS linear steps, so each bucket
+ * is within 25% of its neighbours from 1 ns up to ~30 minutes.
+ *
+ * Snapshots read the counters without stopping writers; a snapshot taken
+ * during calls may be off by the calls in flight. snapshotAndReset() swaps
+ * each counter to zero as it reads it, so consecutive snapshots lose no
+ * call, though one in flight may be split across two of them.
+ */
+class NativeStats {
+public:
+    static const size_t SUB_BUCKET_BITS = 2;
+    static const size_t BUCKET_COUNT = 160;
+
+    // Layout version of snapshot(); bump on any format change
+    static const int32_t SNAPSHOT_VERSION = 1;
+
+    static void record(StatId id, uint64_t elapsedNs);
+
+    /**
+     * Packed snapshot of every entry point called at least once.
+     *
+     * Layout (native byte order):
+     *   int32 version, int32 entryCount, int32 subBucketBits, then per entry:
+     *   int32 nameLength, UTF-8 name, int64 calls, int64 totalNs,
+     *   int64 maxNs, int32 bucketCount, then bucketCount x
+     *   (int32 bucketIndex, int32 count) for the non-empty buckets only.
+     */
+    static std::vector<uint8_t> snapshot();
+
+    /**
+     * snapshot() and reset() in one pass: the counts since the last call.
+     * Calls recorded between a snapshot() and a reset() would be lost.
+     */
+    static std::vector<uint8_t> snapshotAndReset();
+
+    /**
+     * Zero every counter.
+     */
+    static void reset();
+
+    static size_t bucketFor(uint64_t ns);
+
+    /**
+     * Smallest latency (ns) that lands in [bucket].
+     */
+    static uint64_t bucketLowerBound(size_t bucket);
+
+    static uint64_t nowNs();
+};
+
+/**
+ * Records the lifetime of the enclosing scope under one StatId.
+ */
+class StatScope {
+public:
+    explicit StatScope(StatId id) : id_(id), startNs_(NativeStats::nowNs()) {}
+    ~StatScope() { NativeStats::record(id_, NativeStats::nowNs() - startNs_); }
+
+    StatScope(const StatScope&) = delete;
+    StatScope& operator=(const StatScope&) = delete;
+
+private:
+    StatId id_;
+    uint64_t startNs_;
+};
+
+} // namespace noghresod
+
+// Instrument the enclosing scope; compiled out with NOGHRESOD_NATIVE_STATS=0
+#ifndef NOGHRESOD_NATIVE_STATS
+#define NOGHRESOD_NATIVE_STATS 1
+#endif
+
+#if NOGHRESOD_NATIVE_STATS
+#define NOGHRESOD_STAT_SCOPE(id) ::noghresod::StatScope noghresodStatScope_(::noghresod::StatId::id)
+#else
+#define NOGHRESOD_STAT_SCOPE(id) ((void)0)
+#endif
+
+#endif // NOGHRESOD_NATIVE_STATS_H
@@ -0,0 +1,117 @@
+#include "native_trace.h"
+
+#ifdef __ANDROID__
+
+#include <android/trace.h>
+
+namespace noghresod {
+
+bool NativeTrace::enabled() {
+    return ATrace_isEnabled();
+}
+
+uint64_t NativeTrace::begin(const char* name) {
+    ATrace_beginSection(name);
+    return 0;
+}
+
+void NativeTrace::end(const char* /* name */, uint64_t /* startNs */) {
+    ATrace_endSection();
+}
+
+} // namespace noghresod
+
+#else
+
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <mutex>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace noghresod {
+
+namespace {
+    /**
+     * Chrome-trace JSON array of complete ("X") events, closed at exit.
+     */
+    class ChromeTraceWriter {
+    public:
+        static ChromeTraceWriter* instance() {
+            static ChromeTraceWriter* writer = open();
+            return writer;
+        }
+
+        void write(const char* name, uint64_t startNs, uint64_t endNs) {
+            long tid = syscall(SYS_gettid);
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (closed_) {
+                return;
+            }
+            std::fprintf(file_,
+                "%s{\"name\":\"%s\",\"cat\":\"noghresod\",\"ph\":\"X\","
+                "\"ts\":%.3f,\"dur\":%.3f,\"pid\":%d,\"tid\":%ld}",
+                first_ ? "\n" : ",\n", name,
+                static_cast<double>(startNs) / 1000.0,
+                static_cast<double>(endNs - startNs) / 1000.0,
+                static_cast<int>(getpid()), tid);
+            first_ = false;
+        }
+
+    private:
+        explicit ChromeTraceWriter(FILE* file) : file_(file) {}
+
+        static ChromeTraceWriter* open() {
+            const char* path = std::getenv("NOGHRESOD_TRACE_FILE");
+            if (path == nullptr || path[0] == '\0') {
+                return nullptr;
+            }
+            FILE* file = std::fopen(path, "w");
+            if (file == nullptr) {
+                std::fprintf(stderr, "NoghreSod_Trace: cannot open %s\n", path);
+                return nullptr;
+            }
+            std::fputc('[', file);
+            // Never destroyed: sections may still end during static teardown
+            ChromeTraceWriter* writer = new ChromeTraceWriter(file);
+            std::atexit(close);
+            return writer;
+        }
+
+        static void close() {
+            ChromeTraceWriter* writer = instance();
+            std::lock_guard<std::mutex> lock(writer->mutex_);
+            std::fputs("\n]\n", writer->file_);
+            std::fflush(writer->file_);
+            writer->closed_ = true;
+        }
+
+        FILE* file_;
+        std::mutex mutex_;
+        bool first_ = true;
+        bool closed_ = false;
+    };
+
+    uint64_t nowNs() {
+        timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        return static_cast<uint64_t>(now.tv_sec) * 1000000000ULL + static_cast<uint64_t>(now.tv_nsec);
+    }
+}
+
+bool NativeTrace::enabled() {
+    return ChromeTraceWriter::instance() != nullptr;
+}
+
+uint64_t NativeTrace::begin(const char* /* name */) {
+    return nowNs();
+}
+
+void NativeTrace::end(const char* name, uint64_t startNs) {
+    ChromeTraceWriter::instance()->write(name, startNs, nowNs());
+}
+
+} // namespace noghresod
+
+#endif
@@ -0,0 +1,74 @@
+#ifndef NOGHRESOD_NATIVE_TRACE_H
+#define NOGHRESOD_NATIVE_TRACE_H
+
+#include <cstdint>
+
+// ============================================
+// Trace sections for system traces (Perfetto / systrace)
+// ============================================
+
+namespace noghresod {
+
+/**
+ * Backend for NOGHRESOD_TRACE_SCOPE.
+ *
+ * On Android sections go to ATrace, so they show up in Perfetto and
+ * systrace under the app's process. enabled() is a single atrace flag
+ * check, so an untraced section costs one call and a branch.
+ *
+ * Host builds write Chrome-trace JSON (chrome://tracing, ui.perfetto.dev)
+ * to the file named by the NOGHRESOD_TRACE_FILE environment variable, and
+ * record nothing when it is unset.
+ */
+class NativeTrace {
+public:
+    static bool enabled();
+
+    /**
+     * @param name String literal; it is referenced, not copied, and must
+     *             not need JSON escaping
+     * @return Start timestamp to hand back to end()
+     */
+    static uint64_t begin(const char* name);
+    static void end(const char* name, uint64_t startNs);
+};
+
+/**
+ * Traces the lifetime of the enclosing scope as one section.
+ */
+class TraceScope {
+public:
+    explicit TraceScope(const char* name)
+        : name_(NativeTrace::enabled() ? name : nullptr),
+          startNs_(name_ != nullptr ? NativeTrace::begin(name_) : 0) {}
+
+    ~TraceScope() {
+        if (name_ != nullptr) {
+            NativeTrace::end(name_, startNs_);
+        }
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    const char* name_;
+    uint64_t startNs_;
+};
+
+} // namespace noghresod
+
+// Trace the enclosing scope; compiled out with NOGHRESOD_TRACE=0
+#ifndef NOGHRESOD_TRACE
+#define NOGHRESOD_TRACE 1
+#endif
+
+#if NOGHRESOD_TRACE
+#define NOGHRESOD_TRACE_CONCAT_(a, b) a##b
+#define NOGHRESOD_TRACE_NAME_(line) NOGHRESOD_TRACE_CONCAT_(noghresodTraceScope_, line)
+#define NOGHRESOD_TRACE_SCOPE(name) ::noghresod::TraceScope NOGHRESOD_TRACE_NAME_(__LINE__)(name)
+#else
+#define NOGHRESOD_TRACE_SCOPE(name) ((void)0)
+#endif
+
+#endif // NOGHRESOD_NATIVE_TRACE_H
@@ -0,0 +1,41 @@
+#include "network_config.h"
+
+#include <cstring>
+#include "native_trace.h"
+
+namespace noghresod {
+
+namespace {
+    void appendInt(std::vector<uint8_t>& out, int32_t value) {
+        uint8_t bytes[sizeof(value)];
+        std::memcpy(bytes, &value, sizeof(value));
+        out.insert(out.end(), bytes, bytes + sizeof(value));
+    }
+
+    void appendString(std::vector<uint8_t>& out, const char* value) {
+        size_t length = std::strlen(value);
+        appendInt(out, static_cast<int32_t>(length));
+        out.insert(out.end(), value, value + length);
+    }
+}
+
+const std::vector<uint8_t>& networkConfigBundle() {
+    using namespace network_config;
+    static const std::vector<uint8_t> bundle = [] {
+        NOGHRESOD_TRACE_SCOPE("networkConfigBundle");
+        std::vector<uint8_t> out;
+        appendInt(out, BUNDLE_VERSION);
+        appendInt(out, API_TIMEOUT_SECONDS);
+        appendInt(out, MAX_RETRIES);
+        appendInt(out, RETRY_DELAY_MS);
+        appendString(out, API_URL);
+        appendString(out, CERTIFICATE_PIN_SHA);
+        appendString(out, BACKUP_CERTIFICATE_PIN);
+        appendString(out, PAYMENT_GATEWAY_KEY);
+        appendString(out, FIREBASE_KEY);
+        return out;
+    }();
+    return bundle;
+}
+
+} // namespace noghresod
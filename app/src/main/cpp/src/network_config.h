@@ -0,0 +1,48 @@
+#ifndef NOGHRESOD_NETWORK_CONFIG_H
+#define NOGHRESOD_NETWORK_CONFIG_H
+
+#include <cstdint>
+#include <vector>
+
+// ============================================
+// 🔐 Network settings held in native code
+// ============================================
+
+namespace noghresod {
+
+namespace network_config {
+    // TODO: Replace with actual API URL before production
+    inline constexpr char API_URL[] = "https://api.noghresod.ir/v1/";
+    inline constexpr char CERTIFICATE_PIN_SHA[] = "sha256/Iv8Pkqkx7E0IxEBf9X9sLeJW6zIPg9TJd6K3mNfW5lQ=";
+    inline constexpr char BACKUP_CERTIFICATE_PIN[] = "sha256/lFQwGWAd96P3xh8Sj7fVOBHmxZN0A8d/zJGz2fKJHNc=";
+    // TODO: Replace with actual ZarinPal Merchant ID
+    // Get from: https://panel.zarinpal.com/app/settings
+    inline constexpr char PAYMENT_GATEWAY_KEY[] = "00000000-0000-0000-0000-000000000000";
+    // TODO: Replace with actual Firebase credentials
+    // Get from: google-services.json in your Firebase console
+    inline constexpr char FIREBASE_KEY[] = "AIzaSyDummyKeyForTesting123456789";
+    // The local-data encryption key lives in src/local_crypto.cpp and never
+    // leaves native code
+
+    const int32_t API_TIMEOUT_SECONDS = 30;
+    const int32_t MAX_RETRIES = 3;
+    const int32_t RETRY_DELAY_MS = 1000;
+
+    // Layout version of the network config bundle; bump on any format change
+    const int32_t BUNDLE_VERSION = 2;
+}
+
+/**
+ * Packed network config, built once per process.
+ *
+ * Layout (native byte order):
+ *   int32 version, int32 apiTimeout, int32 maxRetries, int32 retryDelay,
+ *   then 5 strings as (int32 length, UTF-8 bytes) in the order
+ *   apiUrl, certificatePin, backupCertificatePin, paymentGatewayKey,
+ *   firebaseKey.
+ */
+const std::vector<uint8_t>& networkConfigBundle();
+
+} // namespace noghresod
+
+#endif // NOGHRESOD_NETWORK_CONFIG_H
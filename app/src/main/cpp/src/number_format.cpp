@@ -0,0 +1,75 @@
+#include "number_format.h"
+
+#include <cstring>
+
+namespace noghresod {
+
+namespace {
+    const uint16_t TOMAN_SUFFIX[] = { 0x0020, 0x062A, 0x0648, 0x0645, 0x0627, 0x0646 };
+    const size_t TOMAN_SUFFIX_LENGTH = sizeof(TOMAN_SUFFIX) / sizeof(TOMAN_SUFFIX[0]);
+
+    struct Style {
+        uint16_t zero;
+        uint16_t separator;
+        uint16_t minus;
+    };
+
+    const Style PERSIAN_STYLE = { 0x06F0, 0x066C, 0x2212 };
+    const Style LATIN_STYLE = { 0x0030, 0x002C, 0x002D };
+
+    // Sign, 19 digits and 6 separators
+    const size_t MAX_DIGITS_LENGTH = 26;
+    static_assert(MAX_DIGITS_LENGTH + TOMAN_SUFFIX_LENGTH == MAX_FORMATTED_NUMBER,
+                  "MAX_FORMATTED_NUMBER covers the longest value");
+}
+
+size_t formatNumber(int64_t value, uint32_t flags, uint16_t* out) {
+    const Style& style = (flags & NUMBER_LATIN) != 0 ? LATIN_STYLE : PERSIAN_STYLE;
+    // Unsigned negation, so INT64_MIN has a magnitude too
+    uint64_t magnitude = value < 0 ? 0 - static_cast<uint64_t>(value) : static_cast<uint64_t>(value);
+
+    // Filled from the right, one group of three per step
+    uint16_t digits[MAX_DIGITS_LENGTH];
+    uint16_t* p = digits + MAX_DIGITS_LENGTH;
+    while (magnitude >= 1000) {
+        uint64_t rest = magnitude / 1000;
+        uint32_t group = static_cast<uint32_t>(magnitude - rest * 1000);
+        *--p = static_cast<uint16_t>(style.zero + group % 10);
+        *--p = static_cast<uint16_t>(style.zero + group / 10 % 10);
+        *--p = static_cast<uint16_t>(style.zero + group / 100);
+        *--p = style.separator;
+        magnitude = rest;
+    }
+    // Leading group without zero padding
+    uint32_t lead = static_cast<uint32_t>(magnitude);
+    do {
+        *--p = static_cast<uint16_t>(style.zero + lead % 10);
+        lead /= 10;
+    } while (lead != 0);
+    if (value < 0) {
+        *--p = style.minus;
+    }
+
+    size_t length = static_cast<size_t>(digits + MAX_DIGITS_LENGTH - p);
+    std::memcpy(out, p, length * sizeof(uint16_t));
+    if ((flags & NUMBER_TOMAN) != 0) {
+        std::memcpy(out + length, TOMAN_SUFFIX, sizeof(TOMAN_SUFFIX));
+        length += TOMAN_SUFFIX_LENGTH;
+    }
+    return length;
+}
+
+size_t formatNumbers(const int64_t* values, size_t count, uint32_t flags,
+                     uint16_t* out, size_t capacity, int32_t* ends) {
+    size_t position = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (capacity - position < MAX_FORMATTED_NUMBER) {
+            return i;
+        }
+        position += formatNumber(values[i], flags, out + position);
+        ends[i] = static_cast<int32_t>(position);
+    }
+    return count;
+}
+
+} // namespace noghresod
@@ -0,0 +1,43 @@
+#ifndef NOGHRESOD_NUMBER_FORMAT_H
+#define NOGHRESOD_NUMBER_FORMAT_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace noghresod {
+
+/**
+ * Options of formatNumber(). Values match NativePriceFormatter.kt.
+ */
+enum NumberFormatFlags : uint32_t {
+    // ASCII digits, ',' and '-' instead of Persian digits, U+066C and U+2212
+    NUMBER_LATIN = 1u << 0,
+    // Append " تومان"
+    NUMBER_TOMAN = 1u << 1,
+};
+
+// Longest output: "−۹٬۲۲۳٬۳۷۲٬۰۳۶٬۸۵۴٬۷۷۵٬۸۰۸ تومان"
+const size_t MAX_FORMATTED_NUMBER = 32;
+
+/**
+ * Write [value] as UTF-16 with its digits grouped in threes, e.g.
+ * -1234567 -> "−۱٬۲۳۴٬۵۶۷". Uses no heap and no locale data.
+ *
+ * @param out Room for MAX_FORMATTED_NUMBER units
+ * @return Units written
+ */
+size_t formatNumber(int64_t value, uint32_t flags, uint16_t* out);
+
+/**
+ * Format [count] values back to back into [out]; value i ends at ends[i].
+ *
+ * @param capacity Units available in [out]
+ * @return Values formatted; fewer than [count] only when [out] runs out of
+ *         room, which a capacity of count * MAX_FORMATTED_NUMBER rules out
+ */
+size_t formatNumbers(const int64_t* values, size_t count, uint32_t flags,
+                     uint16_t* out, size_t capacity, int32_t* ends);
+
+} // namespace noghresod
+
+#endif // NOGHRESOD_NUMBER_FORMAT_H
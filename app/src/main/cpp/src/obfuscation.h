@@ -0,0 +1,161 @@
+#ifndef NOGHRESOD_OBFUSCATION_H
+#define NOGHRESOD_OBFUSCATION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include "native_trace.h"
+#include "secure_memory.h"
+
+/**
+ * Compile-time string obfuscation.
+ *
+ * NOGHRESOD_OBFUSCATE("literal") encrypts the literal during compilation and
+ * yields an ObfuscatedString; only the ciphertext reaches .rodata. reveal()
+ * decodes it into a stack buffer that is wiped when it goes out of scope:
+ *
+ *     auto merchantId = NOGHRESOD_OBFUSCATE("...").reveal();
+ *     env->NewStringUTF(merchantId.c_str());
+ *
+ * Each literal gets its own keystream, derived from the per-build seed
+ * (NOGHRESOD_OBFUSCATION_SEED, set by CMake) and its source position, so the
+ * same string encrypts differently in every build and at every call site.
+ * Decoding works on 64-bit words and is fully unrolled for the literal's
+ * length, so revealing a secret costs a handful of XORs and stores.
+ */
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#error "obfuscation.h assumes a little-endian target"
+#endif
+
+namespace noghresod {
+
+namespace obfuscation {
+
+    constexpr uint64_t fnv1a(const char* text, uint64_t hash = 0xcbf29ce484222325ULL) {
+        return *text == '\0' ? hash : fnv1a(text + 1, (hash ^ static_cast<uint8_t>(*text)) * 0x100000001b3ULL);
+    }
+
+#ifdef NOGHRESOD_OBFUSCATION_SEED
+    constexpr uint64_t BUILD_SEED = NOGHRESOD_OBFUSCATION_SEED;
+#else
+    // Fallback when the build does not provide a seed: still varies per build
+    constexpr uint64_t BUILD_SEED = fnv1a(__DATE__ " " __TIME__);
+#endif
+
+    constexpr uint64_t splitmix64(uint64_t x) {
+        x += 0x9e3779b97f4a7c15ULL;
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+        return x ^ (x >> 31);
+    }
+
+    constexpr uint64_t literalSeed(uint64_t line, uint64_t counter) {
+        return splitmix64(BUILD_SEED ^ (line * 0x2545f4914f6cdd1dULL) ^ (counter << 32));
+    }
+
+    /**
+     * Keystream word [index] for a literal seeded with [seed].
+     */
+    constexpr uint64_t keyWord(uint64_t seed, size_t index) {
+        return splitmix64(seed + index * 0x9e3779b97f4a7c15ULL);
+    }
+
+} // namespace obfuscation
+
+/**
+ * Stack buffer holding a revealed secret; wiped on destruction.
+ */
+template <size_t WORDS>
+class RevealedString {
+public:
+    /**
+     * @param fill Writes WORDS * 8 bytes into the buffer
+     */
+    template <typename Fill>
+    explicit RevealedString(Fill fill) {
+        fill(buffer_);
+    }
+
+    RevealedString(const RevealedString&) = delete;
+    RevealedString& operator=(const RevealedString&) = delete;
+
+    ~RevealedString() {
+        secureWipe(buffer_, sizeof(buffer_));
+    }
+
+    const char* c_str() const { return buffer_; }
+    size_t size() const { return std::strlen(buffer_); }
+
+private:
+    char buffer_[WORDS * 8];
+};
+
+/**
+ * A string literal encrypted at compile time.
+ *
+ * @tparam N Literal size including the terminating NUL
+ * @tparam SEED Keystream seed for this literal
+ */
+template <size_t N, uint64_t SEED>
+class ObfuscatedString {
+public:
+    static constexpr size_t WORDS = (N + 7) / 8;
+
+    constexpr explicit ObfuscatedString(const char (&text)[N]) : words_() {
+        for (size_t i = 0; i < WORDS; i++) {
+            uint64_t word = 0;
+            for (size_t b = 0; b < 8; b++) {
+                size_t index = i * 8 + b;
+                uint8_t c = index < N ? static_cast<uint8_t>(text[index]) : 0;
+                word |= static_cast<uint64_t>(c) << (b * 8);
+            }
+            words_[i] = word ^ obfuscation::keyWord(SEED, i);
+        }
+    }
+
+    /**
+     * Decode into a self-wiping stack buffer.
+     * C++17 guaranteed elision means the buffer is built in place.
+     */
+    RevealedString<WORDS> reveal() const {
+        NOGHRESOD_TRACE_SCOPE("xorReveal");
+        return RevealedString<WORDS>([this](char* out) {
+            revealWords(out, std::make_index_sequence<WORDS>());
+        });
+    }
+
+private:
+    template <size_t... I>
+    void revealWords(char* out, std::index_sequence<I...>) const {
+        (revealWord<I>(out), ...);
+    }
+
+    template <size_t I>
+    void revealWord(char* out) const {
+        // volatile read keeps the compiler from folding ciphertext and key
+        // back into a plaintext constant
+        uint64_t word = static_cast<const volatile uint64_t*>(words_)[I] ^
+                        obfuscation::keyWord(SEED, I);
+        std::memcpy(out + I * 8, &word, sizeof(word));
+    }
+
+    uint64_t words_[WORDS];
+};
+
+} // namespace noghresod
+
+/**
+ * Encrypt a string literal at compile time.
+ * Yields an ObfuscatedString; call reveal() to decode it.
+ */
+#define NOGHRESOD_OBFUSCATE(literal)                                                        \
+    ([]() {                                                                                 \
+        constexpr ::noghresod::ObfuscatedString<                                            \
+            sizeof(literal), ::noghresod::obfuscation::literalSeed(__LINE__, __COUNTER__)>  \
+            value(literal);                                                                 \
+        return value;                                                                       \
+    }())
+
+#endif // NOGHRESOD_OBFUSCATION_H
@@ -0,0 +1,82 @@
+#include "secret_cache.h"
+
+#include <cstring>
+#include <thread>
+
+#define LOG_TAG "NoghreSod_Keys"
+#include "native_log.h"
+
+namespace noghresod {
+
+SecretCache& SecretCache::instance() {
+    static SecretCache cache;
+    return cache;
+}
+
+SecretCache::SecretCache() : region_(4096) {
+    if (!region_.valid()) {
+        LOGE("Secret cache region unavailable - secrets will not be cached");
+        return;
+    }
+
+    // Two fixed buffers per slot: region memory is never repurposed, so a
+    // stale reader can only ever see a complete value or a retired buffer
+    const size_t buffers = 2 * static_cast<size_t>(SecretId::COUNT);
+    bufferSize_ = region_.size() / buffers;
+    char* next = reinterpret_cast<char*>(region_.data());
+    for (Slot& slot : slots_) {
+        for (Buffer& buffer : slot.buffers) {
+            buffer.data = next;
+            next += bufferSize_;
+        }
+    }
+}
+
+void SecretCache::waitForReaders(const Buffer& buffer) {
+    while (buffer.readers.load() != 0) {
+        std::this_thread::yield();
+    }
+}
+
+bool SecretCache::publish(size_t index, const char* plain, size_t length, uint64_t epoch) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    // Keep a trailing NUL so callers can hand the slot straight to NewStringUTF
+    if (!region_.valid() || length + 1 > bufferSize_ || epoch != epoch_.load()) {
+        return false;
+    }
+
+    Slot& slot = slots_[index];
+    Buffer* active = slot.current.load();
+    Buffer* idle = active == &slot.buffers[0] ? &slot.buffers[1] : &slot.buffers[0];
+
+    std::memcpy(idle->data, plain, length);
+    idle->data[length] = '\0';
+    idle->length = length;
+    slot.current.store(idle);
+
+    if (active != nullptr) {
+        waitForReaders(*active);
+        secureWipe(active->data, bufferSize_);
+        active->length = 0;
+    }
+    return true;
+}
+
+void SecretCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    epoch_.fetch_add(1);
+
+    for (Slot& slot : slots_) {
+        Buffer* retired = slot.current.exchange(nullptr);
+        if (retired != nullptr) {
+            waitForReaders(*retired);
+        }
+        for (Buffer& buffer : slot.buffers) {
+            buffer.length = 0;
+        }
+    }
+    region_.wipe();
+    LOGD("Secret cache cleared (epoch %llu)", static_cast<unsigned long long>(epoch_.load()));
+}
+
+} // namespace noghresod
@@ -0,0 +1,168 @@
+#ifndef NOGHRESOD_SECRET_CACHE_H
+#define NOGHRESOD_SECRET_CACHE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include "secure_memory.h"
+
+namespace noghresod {
+
+/**
+ * Secrets served through the native cache.
+ * Values index directly into the cache slot table.
+ */
+enum class SecretId : size_t {
+    API_KEY = 0,
+    API_BASE_URL,
+    COUNT
+};
+
+/**
+ * Decrypt-once cache for native secrets.
+ *
+ * Plaintext is kept in a single page-aligned region that is mlock()ed
+ * (never swapped) and marked MADV_DONTDUMP (never written to core dumps).
+ * Each secret is decrypted on first use and served from its slot afterwards;
+ * clear() wipes the whole region and starts a new epoch, so the next lookup
+ * decrypts again.
+ *
+ * Reads are lock-free. Every slot owns two buffers and an atomic pointer to
+ * the current one; a reader pins that buffer with a per-buffer reader count
+ * and re-checks the pointer, so a cache hit is two atomic adds and two
+ * loads, whatever the number of concurrent readers. Writers (first load,
+ * clear()) are serialized: they publish a new buffer, or none, with one
+ * pointer swap and wipe the retired buffer only after its readers are gone.
+ *
+ * Secrets load independently: a caller waits only for the secret it asked
+ * for, never for another secret that is being decrypted (e.g. by the
+ * start-up warm-up) at the same time.
+ *
+ * If the locked region cannot be mapped, lookups still work but decrypt on
+ * every call and wipe the temporary immediately.
+ */
+class SecretCache {
+public:
+    static SecretCache& instance();
+
+    /**
+     * Resolve a secret and hand its plaintext to [use].
+     *
+     * @param id Secret to resolve
+     * @param load Called once per epoch to produce the plaintext
+     * @param use Receives a NUL-terminated pointer and length; the pointer is
+     *            only valid for the duration of the call
+     * @return false if the secret could not be produced
+     */
+    template <typename Load, typename Use>
+    bool withSecret(SecretId id, Load&& load, Use&& use) {
+        size_t index = static_cast<size_t>(id);
+        if (read(index, use)) {
+            return true;
+        }
+
+        // Concurrent first lookups of one secret decrypt it once; the others
+        // wait here and are then served from the slot
+        std::lock_guard<std::mutex> loadLock(loadMutexes_[index]);
+        if (read(index, use)) {
+            return true;
+        }
+        uint64_t epoch = epoch_.load();
+
+        auto plain = load();
+        if (plain.empty()) {
+            return false;
+        }
+        // Uncached if the secret does not fit or a clear() raced the load
+        publish(index, plain.c_str(), plain.size(), epoch);
+        use(plain.c_str(), plain.size());
+        secureWipe(plain);
+        return true;
+    }
+
+    /**
+     * Wipe every cached secret and advance the epoch.
+     * Waits for readers of the retired buffers, never for new readers.
+     */
+    void clear();
+
+    /**
+     * Number of times the cache has been cleared since process start.
+     */
+    uint64_t epoch() const { return epoch_.load(); }
+
+    SecretCache(const SecretCache&) = delete;
+    SecretCache& operator=(const SecretCache&) = delete;
+
+private:
+    struct Buffer {
+        // Outside the locked region, so wiping never races a reader's count
+        std::atomic<uint32_t> readers{0};
+        size_t length = 0;
+        char* data = nullptr;
+    };
+
+    struct Slot {
+        std::atomic<Buffer*> current{nullptr};
+        Buffer buffers[2];
+    };
+
+    /**
+     * Unpins a buffer on scope exit, even if [use] throws.
+     */
+    class ReadGuard {
+    public:
+        explicit ReadGuard(Buffer* buffer) : buffer_(buffer) { buffer_->readers.fetch_add(1); }
+        ~ReadGuard() { buffer_->readers.fetch_sub(1); }
+
+        ReadGuard(const ReadGuard&) = delete;
+        ReadGuard& operator=(const ReadGuard&) = delete;
+
+    private:
+        Buffer* buffer_;
+    };
+
+    SecretCache();
+
+    /**
+     * Lock-free lookup. Sequentially consistent pin-then-recheck pairs with
+     * the writer's swap-then-wait, so a buffer is never wiped mid-read.
+     */
+    template <typename Use>
+    bool read(size_t index, Use& use) {
+        Slot& slot = slots_[index];
+        while (true) {
+            Buffer* buffer = slot.current.load();
+            if (buffer == nullptr) {
+                return false;
+            }
+            ReadGuard guard(buffer);
+            if (slot.current.load() == buffer) {
+                use(buffer->data, buffer->length);
+                return true;
+            }
+            // Swapped out between the load and the pin; retry on the new one
+        }
+    }
+
+    /**
+     * Copy [plain] into the idle buffer of a slot and make it current.
+     * @return false if it does not fit or the cache was cleared after [epoch]
+     */
+    bool publish(size_t index, const char* plain, size_t length, uint64_t epoch);
+
+    static void waitForReaders(const Buffer& buffer);
+
+    std::mutex mutex_;   // serializes writers only
+    std::mutex loadMutexes_[static_cast<size_t>(SecretId::COUNT)];
+    LockedRegion region_;
+    size_t bufferSize_ = 0;
+    std::atomic<uint64_t> epoch_{0};
+    Slot slots_[static_cast<size_t>(SecretId::COUNT)];
+};
+
+} // namespace noghresod
+
+#endif // NOGHRESOD_SECRET_CACHE_H
@@ -0,0 +1,75 @@
+#include "secret_pipeline.h"
+
+#include <exception>
+#include "encryption.h"
+#include "native_trace.h"
+#include "obfuscation.h"
+
+#define LOG_TAG "NoghreSod_Keys"
+#include "native_log.h"
+
+using noghresod::DeviceInputs;
+using noghresod::DeviceKeyService;
+using noghresod::SecureString;
+
+// Device-bound AES-256-GCM payloads (Base64), obfuscated at compile time
+// with the per-build seed - see obfuscation.h
+// NOTE: Replace with the actual encrypted payloads before release
+namespace {
+    // Production API Key
+    constexpr auto API_KEY_PAYLOAD = NOGHRESOD_OBFUSCATE("REPLACE_WITH_ENCRYPTED_API_KEY");
+    
+    // Backup API Key
+    constexpr auto API_KEY_BACKUP_PAYLOAD = NOGHRESOD_OBFUSCATE("REPLACE_WITH_ENCRYPTED_BACKUP_KEY");
+    
+    // API Base URL (https://api.noghresod.ir/v1/)
+    constexpr auto API_URL_PAYLOAD = NOGHRESOD_OBFUSCATE("REPLACE_WITH_ENCRYPTED_API_URL");
+}
+
+/**
+ * Decrypt API key using multi-layer decryption:
+ * 1. Reveal the compile-time obfuscated payload
+ * 2. Base64 decode
+ * 3. AES-256-GCM decrypt
+ * 
+ * Every intermediate lives in the secure arena and is wiped on release.
+ * 
+ * @return Decrypted API key
+ */
+SecureString decryptApiKey(DeviceInputs& device) {
+    NOGHRESOD_TRACE_SCOPE("decryptApiKey");
+    try {
+        // Get device-specific binding key (derived once, then cached)
+        SecureString deviceKey = DeviceKeyService::instance().getKey(device);
+        
+        // Step 1: Reveal obfuscated payload
+        auto payload = API_KEY_PAYLOAD.reveal();
+        
+        // Step 2: Base64 decode
+        SecureString base64Decoded = base64Decode(payload.c_str(), payload.size());
+        
+        // Step 3: AES-256-GCM decrypt with device key
+        return aesDecrypt(base64Decoded, deviceKey);
+    } catch (const std::exception& e) {
+        LOGE("Failed to decrypt API key: %s", e.what());
+        return SecureString();
+    }
+}
+
+/**
+ * Decrypt API URL
+ */
+SecureString decryptApiUrl(DeviceInputs& device) {
+    NOGHRESOD_TRACE_SCOPE("decryptApiUrl");
+    try {
+        SecureString deviceKey = DeviceKeyService::instance().getKey(device);
+        
+        auto payload = API_URL_PAYLOAD.reveal();
+        
+        SecureString base64Decoded = base64Decode(payload.c_str(), payload.size());
+        return aesDecrypt(base64Decoded, deviceKey);
+    } catch (const std::exception& e) {
+        LOGE("Failed to decrypt API URL: %s", e.what());
+        return SecureString();
+    }
+}
@@ -0,0 +1,20 @@
+#ifndef NOGHRESOD_SECRET_PIPELINE_H
+#define NOGHRESOD_SECRET_PIPELINE_H
+
+#include "device_binding.h"
+#include "secure_arena.h"
+
+/**
+ * Device-bound secret decryption: reveal the obfuscated payload, Base64
+ * decode it, then AES-256-GCM decrypt it with the device-binding key.
+ *
+ * These are the uncached paths; callers normally go through SecretCache.
+ *
+ * @param device Fingerprint source for the binding key (read only on the
+ *               first call, see DeviceKeyService)
+ * @return Plaintext, or an empty string if any step fails
+ */
+noghresod::SecureString decryptApiKey(noghresod::DeviceInputs& device);
+noghresod::SecureString decryptApiUrl(noghresod::DeviceInputs& device);
+
+#endif // NOGHRESOD_SECRET_PIPELINE_H
@@ -0,0 +1,81 @@
+#include "secure_arena.h"
+
+#define LOG_TAG "NoghreSod_Keys"
+#include "native_log.h"
+
+namespace noghresod {
+
+namespace {
+    size_t alignUp(size_t size) {
+        return (size + SecureArena::ALIGNMENT - 1) & ~(SecureArena::ALIGNMENT - 1);
+    }
+}
+
+SecureArena& SecureArena::instance() {
+    static SecureArena arena(DEFAULT_SIZE);
+    return arena;
+}
+
+SecureArena::SecureArena(size_t size) : region_(size) {
+    if (!region_.valid()) {
+        LOGE("Secure arena unavailable - secrets fall back to the heap");
+    }
+}
+
+bool SecureArena::owns(const void* block) const {
+    const unsigned char* p = static_cast<const unsigned char*>(block);
+    return region_.valid() && p >= region_.data() && p < region_.data() + region_.size();
+}
+
+void* SecureArena::allocate(size_t size) {
+    size_t rounded = alignUp(size == 0 ? 1 : size);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (region_.valid() && rounded <= region_.size() - used_) {
+            void* block = region_.data() + used_;
+            used_ += rounded;
+            live_++;
+            return block;
+        }
+    }
+
+    LOGD("Secure arena full - %zu bytes served from the heap", size);
+    return ::operator new(rounded);
+}
+
+void SecureArena::deallocate(void* block, size_t size) {
+    if (block == nullptr) {
+        return;
+    }
+    size_t rounded = alignUp(size == 0 ? 1 : size);
+    secureWipe(block, rounded);
+
+    if (!owns(block)) {
+        ::operator delete(block);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    live_--;
+    if (live_ == 0) {
+        used_ = 0;
+    } else if (static_cast<unsigned char*>(block) + rounded == region_.data() + used_) {
+        // Last block out: give it straight back to the bump pointer
+        used_ -= rounded;
+    }
+}
+
+void SecureArena::wipe() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!region_.valid()) {
+        return;
+    }
+    if (live_ == 0) {
+        region_.wipe();
+        used_ = 0;
+    } else {
+        secureWipe(region_.data() + used_, region_.size() - used_);
+    }
+}
+
+} // namespace noghresod
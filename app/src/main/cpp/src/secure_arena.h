@@ -0,0 +1,92 @@
+#ifndef NOGHRESOD_SECURE_ARENA_H
+#define NOGHRESOD_SECURE_ARENA_H
+
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <string>
+#include <vector>
+#include "secure_memory.h"
+
+namespace noghresod {
+
+/**
+ * Scratch memory for the secret decrypt pipeline.
+ *
+ * One guard-paged LockedRegion served by a bump pointer: every temporary
+ * of the pipeline (device key copy, decoded payload, plaintext) lands in
+ * the same few locked pages instead of the general heap. Blocks are wiped
+ * when they are released; the most recent block is handed back to the bump
+ * pointer and the whole arena rewinds once nothing is live, so the steady
+ * state allocates no new memory at all.
+ *
+ * Requests that do not fit are served from the heap and still wiped on
+ * release.
+ */
+class SecureArena {
+public:
+    static const size_t DEFAULT_SIZE = 16 * 1024;
+    static const size_t ALIGNMENT = 16;
+
+    static SecureArena& instance();
+
+    void* allocate(size_t size);
+    void deallocate(void* block, size_t size);
+
+    /**
+     * Zero the whole arena in one pass. Live blocks are left alone.
+     */
+    void wipe();
+
+    size_t capacity() const { return region_.size(); }
+
+    SecureArena(const SecureArena&) = delete;
+    SecureArena& operator=(const SecureArena&) = delete;
+
+private:
+    explicit SecureArena(size_t size);
+
+    bool owns(const void* block) const;
+
+    std::mutex mutex_;
+    LockedRegion region_;
+    size_t used_ = 0;
+    size_t live_ = 0;
+};
+
+/**
+ * Standard allocator over SecureArena, for containers that hold secrets.
+ */
+template <typename T>
+struct SecureAllocator {
+    using value_type = T;
+
+    SecureAllocator() = default;
+
+    template <typename U>
+    SecureAllocator(const SecureAllocator<U>&) {}
+
+    T* allocate(size_t count) {
+        if (count > static_cast<size_t>(-1) / sizeof(T)) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T*>(SecureArena::instance().allocate(count * sizeof(T)));
+    }
+
+    void deallocate(T* block, size_t count) {
+        SecureArena::instance().deallocate(block, count * sizeof(T));
+    }
+
+    template <typename U>
+    bool operator==(const SecureAllocator<U>&) const { return true; }
+
+    template <typename U>
+    bool operator!=(const SecureAllocator<U>&) const { return false; }
+};
+
+using SecureString = std::basic_string<char, std::char_traits<char>, SecureAllocator<char>>;
+using SecureBytes = std::vector<unsigned char, SecureAllocator<unsigned char>>;
+
+} // namespace noghresod
+
+#endif // NOGHRESOD_SECURE_ARENA_H
@@ -0,0 +1,62 @@
+#include "secure_memory.h"
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#define LOG_TAG "NoghreSod_Keys"
+#include "native_log.h"
+
+namespace noghresod {
+
+LockedRegion::LockedRegion(size_t minSize) {
+    long pageSize = sysconf(_SC_PAGESIZE);
+    size_t page = pageSize > 0 ? static_cast<size_t>(pageSize) : 4096;
+    size_t size = ((minSize + page - 1) / page) * page;
+    if (size == 0) {
+        size = page;
+    }
+
+    // One inaccessible page on each side turns an overrun into a fault
+    // instead of a silent read or write of neighbouring memory
+    size_t mappedSize = size + 2 * page;
+    void* mapping = mmap(nullptr, mappedSize, PROT_NONE,
+                         MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapping == MAP_FAILED) {
+        LOGE("Failed to map locked region (%zu bytes)", size);
+        return;
+    }
+
+    unsigned char* region = static_cast<unsigned char*>(mapping) + page;
+    if (mprotect(region, size, PROT_READ | PROT_WRITE) != 0) {
+        LOGE("Failed to open locked region (%zu bytes)", size);
+        munmap(mapping, mappedSize);
+        return;
+    }
+
+    if (mlock(region, size) != 0) {
+        // RLIMIT_MEMLOCK can be tight on some devices; keep the mapping anyway
+        LOGE("Failed to lock region (%zu bytes)", size);
+    }
+    madvise(region, size, MADV_DONTDUMP);
+
+    mapping_ = mapping;
+    mappedSize_ = mappedSize;
+    data_ = region;
+    size_ = size;
+}
+
+LockedRegion::~LockedRegion() {
+    if (data_ != nullptr) {
+        wipe();
+        munlock(data_, size_);
+        munmap(mapping_, mappedSize_);
+    }
+}
+
+void LockedRegion::wipe() {
+    if (data_ != nullptr) {
+        secureWipe(data_, size_);
+    }
+}
+
+} // namespace noghresod
@@ -0,0 +1,71 @@
+#ifndef NOGHRESOD_SECURE_MEMORY_H
+#define NOGHRESOD_SECURE_MEMORY_H
+
+#include <cstddef>
+#include <string>
+
+namespace noghresod {
+
+/**
+ * Zero a buffer in a way the optimizer cannot elide.
+ *
+ * A plain memset() on memory that is freed right afterwards is a dead store
+ * and may be removed; writing through a volatile pointer is not.
+ */
+inline void secureWipe(void* data, size_t size) {
+    volatile unsigned char* p = static_cast<volatile unsigned char*>(data);
+    while (size--) {
+        *p++ = 0;
+    }
+}
+
+/**
+ * Zero the contents of a string before it is released.
+ * Covers the small-string buffer, which no allocator ever sees.
+ */
+template <typename Allocator>
+inline void secureWipe(std::basic_string<char, std::char_traits<char>, Allocator>& value) {
+    if (!value.empty()) {
+        secureWipe(&value[0], value.size());
+    }
+    value.clear();
+}
+
+/**
+ * Page-aligned anonymous mapping for secret material.
+ *
+ * The pages are mlock()ed so they are never swapped and marked
+ * MADV_DONTDUMP so they never end up in a core dump. A PROT_NONE guard page
+ * sits on either side, so running off either end faults. The region is
+ * wiped before it is unmapped.
+ */
+class LockedRegion {
+public:
+    /**
+     * @param minSize Requested size, rounded up to whole pages
+     */
+    explicit LockedRegion(size_t minSize);
+    ~LockedRegion();
+
+    LockedRegion(const LockedRegion&) = delete;
+    LockedRegion& operator=(const LockedRegion&) = delete;
+
+    bool valid() const { return data_ != nullptr; }
+    unsigned char* data() const { return data_; }
+    size_t size() const { return size_; }
+
+    /**
+     * Zero the whole region.
+     */
+    void wipe();
+
+private:
+    void* mapping_ = nullptr;
+    size_t mappedSize_ = 0;
+    unsigned char* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+} // namespace noghresod
+
+#endif // NOGHRESOD_SECURE_MEMORY_H
@@ -0,0 +1,36 @@
+#ifndef NOGHRESOD_SHA256_H
+#define NOGHRESOD_SHA256_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace noghresod {
+
+/**
+ * Incremental SHA-256 (FIPS 180-4).
+ * Self-contained so the device-binding path does not pull in libcrypto.
+ */
+class Sha256 {
+public:
+    static const size_t DIGEST_SIZE = 32;
+
+    Sha256();
+    ~Sha256();
+
+    void update(const void* data, size_t size);
+    void finish(uint8_t digest[DIGEST_SIZE]);
+
+    static void hash(const void* data, size_t size, uint8_t digest[DIGEST_SIZE]);
+
+private:
+    void compress(const uint8_t block[64]);
+
+    uint32_t state_[8];
+    uint8_t buffer_[64];
+    uint64_t length_ = 0;
+    size_t buffered_ = 0;
+};
+
+} // namespace noghresod
+
+#endif // NOGHRESOD_SHA256_H
@@ -0,0 +1,90 @@
+#ifndef NOGHRESOD_UTF8_H
+#define NOGHRESOD_UTF8_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace noghresod {
+
+/**
+ * Streaming UTF-8 to UTF-16 decoding for secrets handed to Java as chars.
+ * Malformed, overlong and surrogate sequences decode to U+FFFD.
+ */
+namespace utf8 {
+
+    const uint32_t REPLACEMENT = 0xFFFD;
+
+    /**
+     * Decode the code point at [p] and advance [p] past it.
+     */
+    inline uint32_t next(const char*& p, const char* end) {
+        uint8_t lead = static_cast<uint8_t>(*p++);
+        if (lead < 0x80) {
+            return lead;
+        }
+
+        size_t extra;
+        uint32_t cp;
+        uint32_t min;
+        if ((lead & 0xE0) == 0xC0) {
+            extra = 1; cp = lead & 0x1F; min = 0x80;
+        } else if ((lead & 0xF0) == 0xE0) {
+            extra = 2; cp = lead & 0x0F; min = 0x800;
+        } else if ((lead & 0xF8) == 0xF0) {
+            extra = 3; cp = lead & 0x07; min = 0x10000;
+        } else {
+            return REPLACEMENT;
+        }
+
+        for (size_t i = 0; i < extra; i++) {
+            if (p == end || (static_cast<uint8_t>(*p) & 0xC0) != 0x80) {
+                return REPLACEMENT;
+            }
+            cp = (cp << 6) | (static_cast<uint8_t>(*p++) & 0x3F);
+        }
+        if (cp < min || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) {
+            return REPLACEMENT;
+        }
+        return cp;
+    }
+
+    /**
+     * UTF-16 units of a code point: 1, or 2 for a surrogate pair.
+     */
+    inline size_t units(uint32_t cp) {
+        return cp >= 0x10000 ? 2 : 1;
+    }
+
+    /**
+     * Write [cp] as UTF-16 at [out].
+     * @return Units written
+     */
+    inline size_t encode(uint32_t cp, uint16_t* out) {
+        if (cp < 0x10000) {
+            out[0] = static_cast<uint16_t>(cp);
+            return 1;
+        }
+        cp -= 0x10000;
+        out[0] = static_cast<uint16_t>(0xD800 | (cp >> 10));
+        out[1] = static_cast<uint16_t>(0xDC00 | (cp & 0x3FF));
+        return 2;
+    }
+
+    /**
+     * Length of [size] bytes of UTF-8 in UTF-16 units.
+     */
+    inline size_t utf16Length(const char* data, size_t size) {
+        const char* p = data;
+        const char* end = data + size;
+        size_t length = 0;
+        while (p < end) {
+            length += units(next(p, end));
+        }
+        return length;
+    }
+
+} // namespace utf8
+
+} // namespace noghresod
+
+#endif // NOGHRESOD_UTF8_H
@@ -0,0 +1,240 @@
+#include "xor_kernel.h"
+
+#include <cstring>
+#include "cpu_features.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define NOGHRESOD_XOR_X86 1
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define NOGHRESOD_XOR_NEON 1
+#endif
+
+namespace noghresod {
+
+namespace xor_kernels {
+
+void scalar(uint8_t* dst, const uint8_t* src, size_t size,
+            const uint8_t* key, size_t keySize) {
+    size_t k = 0;
+    for (size_t i = 0; i < size; i++) {
+        dst[i] = src[i] ^ key[k];
+        if (++k == keySize) {
+            k = 0;
+        }
+    }
+}
+
+namespace {
+    /**
+     * Key bytes for successive WIDTH-byte steps.
+     *
+     * The key is repeated into a small buffer so the WIDTH bytes at offset
+     * phase are exactly the key bytes for the current position; moving to the
+     * next step only adjusts phase, with no per-byte modulo.
+     */
+    template <size_t WIDTH>
+    class KeyWindow {
+    public:
+        KeyWindow(const uint8_t* key, size_t keySize)
+            : keySize_(keySize), advance_(WIDTH % keySize) {
+            // Double the filled prefix until it covers keySize + WIDTH bytes
+            size_t total = keySize + WIDTH;
+            size_t filled = keySize;
+            std::memcpy(expanded_, key, keySize);
+            while (filled < total) {
+                size_t chunk = filled < total - filled ? filled : total - filled;
+                std::memcpy(expanded_ + filled, expanded_, chunk);
+                filled += chunk;
+            }
+        }
+
+        const uint8_t* current() const { return expanded_ + phase_; }
+
+        void next() {
+            phase_ += advance_;
+            if (phase_ >= keySize_) {
+                phase_ -= keySize_;
+            }
+        }
+
+        /**
+         * Finish the last partial step with the scalar loop.
+         */
+        void tail(uint8_t* dst, const uint8_t* src, size_t size) const {
+            if (size > 0) {
+                scalar(dst, src, size, current(), keySize_);
+            }
+        }
+
+    private:
+        uint8_t expanded_[MAX_VECTOR_KEY_SIZE + WIDTH];
+        size_t keySize_;
+        size_t advance_;
+        size_t phase_ = 0;
+    };
+
+    /**
+     * Short inputs do not repay the key expansion.
+     */
+    bool useScalar(size_t size, size_t keySize, size_t width) {
+        return keySize > MAX_VECTOR_KEY_SIZE || size < width * 4;
+    }
+
+    void wordKernel(uint8_t* dst, const uint8_t* src, size_t size,
+                    const uint8_t* key, size_t keySize) {
+        if (useScalar(size, keySize, 8)) {
+            scalar(dst, src, size, key, keySize);
+            return;
+        }
+
+        KeyWindow<8> window(key, keySize);
+        size_t i = 0;
+        for (; i + 8 <= size; i += 8) {
+            uint64_t data;
+            uint64_t mask;
+            std::memcpy(&data, src + i, sizeof(data));
+            std::memcpy(&mask, window.current(), sizeof(mask));
+            data ^= mask;
+            std::memcpy(dst + i, &data, sizeof(data));
+            window.next();
+        }
+        window.tail(dst + i, src + i, size - i);
+    }
+
+#ifdef NOGHRESOD_XOR_X86
+    void sse2Kernel(uint8_t* dst, const uint8_t* src, size_t size,
+                    const uint8_t* key, size_t keySize) {
+        if (useScalar(size, keySize, 16)) {
+            scalar(dst, src, size, key, keySize);
+            return;
+        }
+
+        KeyWindow<16> window(key, keySize);
+        size_t i = 0;
+        for (; i + 16 <= size; i += 16) {
+            __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            __m128i mask = _mm_loadu_si128(reinterpret_cast<const __m128i*>(window.current()));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_xor_si128(data, mask));
+            window.next();
+        }
+        window.tail(dst + i, src + i, size - i);
+    }
+
+    __attribute__((target("avx2")))
+    void avx2Kernel(uint8_t* dst, const uint8_t* src, size_t size,
+                    const uint8_t* key, size_t keySize) {
+        if (useScalar(size, keySize, 32)) {
+            scalar(dst, src, size, key, keySize);
+            return;
+        }
+
+        KeyWindow<32> window(key, keySize);
+        size_t i = 0;
+        for (; i + 32 <= size; i += 32) {
+            __m256i data = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+            __m256i mask = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(window.current()));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_xor_si256(data, mask));
+            window.next();
+        }
+        window.tail(dst + i, src + i, size - i);
+    }
+#endif
+
+#ifdef NOGHRESOD_XOR_NEON
+    void neonKernel(uint8_t* dst, const uint8_t* src, size_t size,
+                    const uint8_t* key, size_t keySize) {
+        if (useScalar(size, keySize, 32)) {
+            scalar(dst, src, size, key, keySize);
+            return;
+        }
+
+        KeyWindow<32> window(key, keySize);
+        size_t i = 0;
+        for (; i + 32 <= size; i += 32) {
+            const uint8_t* k = window.current();
+            uint8x16_t lo = veorq_u8(vld1q_u8(src + i), vld1q_u8(k));
+            uint8x16_t hi = veorq_u8(vld1q_u8(src + i + 16), vld1q_u8(k + 16));
+            vst1q_u8(dst + i, lo);
+            vst1q_u8(dst + i + 16, hi);
+            window.next();
+        }
+        window.tail(dst + i, src + i, size - i);
+    }
+#endif
+}
+
+void word(uint8_t* dst, const uint8_t* src, size_t size,
+          const uint8_t* key, size_t keySize) {
+    wordKernel(dst, src, size, key, keySize);
+}
+
+XorFn sse2() {
+#ifdef NOGHRESOD_XOR_X86
+    return sse2Kernel;
+#else
+    return nullptr;
+#endif
+}
+
+XorFn avx2() {
+#ifdef NOGHRESOD_XOR_X86
+    return avx2Kernel;
+#else
+    return nullptr;
+#endif
+}
+
+XorFn neon() {
+#ifdef NOGHRESOD_XOR_NEON
+    return neonKernel;
+#else
+    return nullptr;
+#endif
+}
+
+bool cpuHasAvx2() {
+    return cpuFeatures().has(CPU_AVX2);
+}
+
+bool cpuHasNeon() {
+    return cpuFeatures().has(CPU_NEON);
+}
+
+} // namespace xor_kernels
+
+namespace {
+    using XorEntry = DispatchEntry<xor_kernels::XorFn>;
+
+    const XorEntry& dispatch() {
+        // SSE2 is the baseline of every x86 Android ABI, so it needs no check
+        static const XorEntry TABLE[] = {
+            { CPU_NEON, xor_kernels::neon(), "neon" },
+            { CPU_AVX2, xor_kernels::avx2(), "avx2" },
+            { 0, xor_kernels::sse2(), "sse2" },
+            { 0, xor_kernels::word, "word" },
+        };
+        static const XorEntry& selected = selectKernel(TABLE);
+        return selected;
+    }
+}
+
+void xorWithKey(uint8_t* dst, const uint8_t* src, size_t size,
+                const uint8_t* key, size_t keySize) {
+    if (size == 0 || keySize == 0) {
+        if (dst != src && size > 0) {
+            std::memmove(dst, src, size);
+        }
+        return;
+    }
+    dispatch().fn(dst, src, size, key, keySize);
+}
+
+const char* xorKernelName() {
+    return dispatch().name;
+}
+
+} // namespace noghresod
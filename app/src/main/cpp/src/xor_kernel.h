@@ -0,0 +1,59 @@
+#ifndef NOGHRESOD_XOR_KERNEL_H
+#define NOGHRESOD_XOR_KERNEL_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace noghresod {
+
+/**
+ * XOR [size] bytes of [src] with a repeating [key] into [dst].
+ *
+ * The byte at offset i is combined with key[i % keySize]. [dst] may equal
+ * [src] for in-place decoding. The fastest kernel for the running CPU is
+ * picked from a dispatch table on first use (NEON on ARM, AVX2/SSE2 on x86,
+ * the 64-bit word kernel otherwise - e.g. armeabi-v7a cores without NEON).
+ */
+void xorWithKey(uint8_t* dst, const uint8_t* src, size_t size,
+                const uint8_t* key, size_t keySize);
+
+/**
+ * Name of the kernel xorWithKey() dispatches to ("neon", "avx2", "sse2" or "word").
+ */
+const char* xorKernelName();
+
+namespace xor_kernels {
+
+    using XorFn = void (*)(uint8_t* dst, const uint8_t* src, size_t size,
+                           const uint8_t* key, size_t keySize);
+
+    // Longest key the vector kernels expand on the stack; longer keys go scalar
+    const size_t MAX_VECTOR_KEY_SIZE = 256;
+
+    // Byte-at-a-time reference
+    void scalar(uint8_t* dst, const uint8_t* src, size_t size,
+                const uint8_t* key, size_t keySize);
+
+    // Portable fallback: 8 bytes per step in general-purpose registers
+    void word(uint8_t* dst, const uint8_t* src, size_t size,
+              const uint8_t* key, size_t keySize);
+
+    /**
+     * Kernels compiled into this build, or nullptr when the target has none.
+     * Availability on the running CPU is checked by xorWithKey(), not here.
+     */
+    XorFn sse2();
+    XorFn avx2();
+    XorFn neon();
+
+    /**
+     * Whether the running CPU can execute each kernel (see cpu_features.h).
+     */
+    bool cpuHasAvx2();
+    bool cpuHasNeon();
+
+} // namespace xor_kernels
+
+} // namespace noghresod
+
+#endif // NOGHRESOD_XOR_KERNEL_H
@@ -7,6 +7,8 @@ import com.noghre.sod.core.network.AuthInterceptor
 import com.noghre.sod.core.network.CertificatePinningConfig
 import com.noghre.sod.core.network.LoggingInterceptor
 import com.noghre.sod.core.network.RetryInterceptor
+import com.noghre.sod.core.security.NativeKeys
+import com.noghre.sod.core.security.NativeNetworkConfig
 import dagger.Module
 import dagger.Provides
 import dagger.hilt.InstallIn
@@ -49,6 +51,28 @@ object NetworkModule {
         .setPrettyPrinting()
         .create()
 
+    // ============== Native Network Config ==============\n
+    /**
+     * Provides network settings held in native code.
+     *
+     * Fetched as one bundle so building the network graph costs a single
+     * JNI transition instead of one per value. Falls back to [AppConfig.Api]
+     * if the native library is unavailable, so networking never depends on it.
+     */
+    @Provides
+    @Singleton
+    fun provideNativeNetworkConfig(): NativeNetworkConfig = NativeKeys.getNetworkConfigSafe()
+
+    /**
+     * Provides RetryInterceptor configured from the native retry policy.
+     */
+    @Provides
+    @Singleton
+    fun provideRetryInterceptor(config: NativeNetworkConfig): RetryInterceptor = RetryInterceptor(
+        maxRetries = config.maxRetries,
+        initialDelayMs = config.retryDelayMs.toLong()
+    )
+
     // ============== OkHttpClient Configuration ==============\n
     /**
      * Provides OkHttpClient with all interceptors and security settings.
@@ -1,5 +1,7 @@
 package com.noghre.sod.core.ext
 
+import com.noghre.sod.core.util.NativeDateFormatter
+import com.noghre.sod.core.util.NativeJalali
 import java.util.*
 import java.text.SimpleDateFormat
 import android.text.format.DateUtils
@@ -18,17 +20,12 @@ import android.text.format.DateUtils
  * - "yyyy/MM/dd" -> "1402/10/09"
  * - "MMMM d, yyyy" -> "دی 9, 1402"
  * 
- * @param pattern Date format pattern
+ * @param pattern Date format pattern, see [NativeDateFormatter.Pattern];
+ *        parsed once and cached by [NativeDateFormatter.patternOf]
  * @return Formatted Jalali date string
  */
-fun Date.toJalaliString(pattern: String = "yyyy/MM/dd"): String {
-    val calendar = Calendar.getInstance().apply {
-        time = this@toJalaliString
-    }
-    return formatJalali(calendar.get(Calendar.YEAR), 
-                        calendar.get(Calendar.MONTH), 
-                        calendar.get(Calendar.DAY_OF_MONTH))
-}
+fun Date.toJalaliString(pattern: String = "yyyy/MM/dd"): String =
+    NativeDateFormatter.format(time, NativeDateFormatter.patternOf(pattern), persianDigits = false)
 
 /**
  * Converts Gregorian date to Jalali components (year, month, day).
@@ -36,34 +33,8 @@ fun Date.toJalaliString(pattern: String = "yyyy/MM/dd"): String {
  * @return Triple of (jalaliYear, jalaliMonth, jalaliDay)
  */
 fun Date.toJalaliComponents(): Triple<Int, Int, Int> {
-    val calendar = Calendar.getInstance().apply {
-        time = this@toJalaliComponents
-    }
-    
-    val gy = calendar.get(Calendar.YEAR)
-    val gm = calendar.get(Calendar.MONTH) + 1
-    val gd = calendar.get(Calendar.DAY_OF_MONTH)
-    
-    val g_d_n = 365 * gy + ((gy + 3) / 4) - ((gy + 99) / 100) + ((gy + 399) / 400) + gd
-    
-    val j_d_n = g_d_n - 79
-    
-    val j_np = j_d_n / 12053
-    val j_d_n_rem = j_d_n % 12053
-    
-    val jy = 979 + 2820 * j_np + (1461 * j_d_n_rem) / 1029983
-    
-    val j_d_n_rem2 = j_d_n_rem % 1029983
-    val jp = (j_d_n_rem2 / 365).toInt()
-    val j_d_n_rem3 = j_d_n_rem2 % 365
-    
-    var jm = (6 * (jp + 1)).toInt()
-    var jd = (j_d_n_rem3 + 1).toInt()
-    
-    if (jm > 12) jm = 12
-    if (jd > daysInMonthJalali(jm, jy)) jd = daysInMonthJalali(jm, jy)
-    
-    return Triple(jy, jm, jd)
+    val date = NativeJalali.fromEpochMillis(time)
+    return Triple(date.year, date.month, date.day)
 }
 
 /**
@@ -148,23 +119,3 @@ fun Date.getPersianDisplayDate(): String {
         }
     }
 }
-
-// Private helper functions
-
-private fun formatJalali(jy: Int, jm: Int, jd: Int): String {
-    val gy = jy + 1600
-    val gm = jm + 8
-    val gd = jd
-    
-    var leaps = ((gy - 1600) / 4) - ((gy - 1600) / 100) + ((gy - 1600) / 400)
-    var days = 0
-    for (i in 1600 until gy) {
-        days += if (i % 400 == 0 || (i % 4 == 0 && i % 100 != 0)) 366 else 365
-    }
-    
-    return String.format("%04d/%02d/%02d", jy, jm, jd)
-}
-
-private fun daysInMonthJalali(month: Int, year: Int): Int {
-    return if (month <= 6) 31 else if (month <= 11) 30 else if ((year + 1346) % 33 % 4 == 1 && (year + 1346) % 33 == 1) 30 else 29
-}
@@ -1,13 +1,21 @@
 package com.noghre.sod.core.ext
 
+import com.noghre.sod.core.util.NativeMoney
+import com.noghre.sod.core.util.NativeMoney.Rounding
 import java.text.NumberFormat
 import java.util.*
-import kotlin.math.roundToInt
+import kotlin.math.abs
+import kotlin.math.roundToLong
 
 /**
  * Extension functions for money/price handling in jewelry commerce.
  * 
- * Supports Iranian currency (Rial) and jewelry pricing.
+ * Supports Iranian currency (Rial) and jewelry pricing. Arithmetic is done
+ * in whole Rial by [NativeMoney]: the Long overloads take rates in basis
+ * points (900 = 9%) and an explicit [Rounding], and throw
+ * ArithmeticException if a product overflows. The Double ones round the
+ * amount to Rial and the percentage to basis points first, and never
+ * throw: amounts beyond exact whole Rials stay in Double arithmetic.
  * 
  * @author NoghreSod Team
  * @version 1.0.0
@@ -29,7 +37,7 @@ fun Double.formatPrice(showCurrency: Boolean = true): String {
         maximumFractionDigits = 0
     }
     
-    val formatted = formatter.format(this.toLong())
+    val formatted = formatter.format(Math.round(this))
     return if (showCurrency) "$formatted ریال" else formatted
 }
 
@@ -62,16 +70,16 @@ fun Double.formatPriceWithDecimals(decimals: Int = 2): String {
  * @return Formatted weight-price string
  */
 fun Double.formatByGram(): String {
-    return "${this.toPersianNumbers()} گرم (بر هر گرم)"
+    return "${this.toString().toPersianNumbers()} گرم (بر هر گرم)"
 }
 
 /**
- * Converts price to Rials with proper decimal handling.
+ * Converts price to whole Rials, rounding half away from zero.
  * 
  * @return Price in Rials as Long
  */
 fun Double.toRials(): Long {
-    return (this * 10).roundToInt() / 10L
+    return this.roundToLong()
 }
 
 /**
@@ -92,24 +100,91 @@ fun String.parsePrice(): Double {
     return cleanPrice.toDoubleOrNull() ?: 0.0
 }
 
+/**
+ * Calculates discount amount from original price.
+ * 
+ * @param discountBps Discount in basis points (0-10000)
+ * @param rounding Rounding of the amount
+ * @return Discount amount in Rials
+ * @throws ArithmeticException if the amount times the rate overflows a Long
+ */
+fun Long.calculateDiscount(discountBps: Int, rounding: Rounding = Rounding.HALF_UP): Long {
+    return NativeMoney.percentOf(this, discountBps, rounding)
+}
+
+/**
+ * Calculates final price after discount.
+ * 
+ * @param discountBps Discount in basis points
+ * @param rounding Rounding of the discount
+ * @return Price after discount in Rials
+ * @throws ArithmeticException if the amount times the rate overflows a Long
+ */
+fun Long.applyDiscount(discountBps: Int, rounding: Rounding = Rounding.HALF_UP): Long {
+    return this - this.calculateDiscount(discountBps, rounding)
+}
+
+/**
+ * Calculates tax amount (VAT).
+ * 
+ * Default Iranian VAT rate: 9%
+ * 
+ * @param taxBps Tax in basis points (default 900)
+ * @param rounding Rounding of the amount
+ * @return Tax amount in Rials
+ * @throws ArithmeticException if the amount times the rate overflows a Long
+ */
+fun Long.calculateTax(taxBps: Int = NativeMoney.VAT_BPS, rounding: Rounding = Rounding.HALF_UP): Long {
+    return NativeMoney.percentOf(this, taxBps, rounding)
+}
+
+/**
+ * Calculates final price including tax.
+ * 
+ * @param taxBps Tax in basis points
+ * @param rounding Rounding of the tax
+ * @return Price including tax in Rials
+ * @throws ArithmeticException if the amount times the rate overflows a Long
+ */
+fun Long.applyTax(taxBps: Int = NativeMoney.VAT_BPS, rounding: Rounding = Rounding.HALF_UP): Long {
+    return this + this.calculateTax(taxBps, rounding)
+}
+
+/**
+ * Calculates total cost with discount and tax.
+ * 
+ * @param discountBps Discount in basis points
+ * @param taxBps Tax in basis points, on the discounted price
+ * @param rounding Rounding of the discount and the tax
+ * @return Final total price in Rials
+ * @throws ArithmeticException if the amount times the rate overflows a Long
+ */
+fun Long.calculateTotal(
+    discountBps: Int,
+    taxBps: Int = NativeMoney.VAT_BPS,
+    rounding: Rounding = Rounding.HALF_UP
+): Long {
+    return this.applyDiscount(discountBps, rounding).applyTax(taxBps, rounding)
+}
+
 /**
  * Calculates discount amount from original price.
  * 
  * @param discountPercent Discount percentage (0-100)
- * @return Discount amount
+ * @return Discount amount, in whole Rials
  */
 fun Double.calculateDiscount(discountPercent: Double): Double {
-    return this * (discountPercent / 100)
+    return this.percentInRials(discountPercent)
 }
 
 /**
  * Calculates final price after discount.
  * 
  * @param discountPercent Discount percentage
- * @return Price after discount
+ * @return Price after discount, in whole Rials
  */
 fun Double.applyDiscount(discountPercent: Double): Double {
-    return this - this.calculateDiscount(discountPercent)
+    return this.inWholeRials() - this.calculateDiscount(discountPercent)
 }
 
 /**
@@ -118,20 +193,20 @@ fun Double.applyDiscount(discountPercent: Double): Double {
  * Default Iranian VAT rate: 9%
  * 
  * @param taxPercent Tax percentage (default 9%)
- * @return Tax amount
+ * @return Tax amount, in whole Rials
  */
 fun Double.calculateTax(taxPercent: Double = 9.0): Double {
-    return this * (taxPercent / 100)
+    return this.percentInRials(taxPercent)
 }
 
 /**
  * Calculates final price including tax.
  * 
  * @param taxPercent Tax percentage
- * @return Price including tax
+ * @return Price including tax, in whole Rials
  */
 fun Double.applyTax(taxPercent: Double = 9.0): Double {
-    return this + this.calculateTax(taxPercent)
+    return this.inWholeRials() + this.calculateTax(taxPercent)
 }
 
 /**
@@ -139,11 +214,28 @@ fun Double.applyTax(taxPercent: Double = 9.0): Double {
  * 
  * @param discountPercent Discount percentage
  * @param taxPercent Tax percentage
- * @return Final total price
+ * @return Final total price, in whole Rials
  */
 fun Double.calculateTotal(discountPercent: Double, taxPercent: Double = 9.0): Double {
-    val afterDiscount = this.applyDiscount(discountPercent)
-    return afterDiscount.applyTax(taxPercent)
+    return this.applyDiscount(discountPercent).applyTax(taxPercent)
+}
+
+// Above 2^53 a Double no longer holds every whole Rial, so there is nothing to round
+private const val MAX_EXACT_RIALS = 9_007_199_254_740_992.0
+
+private fun Double.inWholeRials(): Double =
+    if (abs(this) < MAX_EXACT_RIALS) this.toRials().toDouble() else this
+
+/**
+ * [percent] of this amount via [NativeMoney], in whole Rials, falling back
+ * to Double arithmetic where the exact product would overflow.
+ */
+private fun Double.percentInRials(percent: Double): Double {
+    if (abs(this) < MAX_EXACT_RIALS && abs(percent) < MAX_EXACT_RIALS) {
+        NativeMoney.mulDivOrNull(this.toRials(), Math.round(percent * 100), NativeMoney.BASIS_POINTS.toLong())
+            ?.let { return it.toDouble() }
+    }
+    return this * (percent / 100)
 }
 
 /**
@@ -160,14 +252,24 @@ fun Double.isEligibleForFreeShipping(threshold: Double = 500000.0): Boolean {
 /**
  * Formats price as jewelry weight (grams) with price per gram.
  * 
- * @param weightGrams Weight in grams
- * @param pricePerGram Price per gram
+ * @param weightGrams Weight in grams, to the milligram
+ * @param pricePerGram Price per gram, in whole Rials
  * @return Formatted display string
  */
 fun Double.formatJewelryPrice(weightGrams: Double, pricePerGram: Double): String {
-    val total = weightGrams * pricePerGram
-    val formattedWeight = weightGrams.toPersianNumbers()
-    val formattedTotal = total.formatPrice()
+    // Never throws: a weight or price too large for exact Rials is shown from Double
+    val exact = if (abs(weightGrams) < MAX_EXACT_RIALS && abs(pricePerGram) < MAX_EXACT_RIALS) {
+        NativeMoney.mulDivOrNull(
+            NativeMoney.gramsToMg(weightGrams),
+            pricePerGram.toRials(),
+            NativeMoney.MILLIGRAMS_PER_GRAM
+        )
+    } else {
+        null
+    }
+    val total = exact?.toDouble() ?: (weightGrams * pricePerGram)
+    val formattedWeight = weightGrams.toString().toPersianNumbers()
+    val formattedTotal = total.toDouble().formatPrice()
     
     return "$formattedWeight گرم @ $formattedTotal"
 }
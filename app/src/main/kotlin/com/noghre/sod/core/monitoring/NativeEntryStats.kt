@@ -0,0 +1,97 @@
+package com.noghre.sod.core.monitoring
+
+import java.nio.BufferUnderflowException
+import java.nio.ByteBuffer
+import java.nio.ByteOrder
+
+/**
+ * Call count and latency histogram of one native entry point, as recorded
+ * by the native library since start-up (or the last [NativeStats.reset]).
+ *
+ * @param name Kotlin class and method, e.g. "KeyProvider.getApiKey"
+ * @param buckets Histogram as bucket index to call count, non-empty buckets only
+ */
+data class NativeEntryStats(
+    val name: String,
+    val calls: Long,
+    val totalNs: Long,
+    val maxNs: Long,
+    val subBucketBits: Int,
+    val buckets: Map<Int, Int>
+) {
+
+    val meanNs: Long
+        get() = if (calls == 0L) 0L else totalNs / calls
+
+    /**
+     * Latency at [percentile] (0..100), as the lower bound of the histogram
+     * bucket it falls into. Buckets are log-linear, so this is at most one
+     * bucket width (25% with two sub-bucket bits) below the real value.
+     */
+    fun percentileNs(percentile: Double): Long {
+        val total = buckets.values.sumOf { it.toLong() }
+        if (total == 0L) return 0L
+
+        val rank = Math.ceil(total * percentile.coerceIn(0.0, 100.0) / 100.0).toLong().coerceAtLeast(1L)
+        var seen = 0L
+        for ((bucket, count) in buckets.toSortedMap()) {
+            seen += count
+            if (seen >= rank) {
+                return minOf(bucketLowerBound(bucket, subBucketBits), maxNs)
+            }
+        }
+        return maxNs
+    }
+
+    companion object {
+        /** Layout version this decoder understands; see native_stats.h */
+        const val SNAPSHOT_VERSION = 1
+
+        /**
+         * Smallest latency (ns) that lands in [bucket]; mirrors
+         * NativeStats::bucketLowerBound.
+         */
+        fun bucketLowerBound(bucket: Int, subBucketBits: Int): Long {
+            val subBuckets = 1 shl subBucketBits
+            if (bucket < subBuckets) return bucket.toLong()
+            val exponent = bucket / subBuckets + subBucketBits - 1
+            val mantissa = (subBuckets + bucket % subBuckets).toLong()
+            return mantissa shl (exponent - subBucketBits)
+        }
+
+        /**
+         * Decode a snapshot from `NativeStats.dumpNativeStats()`.
+         * @throws IllegalArgumentException if the snapshot is malformed or
+         *         from an unknown layout version
+         */
+        fun decode(snapshot: ByteArray): List<NativeEntryStats> {
+            val buffer = ByteBuffer.wrap(snapshot).order(ByteOrder.nativeOrder())
+            try {
+                val version = buffer.int
+                require(version == SNAPSHOT_VERSION) { "Unknown native stats version $version" }
+                val entryCount = buffer.int
+                val subBucketBits = buffer.int
+                require(entryCount >= 0 && subBucketBits in 0..8) { "Malformed native stats header" }
+
+                return List(entryCount) {
+                    val name = ByteArray(buffer.int).also { buffer.get(it) }.toString(Charsets.UTF_8)
+                    val calls = buffer.long
+                    val totalNs = buffer.long
+                    val maxNs = buffer.long
+                    val bucketCount = buffer.int
+                    require(bucketCount >= 0) { "Malformed native stats entry $name" }
+                    val buckets = LinkedHashMap<Int, Int>(bucketCount)
+                    repeat(bucketCount) {
+                        val bucket = buffer.int
+                        buckets[bucket] = buffer.int
+                    }
+                    NativeEntryStats(name, calls, totalNs, maxNs, subBucketBits, buckets)
+                }
+            } catch (e: BufferUnderflowException) {
+                throw IllegalArgumentException("Truncated native stats snapshot", e)
+            } catch (e: NegativeArraySizeException) {
+                throw IllegalArgumentException("Malformed native stats entry name", e)
+            }
+        }
+    }
+}
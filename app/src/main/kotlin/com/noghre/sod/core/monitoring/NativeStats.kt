@@ -0,0 +1,46 @@
+package com.noghre.sod.core.monitoring
+
+import com.noghre.sod.core.security.NativeLibrary
+
+/**
+ * Per-entry-point counters and latency histograms kept by the native
+ * library (src/native_stats.h). Recording is lock-free on the native side;
+ * reading copies one compact snapshot across JNI.
+ */
+@Suppress("KotlinJniMissing")
+object NativeStats {
+
+    init {
+        NativeLibrary.ensureLoaded()
+    }
+
+    /**
+     * Every native entry point called since start-up or the last [reset]
+     * or [snapshotAndReset].
+     * Empty when the native library is unavailable.
+     */
+    fun snapshot(): List<NativeEntryStats> {
+        if (!NativeLibrary.isLoaded) return emptyList()
+        return NativeEntryStats.decode(dumpNativeStats())
+    }
+
+    /**
+     * [snapshot] and [reset] in one native pass: each counter is zeroed as
+     * it is read, so calls made between the two are not lost.
+     */
+    fun snapshotAndReset(): List<NativeEntryStats> {
+        if (!NativeLibrary.isLoaded) return emptyList()
+        return NativeEntryStats.decode(dumpAndResetNativeStats())
+    }
+
+    /**
+     * Zero every native counter.
+     */
+    fun reset() {
+        if (NativeLibrary.isLoaded) resetNativeStats()
+    }
+
+    private external fun dumpNativeStats(): ByteArray
+    private external fun dumpAndResetNativeStats(): ByteArray
+    private external fun resetNativeStats()
+}
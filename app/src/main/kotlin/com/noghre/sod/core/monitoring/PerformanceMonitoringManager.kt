@@ -27,6 +27,7 @@ import kotlin.system.measureTimeMillis
  * - Custom trace monitoring
  * - Battery drain detection
  * - Thermal state monitoring
+ * - Native entry-point latency (NativeStats)
  *
  * @since 1.0.0
  */
@@ -307,6 +308,44 @@ class PerformanceMonitoringManager @Inject constructor(
         }
     }
     
+    // ==================== NATIVE LIBRARY ====================
+    
+    /**
+     * Call counts and latency histograms of the native entry points
+     */
+    fun getNativeStats(): List<NativeEntryStats> = readNativeStats(reset = false)
+    
+    /**
+     * Ship the native stats as one trace per entry point.
+     * With [reset] the counters are zeroed in the same native pass that reads
+     * them, so each upload is a delta and no call falls between two uploads.
+     */
+    fun logNativeStats(reset: Boolean = true) {
+        val stats = readNativeStats(reset)
+        
+        for (entry in stats) {
+            val trace = performance.newTrace("native_${entry.name}")
+            trace.putMetric("calls", entry.calls)
+            trace.putMetric("mean_ns", entry.meanNs)
+            trace.putMetric("p50_ns", entry.percentileNs(50.0))
+            trace.putMetric("p99_ns", entry.percentileNs(99.0))
+            trace.putMetric("max_ns", entry.maxNs)
+            trace.start()
+            trace.stop()
+        }
+        
+        Timber.d("📐 Native stats shipped for ${stats.size} entry points")
+    }
+    
+    private fun readNativeStats(reset: Boolean): List<NativeEntryStats> {
+        return try {
+            if (reset) NativeStats.snapshotAndReset() else NativeStats.snapshot()
+        } catch (e: IllegalArgumentException) {
+            Timber.e(e, "Error decoding native stats")
+            emptyList()
+        }
+    }
+    
     // ==================== COMPREHENSIVE METRICS ====================
     
     /**
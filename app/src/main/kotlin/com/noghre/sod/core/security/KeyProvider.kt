@@ -1,5 +1,7 @@
 package com.noghre.sod.core.security
 
+import java.nio.ByteBuffer
+
 /**
  * Secure key provider using NDK (Native C++) for API key storage.
  * 
@@ -9,20 +11,30 @@ package com.noghre.sod.core.security
  * - Device-bound encryption (unique per device)
  * - Obfuscation at compile time
  * 
- * Keys are loaded from libnoghresod_keys.so (compiled C++ library)
+ * Keys are served by libnoghresod_secure.so (app/src/main/cpp/jni/keys.cpp)
  * 
  * @since 1.0.0
  */
 object KeyProvider {
     
+    /**
+     * Secrets held in the native cache.
+     * Ordinals mirror SecretId in secret_cache.h.
+     */
+    enum class Secret {
+        API_KEY,
+        API_BASE_URL
+    }
+    
     init {
         // Load native library containing encrypted keys
-        System.loadLibrary("noghresod_keys")
+        NativeLibrary.ensureLoaded()
     }
     
     /**
      * Get API key from native code.
-     * Key is encrypted and device-bound.
+     * Key is encrypted and device-bound. It is decrypted once and then served
+     * from a locked native cache until [clearSensitiveData] is called.
      * 
      * @return Decrypted API key
      */
@@ -51,7 +63,52 @@ object KeyProvider {
     
     /**
      * Safely clear sensitive data from memory.
+     * Wipes the native secret cache; the next lookup decrypts again.
      * Call when app goes to background or on logout.
      */
     external fun clearSensitiveData()
+    
+    /**
+     * Decrypt [secret] into the native cache without returning it, so the
+     * first real lookup is a cache hit. Used by [NativeWarmUp].
+     * 
+     * @return false if the secret could not be decrypted
+     */
+    fun prefetch(secret: Secret): Boolean = nativePrefetch(secret.ordinal)
+    
+    /**
+     * Write [secret] as UTF-8 into the direct [buffer] at its position,
+     * without creating a String. Reuse one buffer across calls and wipe it
+     * after use; nothing else keeps a copy on the Java heap.
+     * 
+     * @return Secret length in bytes. If it exceeds `buffer.remaining()`
+     *         nothing is written; otherwise the position advances past it.
+     *         -1 if the secret is unavailable.
+     */
+    fun readSecret(secret: Secret, buffer: ByteBuffer): Int {
+        require(buffer.isDirect) { "Secrets are only written into direct buffers" }
+        val length = nativeReadSecretBytes(secret.ordinal, buffer, buffer.position(), buffer.remaining())
+        if (length in 0..buffer.remaining()) {
+            buffer.position(buffer.position() + length)
+        }
+        return length
+    }
+    
+    /**
+     * Write [secret] as UTF-16 into [chars] from [offset], without creating
+     * a String. Wipe the array (`chars.fill('\u0000')`) after use.
+     * 
+     * @return Secret length in chars; nothing is written if it does not fit
+     *         after [offset]. -1 if the secret is unavailable.
+     */
+    fun readSecret(secret: Secret, chars: CharArray, offset: Int = 0): Int {
+        require(offset in 0..chars.size) { "Offset $offset outside 0..${chars.size}" }
+        return nativeReadSecretChars(secret.ordinal, chars, offset)
+    }
+    
+    private external fun nativePrefetch(secretId: Int): Boolean
+    
+    private external fun nativeReadSecretBytes(secretId: Int, buffer: ByteBuffer, offset: Int, capacity: Int): Int
+    
+    private external fun nativeReadSecretChars(secretId: Int, chars: CharArray, offset: Int): Int
 }
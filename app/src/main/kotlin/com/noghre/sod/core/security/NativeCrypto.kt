@@ -0,0 +1,185 @@
+package com.noghre.sod.core.security
+
+import android.os.ParcelFileDescriptor
+import java.io.Closeable
+import java.io.File
+import java.io.IOException
+import java.nio.ByteBuffer
+import javax.crypto.AEADBadTagException
+
+/**
+ * Native AES-256-GCM for large local payloads (Room exports, cached API
+ * responses, file logs).
+ *
+ * The local-data key is derived and held in native memory only; it never
+ * crosses into Java. Data is processed in place between direct buffers or
+ * straight between file descriptors, so nothing is copied onto the Java heap.
+ *
+ * Encrypted payloads are laid out as
+ * `header (HEADER_SIZE) || ciphertext || tag (TAG_SIZE)`.
+ */
+@Suppress("KotlinJniMissing")
+object NativeCrypto {
+
+    const val HEADER_SIZE = 16
+    const val TAG_SIZE = 16
+
+    init {
+        NativeLibrary.ensureLoaded()
+    }
+
+    /**
+     * Encrypt everything readable from [input] into [output].
+     * @throws IOException if reading, writing or key setup fails
+     */
+    fun encrypt(input: ParcelFileDescriptor, output: ParcelFileDescriptor) {
+        if (!nativeEncryptFd(input.fd, output.fd)) {
+            throw IOException("Native encryption failed")
+        }
+    }
+
+    /**
+     * Decrypt a payload from [input] into [output].
+     * On failure [output] is truncated where the descriptor allows it.
+     * @throws AEADBadTagException if the payload was tampered with or truncated
+     */
+    fun decrypt(input: ParcelFileDescriptor, output: ParcelFileDescriptor) {
+        if (!nativeDecryptFd(input.fd, output.fd)) {
+            throw AEADBadTagException("Native decryption failed")
+        }
+    }
+
+    fun encryptFile(source: File, target: File) = transform(source, target, ::encrypt)
+
+    fun decryptFile(source: File, target: File) = transform(source, target, ::decrypt)
+
+    private inline fun transform(
+        source: File,
+        target: File,
+        block: (ParcelFileDescriptor, ParcelFileDescriptor) -> Unit
+    ) {
+        ParcelFileDescriptor.open(source, ParcelFileDescriptor.MODE_READ_ONLY).use { input ->
+            ParcelFileDescriptor.open(
+                target,
+                ParcelFileDescriptor.MODE_WRITE_ONLY or
+                    ParcelFileDescriptor.MODE_CREATE or
+                    ParcelFileDescriptor.MODE_TRUNCATE
+            ).use { output ->
+                block(input, output)
+            }
+        }
+    }
+
+    /**
+     * Start a chunked encryption. The payload header is written at
+     * [header]'s position, which advances by [HEADER_SIZE].
+     */
+    fun newEncryptor(header: ByteBuffer): Stream {
+        val handle = nativeBeginEncrypt(header.requireDirect(HEADER_SIZE), header.position())
+        if (handle == 0L) throw IOException("Native encryption unavailable")
+        header.position(header.position() + HEADER_SIZE)
+        return Stream(handle, encrypting = true)
+    }
+
+    /**
+     * Start a chunked decryption from the payload header at [header]'s
+     * position, which advances by [HEADER_SIZE].
+     */
+    fun newDecryptor(header: ByteBuffer): Stream {
+        val handle = nativeBeginDecrypt(header.requireDirect(HEADER_SIZE), header.position())
+        if (handle == 0L) throw IOException("Not a native-encrypted payload")
+        header.position(header.position() + HEADER_SIZE)
+        return Stream(handle, encrypting = false)
+    }
+
+    /**
+     * One encryption or decryption pass over a payload.
+     * Decrypted chunks are unauthenticated until [finish] returns.
+     */
+    class Stream internal constructor(
+        private var handle: Long,
+        private val encrypting: Boolean
+    ) : Closeable {
+
+        /**
+         * Process all remaining bytes of [input] into [output] (may be the
+         * same buffer). Both must be direct; both positions advance.
+         * @return Number of bytes written
+         */
+        fun update(input: ByteBuffer, output: ByteBuffer): Int {
+            check(handle != 0L) { "Stream already closed" }
+            val length = input.remaining()
+            input.requireDirect(length)
+            output.requireDirect(length)
+            val inPosition = input.position()
+            val outPosition = output.position()
+            val written = nativeUpdate(handle, input, inPosition, length, output, outPosition)
+            if (written < 0) throw IOException("Native crypto update failed")
+            // In place, the one position moves once
+            if (input !== output) input.position(inPosition + length)
+            output.position(outPosition + written)
+            return written
+        }
+
+        /**
+         * Encrypting: write the tag at [tag]'s position.
+         * Decrypting: verify the tag at [tag]'s position.
+         * Either way [tag] advances by [TAG_SIZE] and the stream is closed.
+         * @throws AEADBadTagException if decryption fails authentication
+         */
+        fun finish(tag: ByteBuffer) {
+            check(handle != 0L) { "Stream already closed" }
+            tag.requireDirect(TAG_SIZE)
+            try {
+                val ok = if (encrypting) {
+                    nativeFinishEncrypt(handle, tag, tag.position())
+                } else {
+                    nativeFinishDecrypt(handle, tag, tag.position())
+                }
+                if (!ok) {
+                    if (encrypting) throw IOException("Native crypto finish failed")
+                    throw AEADBadTagException("Native decryption failed")
+                }
+                tag.position(tag.position() + TAG_SIZE)
+            } finally {
+                close()
+            }
+        }
+
+        override fun close() {
+            if (handle != 0L) {
+                nativeRelease(handle)
+                handle = 0L
+            }
+        }
+    }
+
+    private fun ByteBuffer.requireDirect(length: Int): ByteBuffer {
+        require(isDirect) { "Native crypto needs a direct ByteBuffer" }
+        require(remaining() >= length) { "Buffer has ${remaining()} bytes, needs $length" }
+        return this
+    }
+
+    private external fun nativeBeginEncrypt(header: ByteBuffer, offset: Int): Long
+
+    private external fun nativeBeginDecrypt(header: ByteBuffer, offset: Int): Long
+
+    private external fun nativeUpdate(
+        handle: Long,
+        input: ByteBuffer,
+        inOffset: Int,
+        length: Int,
+        output: ByteBuffer,
+        outOffset: Int
+    ): Int
+
+    private external fun nativeFinishEncrypt(handle: Long, tag: ByteBuffer, offset: Int): Boolean
+
+    private external fun nativeFinishDecrypt(handle: Long, tag: ByteBuffer, offset: Int): Boolean
+
+    private external fun nativeRelease(handle: Long)
+
+    private external fun nativeEncryptFd(inFd: Int, outFd: Int): Boolean
+
+    private external fun nativeDecryptFd(inFd: Int, outFd: Int): Boolean
+}
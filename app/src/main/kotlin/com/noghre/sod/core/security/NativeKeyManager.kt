@@ -5,20 +5,11 @@ import javax.inject.Singleton
 
 @Singleton
 object NativeKeyManager {
-    private var isLibraryLoaded = false
+    private val isLibraryLoaded: Boolean
+        get() = NativeLibrary.isLoaded
     
     init {
-        try {
-            System.loadLibrary("noghresod_secure")
-            isLibraryLoaded = true
-            Timber.d("✅ Native key library loaded successfully")
-        } catch (e: UnsatisfiedLinkError) {
-            Timber.e(e, "❌ Failed to load native library - using fallback")
-            isLibraryLoaded = false
-        } catch (e: Exception) {
-            Timber.e(e, "❌ Unexpected error loading native library")
-            isLibraryLoaded = false
-        }
+        NativeLibrary.ensureLoaded()
     }
     
     /**
@@ -1,10 +1,14 @@
 package com.noghre.sod.core.security
 
+import com.noghre.sod.core.config.AppConfig
+import java.nio.ByteBuffer
+import java.nio.ByteOrder
+
 /**
  * Native keys loader for secure API key storage.
  * Loads sensitive keys from native C++ library to prevent reverse engineering.
  * 
- * Native library must be built from app/src/main/cpp/native_keys.cpp
+ * Served by libnoghresod_secure.so (app/src/main/cpp/jni/native_keys.cpp)
  * 
  * @author Yaser
  * @version 1.0.0
@@ -13,12 +17,8 @@ package com.noghre.sod.core.security
 object NativeKeys {
     
     init {
-        try {
-            System.loadLibrary("noghresod_keys")
-        } catch (e: UnsatisfiedLinkError) {
-            // Fallback: Use BuildConfig values if native library not available
-            System.err.println("Failed to load native library: ${e.message}")
-        }
+        // Falls back to BuildConfig values (see the *Safe methods) if unavailable
+        NativeLibrary.ensureLoaded()
     }
     
     /**
@@ -39,14 +39,59 @@ object NativeKeys {
     external fun getFirebaseKey(): String
     
     /**
-     * Get encryption key for local data storage.
+     * Validate certificate pinning hashes.
      */
-    external fun getEncryptionKey(): String
+    external fun getCertificatePins(): Array<String>
     
     /**
-     * Validate certificate pinning hashes.
+     * Get primary certificate pin (SHA256).
      */
-    external fun getCertificatePins(): Array<String>
+    external fun getCertificatePinSha(): String
+    
+    /**
+     * Get backup certificate pin (SHA256).
+     */
+    external fun getBackupCertificatePin(): String
+    
+    /**
+     * Get API timeout in seconds.
+     */
+    external fun getApiTimeout(): Int
+    
+    /**
+     * Get maximum retry attempts.
+     */
+    external fun getMaxRetries(): Int
+    
+    /**
+     * Get initial retry delay in milliseconds.
+     */
+    external fun getRetryDelay(): Int
+    
+    /**
+     * Every network setting from native code in a single JNI call, decoded
+     * once; later calls return the same instance.
+     */
+    fun getNetworkConfig(): NativeNetworkConfig = networkConfig
+    
+    private val networkConfig: NativeNetworkConfig by lazy {
+        NativeNetworkConfig.decode(getNetworkConfigBundle())
+    }
+    
+    /**
+     * Safe fallback for the network settings: [AppConfig.Api] values, with
+     * no pins or keys, if the native library is unavailable.
+     */
+    fun getNetworkConfigSafe(): NativeNetworkConfig {
+        if (!NativeLibrary.isLoaded) return NativeNetworkConfig.FALLBACK
+        return try {
+            getNetworkConfig()
+        } catch (e: LinkageError) {
+            NativeNetworkConfig.FALLBACK
+        } catch (e: Exception) {
+            NativeNetworkConfig.FALLBACK
+        }
+    }
     
     /**
      * Safe fallback method if native library fails.
@@ -69,4 +114,74 @@ object NativeKeys {
             "" // Return empty - payment should fail if key unavailable
         }
     }
+    
+    /**
+     * A writable direct buffer over the library's one packed bundle, so it
+     * never leaves this object; [getNetworkConfig] decodes it.
+     */
+    private external fun getNetworkConfigBundle(): ByteBuffer
+}
+
+/**
+ * Network settings held in native code.
+ * Mirrors the bundle layout produced by native_keys.cpp.
+ */
+data class NativeNetworkConfig(
+    val apiUrl: String,
+    val certificatePin: String,
+    val backupCertificatePin: String,
+    val paymentGatewayKey: String,
+    val firebaseKey: String,
+    val apiTimeoutSeconds: Int,
+    val maxRetries: Int,
+    val retryDelayMs: Int
+) {
+    companion object {
+        private const val BUNDLE_VERSION = 2
+        
+        /**
+         * Settings from [AppConfig.Api], used when the native bundle is unavailable.
+         */
+        val FALLBACK = NativeNetworkConfig(
+            apiUrl = AppConfig.Api.BASE_URL,
+            certificatePin = "",
+            backupCertificatePin = "",
+            paymentGatewayKey = "",
+            firebaseKey = "",
+            apiTimeoutSeconds = AppConfig.Api.READ_TIMEOUT.toInt(),
+            maxRetries = AppConfig.Api.MAX_RETRIES,
+            retryDelayMs = AppConfig.Api.INITIAL_RETRY_DELAY_MS.toInt()
+        )
+        
+        /**
+         * Decode the packed bundle (layout in network_config.h).
+         */
+        fun decode(bundle: ByteBuffer): NativeNetworkConfig {
+            val buffer = bundle.asReadOnlyBuffer().order(ByteOrder.nativeOrder())
+            val version = buffer.int
+            require(version == BUNDLE_VERSION) { "Unsupported network config bundle v$version" }
+            
+            val apiTimeoutSeconds = buffer.int
+            val maxRetries = buffer.int
+            val retryDelayMs = buffer.int
+            
+            return NativeNetworkConfig(
+                apiUrl = buffer.readString(),
+                certificatePin = buffer.readString(),
+                backupCertificatePin = buffer.readString(),
+                paymentGatewayKey = buffer.readString(),
+                firebaseKey = buffer.readString(),
+                apiTimeoutSeconds = apiTimeoutSeconds,
+                maxRetries = maxRetries,
+                retryDelayMs = retryDelayMs
+            )
+        }
+        
+        private fun ByteBuffer.readString(): String {
+            val length = int
+            val bytes = ByteArray(length)
+            get(bytes)
+            return String(bytes, Charsets.UTF_8)
+        }
+    }
 }
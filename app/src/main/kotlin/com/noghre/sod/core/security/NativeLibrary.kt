@@ -0,0 +1,46 @@
+package com.noghre.sod.core.security
+
+import timber.log.Timber
+
+/**
+ * Single entry point for loading libnoghresod_secure.so.
+ *
+ * Every native class (NativeKeyManager, NativeKeys, KeyProvider,
+ * NativeCrypto, NativeStats, NativeDigits, NativePriceFormatter,
+ * NativeJalali, NativeDateFormatter, NativeMoney) is served by this one
+ * library, whose JNI_OnLoad registers all of their methods at once.
+ * Loading goes through here so the library is opened once per process,
+ * however many of those classes initialize.
+ *
+ * [NativeWarmUp] normally loads it on a background thread during start-up;
+ * a class that initializes while that load is in flight waits for it here.
+ *
+ * The library is never loaded in JVM unit tests, so [isLoaded] is false
+ * there and the Native* tests exercise the Kotlin fallbacks; the host
+ * benches under app/src/main/cpp/bench check the native side against the
+ * same cases.
+ */
+internal object NativeLibrary {
+
+    const val NAME = "noghresod_secure"
+
+    /**
+     * Whether the library loaded. Evaluated on first access only.
+     */
+    val isLoaded: Boolean by lazy {
+        try {
+            System.loadLibrary(NAME)
+            Timber.d("Native library $NAME loaded")
+            true
+        } catch (e: UnsatisfiedLinkError) {
+            Timber.e(e, "Failed to load native library $NAME")
+            false
+        }
+    }
+
+    /**
+     * Load the library if it is not loaded yet.
+     * @return true if the native methods are available
+     */
+    fun ensureLoaded(): Boolean = isLoaded
+}
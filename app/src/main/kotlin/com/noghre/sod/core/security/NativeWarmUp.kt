@@ -0,0 +1,56 @@
+package com.noghre.sod.core.security
+
+import android.os.SystemClock
+import timber.log.Timber
+import java.util.concurrent.atomic.AtomicBoolean
+import kotlin.concurrent.thread
+
+/**
+ * Loads and warms up libnoghresod_secure.so off the main thread.
+ *
+ * Started from AppInitializer, before Hilt builds the graph. In order:
+ * - load the library; JNI_OnLoad probes the CPU and interns the native
+ *   string constants
+ * - decode the network config bundle
+ * - decrypt the secrets into the native cache, in the order the first
+ *   request needs them
+ *
+ * Nothing waits for the warm-up as a whole. A caller that arrives early
+ * waits for the library load if it is still in flight (see NativeLibrary),
+ * and then only for the secret it asked for: the native cache loads each
+ * secret under its own lock.
+ */
+object NativeWarmUp {
+
+    private val started = AtomicBoolean(false)
+
+    /**
+     * Start the warm-up; later calls do nothing.
+     */
+    fun start() {
+        if (!started.compareAndSet(false, true)) return
+        thread(name = "native-warm-up", isDaemon = true) {
+            warmUp()
+        }
+    }
+
+    private fun warmUp() {
+        val startMs = SystemClock.elapsedRealtime()
+        if (!NativeLibrary.ensureLoaded()) return
+        val loadedMs = SystemClock.elapsedRealtime()
+
+        try {
+            NativeKeys.getNetworkConfig()
+            KeyProvider.prefetch(KeyProvider.Secret.API_BASE_URL)
+            KeyProvider.prefetch(KeyProvider.Secret.API_KEY)
+        } catch (e: Exception) {
+            Timber.e(e, "Native warm-up failed")
+            return
+        }
+
+        Timber.d(
+            "Native warm-up done: load ${loadedMs - startMs}ms, " +
+                "total ${SystemClock.elapsedRealtime() - startMs}ms"
+        )
+    }
+}
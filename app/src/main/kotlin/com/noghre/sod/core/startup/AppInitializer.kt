@@ -7,6 +7,7 @@ import com.google.firebase.analytics.analytics
 import com.google.firebase.crashlytics.crashlytics
 import com.noghre.sod.BuildConfig
 import com.noghre.sod.core.logger.TimberInitializer
+import com.noghre.sod.core.security.NativeWarmUp
 import timber.log.Timber
 
 /**
@@ -16,6 +17,7 @@ import timber.log.Timber
  * - Timber logging
  * - Firebase configuration
  * - Analytics setup
+ * - Native library load and warm-up (background thread)
  * 
  * This initializer runs automatically before Application.onCreate().
  * 
@@ -34,6 +36,9 @@ class AppInitializer : Initializer<Unit> {
             Timber.d("Release logging initialized")
         }
 
+        // Load the native library and pre-decrypt secrets off the main thread
+        NativeWarmUp.start()
+
         // Initialize Firebase
         setupFirebase()
         
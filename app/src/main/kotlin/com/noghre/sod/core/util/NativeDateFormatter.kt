@@ -0,0 +1,399 @@
+package com.noghre.sod.core.util
+
+import com.noghre.sod.core.security.NativeLibrary
+import java.nio.ByteBuffer
+import java.util.TimeZone
+import java.util.concurrent.ConcurrentHashMap
+
+/**
+ * Jalali date and time formatting without per-item string assembly.
+ *
+ * A [Pattern] such as "EEEE d MMMM yyyy" or "yyyy/MM/dd HH:mm" is parsed
+ * once, when it is created. The native library (src/jalali_format.h) then writes dates
+ * straight into a UTF-16 buffer, copying month and weekday names from
+ * pre-encoded runs. [formatAllInto] renders a whole order timeline into
+ * one packed buffer in a single JNI call. When the library is unavailable,
+ * or a date falls outside the year table, the same output is produced in
+ * Kotlin.
+ */
+@Suppress("KotlinJniMissing")
+object NativeDateFormatter {
+
+    /**
+     * Longest pattern in chars; MAX_DATE_PATTERN in jalali_format.h.
+     */
+    const val MAX_PATTERN_LENGTH = 64
+
+    // Room for a native DatePattern; COMPILED_PATTERN_BYTES in native_date_formatter.cpp
+    private const val COMPILED_PATTERN_BYTES = 512
+
+    // DateFormatFlags in jalali_format.h
+    private const val FLAG_LATIN = 1
+
+    private const val MILLIS_PER_DAY = 86_400_000L
+    private const val MAX_NAME_LENGTH = 8
+
+    private val MONTH_NAMES = arrayOf(
+        "فروردین", "اردیبهشت", "خرداد", "تیر", "مرداد", "شهریور",
+        "مهر", "آبان", "آذر", "دی", "بهمن", "اسفند"
+    )
+
+    // From Saturday, as JalaliDate.weekday counts
+    private val WEEKDAY_NAMES = arrayOf(
+        "شنبه", "یکشنبه", "دوشنبه", "سه‌شنبه", "چهارشنبه", "پنج‌شنبه", "جمعه"
+    )
+
+    private val UTC: TimeZone = TimeZone.getTimeZone("UTC")
+
+    /**
+     * "شنبه ۸ دی ۱۴۰۳"
+     */
+    val LONG = Pattern("EEEE d MMMM yyyy")
+
+    /**
+     * "شنبه، ۸ دی ۱۴۰۳"
+     */
+    val TEXT = Pattern("EEEE، d MMMM yyyy")
+
+    /**
+     * "۱۴۰۳/۱۰/۰۸"
+     */
+    val NUMERIC = Pattern("yyyy/MM/dd")
+
+    /**
+     * "۱۴۰۳/۱۰/۰۸ ۱۳:۰۰"
+     */
+    val NUMERIC_TIME = Pattern("yyyy/MM/dd HH:mm")
+
+    // Patterns cached by patternOf(); bounded, since callers may build pattern text
+    private const val MAX_CACHED_PATTERNS = 32
+    private val patterns = ConcurrentHashMap<String, Pattern>().apply {
+        for (builtIn in arrayOf(LONG, TEXT, NUMERIC, NUMERIC_TIME)) put(builtIn.pattern, builtIn)
+    }
+
+    private val buffer = object : ThreadLocal<CharArray>() {
+        override fun initialValue() = CharArray(MAX_PATTERN_LENGTH * MAX_NAME_LENGTH)
+    }
+
+    init {
+        NativeLibrary.ensureLoaded()
+    }
+
+    /**
+     * A parsed date pattern. Parse once and keep it: formatting with it
+     * allocates nothing but the result. The native library compiles it
+     * into [compiled] here, so native calls never parse it again.
+     *
+     * - yyyy, y: year, four digits; yy: its last two digits
+     * - MMMM: month name; MM, M: month, padded / plain
+     * - EEEE: weekday name; dd, d: day, padded / plain
+     * - HH, H: hour (0-23); mm, m: minute; ss, s: second
+     *
+     * Text inside '...' is literal ('' is a quote). Other ASCII letters are
+     * reserved; everything else is literal.
+     *
+     * @throws IllegalArgumentException if [pattern] is longer than
+     *         [MAX_PATTERN_LENGTH] chars or invalid
+     */
+    class Pattern(val pattern: String) {
+
+        internal val fields: IntArray
+        internal val literals: Array<String?>
+
+        /**
+         * Longest output of one date, in chars.
+         */
+        val maxLength: Int
+
+        /**
+         * The native DatePattern, or null when formatting in Kotlin.
+         */
+        internal val compiled: ByteBuffer?
+
+        init {
+            require(pattern.length <= MAX_PATTERN_LENGTH) { "Pattern longer than $MAX_PATTERN_LENGTH chars: $pattern" }
+            val fieldList = ArrayList<Int>()
+            val literalList = ArrayList<String?>()
+            val literal = StringBuilder()
+            var length = 0
+            var quoted = false
+
+            fun flushLiteral() {
+                if (literal.isEmpty()) return
+                fieldList.add(LITERAL)
+                literalList.add(literal.toString())
+                length += literal.length
+                literal.setLength(0)
+            }
+
+            var i = 0
+            while (i < pattern.length) {
+                val c = pattern[i]
+                if (c == '\'') {
+                    // '' is a quote, inside or outside quoted text
+                    if (i + 1 < pattern.length && pattern[i + 1] == '\'') {
+                        literal.append(c)
+                        i += 2
+                    } else {
+                        quoted = !quoted
+                        i++
+                    }
+                    continue
+                }
+                if (quoted || !(c in 'a'..'z' || c in 'A'..'Z')) {
+                    literal.append(c)
+                    i++
+                    continue
+                }
+
+                var count = 1
+                while (i + count < pattern.length && pattern[i + count] == c) count++
+                val field = fieldOf(c, count)
+                require(field != LITERAL) { "Reserved letter '$c' in pattern: $pattern" }
+                flushLiteral()
+                fieldList.add(field)
+                literalList.add(null)
+                length += maxLengthOf(field)
+                i += count
+            }
+            require(!quoted) { "Unterminated quote in pattern: $pattern" }
+            flushLiteral()
+
+            fields = fieldList.toIntArray()
+            literals = literalList.toTypedArray()
+            maxLength = length
+
+            // Garbage collected with the Pattern; false only for an unaligned buffer
+            compiled = if (NativeLibrary.isLoaded) {
+                ByteBuffer.allocateDirect(COMPILED_PATTERN_BYTES)
+                    .takeIf { nativeCompile(pattern.toCharArray(), it) }
+            } else {
+                null
+            }
+        }
+
+        override fun toString() = pattern
+    }
+
+    /**
+     * The parsed [Pattern] for [pattern], shared between callers: the
+     * built-in patterns, or one parsed on first use and cached.
+     *
+     * @throws IllegalArgumentException if [pattern] is invalid
+     */
+    fun patternOf(pattern: String): Pattern {
+        patterns[pattern]?.let { return it }
+        val parsed = Pattern(pattern)
+        if (patterns.size >= MAX_CACHED_PATTERNS) return parsed
+        return patterns.putIfAbsent(pattern, parsed) ?: parsed
+    }
+
+    /**
+     * [millis] formatted with [pattern] in [zone].
+     *
+     * @param persianDigits Persian digits; otherwise ASCII ones
+     */
+    fun format(
+        millis: Long,
+        pattern: Pattern,
+        zone: TimeZone = TimeZone.getDefault(),
+        persianDigits: Boolean = true
+    ): String {
+        val chars = buffer.get()!!
+        val length = formatInto(millis, pattern, chars, 0, zone, persianDigits)
+        return String(chars, 0, length)
+    }
+
+    /**
+     * A calendar day formatted with [pattern]; time fields read 00:00:00.
+     */
+    fun formatDay(epochDay: Long, pattern: Pattern, persianDigits: Boolean = true): String =
+        format(epochDay * MILLIS_PER_DAY, pattern, UTC, persianDigits)
+
+    /**
+     * Write [millis] into out[offset...], which needs room for pattern.maxLength chars.
+     * @return Chars written
+     */
+    fun formatInto(
+        millis: Long,
+        pattern: Pattern,
+        out: CharArray,
+        offset: Int,
+        zone: TimeZone = TimeZone.getDefault(),
+        persianDigits: Boolean = true
+    ): Int {
+        require(offset >= 0 && out.size - offset >= pattern.maxLength) {
+            "No room for ${pattern.maxLength} chars at $offset"
+        }
+        val offsetMillis = zone.getOffset(millis).toLong()
+        val compiled = pattern.compiled
+        if (compiled != null) {
+            val length = nativeFormat(millis, offsetMillis, compiled, flags(persianDigits), out, offset)
+            if (length >= 0) return length
+        }
+        return formatKotlin(millis + offsetMillis, pattern, !persianDigits, out, offset)
+    }
+
+    /**
+     * [millis] formatted as by [format], in one native call.
+     */
+    fun formatAll(
+        millis: LongArray,
+        pattern: Pattern,
+        zone: TimeZone = TimeZone.getDefault(),
+        persianDigits: Boolean = true
+    ): List<String> {
+        if (millis.isEmpty()) return emptyList()
+        val chars = CharArray(millis.size * pattern.maxLength)
+        val ends = IntArray(millis.size)
+        formatAllInto(millis, pattern, chars, ends, zone, persianDigits)
+
+        var start = 0
+        return ends.map { end ->
+            val formatted = String(chars, start, end - start)
+            start = end
+            formatted
+        }
+    }
+
+    /**
+     * Format [millis] back to back into [out]; instant i ends at ends[i].
+     * Reusing [out] and [ends] across screens makes a batch allocation-free.
+     *
+     * @param out Room for millis.size * pattern.maxLength chars
+     * @return Number of chars written
+     */
+    fun formatAllInto(
+        millis: LongArray,
+        pattern: Pattern,
+        out: CharArray,
+        ends: IntArray,
+        zone: TimeZone = TimeZone.getDefault(),
+        persianDigits: Boolean = true
+    ): Int {
+        require(out.size >= millis.size * pattern.maxLength) { "out needs ${millis.size * pattern.maxLength} chars" }
+        require(ends.size >= millis.size) { "ends needs ${millis.size} entries" }
+        if (millis.isEmpty()) return 0
+
+        NativeJalali.withSharedOffset(millis, zone) { input, offsetMillis ->
+            // Fewer than all formatted: an instant outside the year table
+            val compiled = pattern.compiled
+            val native = compiled != null &&
+                nativeFormatAll(input, offsetMillis, compiled, flags(persianDigits), out, ends) == millis.size
+            if (!native) {
+                var position = 0
+                for (i in millis.indices) {
+                    position += formatKotlin(input[i] + offsetMillis, pattern, !persianDigits, out, position)
+                    ends[i] = position
+                }
+            }
+        }
+        return ends[millis.size - 1]
+    }
+
+    private fun flags(persianDigits: Boolean): Int = if (persianDigits) 0 else FLAG_LATIN
+
+    /**
+     * Kotlin twin of formatDate() in jalali_format.cpp.
+     *
+     * @param localMillis The instant with its zone offset already added
+     */
+    internal fun formatKotlin(localMillis: Long, pattern: Pattern, latin: Boolean, out: CharArray, offset: Int): Int {
+        val epochDay = Math.floorDiv(localMillis, MILLIS_PER_DAY)
+        val date = NativeJalali.fromEpochDay(epochDay)
+        val seconds = ((localMillis - epochDay * MILLIS_PER_DAY) / 1000).toInt()
+        val zero = if (latin) '0' else '۰'
+
+        var p = offset
+        for (i in pattern.fields.indices) {
+            p = when (pattern.fields[i]) {
+                LITERAL -> writeText(out, p, pattern.literals[i]!!)
+                YEAR -> writeNumber(out, writeNumber(out, p, date.year / 100 % 100, true, zero), date.year % 100, true, zero)
+                YEAR_SHORT -> writeNumber(out, p, date.year % 100, true, zero)
+                MONTH -> writeNumber(out, p, date.month, false, zero)
+                MONTH_PADDED -> writeNumber(out, p, date.month, true, zero)
+                MONTH_NAME -> writeText(out, p, MONTH_NAMES[date.month - 1])
+                DAY -> writeNumber(out, p, date.day, false, zero)
+                DAY_PADDED -> writeNumber(out, p, date.day, true, zero)
+                WEEKDAY_NAME -> writeText(out, p, WEEKDAY_NAMES[date.weekday])
+                HOUR -> writeNumber(out, p, seconds / 3600, false, zero)
+                HOUR_PADDED -> writeNumber(out, p, seconds / 3600, true, zero)
+                MINUTE -> writeNumber(out, p, seconds / 60 % 60, false, zero)
+                MINUTE_PADDED -> writeNumber(out, p, seconds / 60 % 60, true, zero)
+                SECOND -> writeNumber(out, p, seconds % 60, false, zero)
+                else -> writeNumber(out, p, seconds % 60, true, zero)
+            }
+        }
+        return p - offset
+    }
+
+    /**
+     * Write [value] (0-99) at out[position]; a single digit unless [padded].
+     * @return Position after it
+     */
+    private fun writeNumber(out: CharArray, position: Int, value: Int, padded: Boolean, zero: Char): Int {
+        var p = position
+        if (padded || value >= 10) out[p++] = zero + value / 10 % 10
+        out[p++] = zero + value % 10
+        return p
+    }
+
+    private fun writeText(out: CharArray, position: Int, text: String): Int {
+        text.toCharArray(out, position)
+        return position + text.length
+    }
+
+    // DateField in jalali_format.cpp
+    private const val LITERAL = 0
+    private const val YEAR = 1
+    private const val YEAR_SHORT = 2
+    private const val MONTH = 3
+    private const val MONTH_PADDED = 4
+    private const val MONTH_NAME = 5
+    private const val DAY = 6
+    private const val DAY_PADDED = 7
+    private const val WEEKDAY_NAME = 8
+    private const val HOUR = 9
+    private const val HOUR_PADDED = 10
+    private const val MINUTE = 11
+    private const val MINUTE_PADDED = 12
+    private const val SECOND = 13
+    private const val SECOND_PADDED = 14
+
+    private fun fieldOf(letter: Char, count: Int): Int = when (letter) {
+        'y' -> if (count == 2) YEAR_SHORT else YEAR
+        'M' -> if (count == 1) MONTH else if (count == 2) MONTH_PADDED else MONTH_NAME
+        'd' -> if (count == 1) DAY else DAY_PADDED
+        'E' -> WEEKDAY_NAME
+        'H' -> if (count == 1) HOUR else HOUR_PADDED
+        'm' -> if (count == 1) MINUTE else MINUTE_PADDED
+        's' -> if (count == 1) SECOND else SECOND_PADDED
+        else -> LITERAL
+    }
+
+    private fun maxLengthOf(field: Int): Int = when (field) {
+        YEAR -> 4
+        MONTH_NAME, WEEKDAY_NAME -> MAX_NAME_LENGTH
+        else -> 2
+    }
+
+    private external fun nativeCompile(pattern: CharArray, compiled: ByteBuffer): Boolean
+
+    private external fun nativeFormat(
+        millis: Long,
+        offsetMillis: Long,
+        compiled: ByteBuffer,
+        flags: Int,
+        out: CharArray,
+        offset: Int
+    ): Int
+
+    private external fun nativeFormatAll(
+        millis: LongArray,
+        offsetMillis: Long,
+        compiled: ByteBuffer,
+        flags: Int,
+        out: CharArray,
+        ends: IntArray
+    ): Int
+}
@@ -0,0 +1,101 @@
+package com.noghre.sod.core.util
+
+import com.noghre.sod.core.security.NativeLibrary
+
+/**
+ * Digit transcoding between Latin, Persian and Arabic-Indic digits.
+ *
+ * Every digit of the three scripts is rewritten into the target script in
+ * one pass; all other characters are kept. Large inputs and batches go
+ * through the vectorized kernel of the native library
+ * (src/digit_transcoder.h): a whole batch is concatenated into one
+ * CharArray and converted in a single JNI call. Short strings, and every
+ * string when the library is unavailable, use the same mapping in Kotlin.
+ */
+@Suppress("KotlinJniMissing")
+object NativeDigits {
+
+    /**
+     * Digit scripts; ordinals match DigitScript in digit_transcoder.h.
+     */
+    enum class Script(internal val zero: Char) {
+        LATIN('0'),
+        PERSIAN('۰'),
+        ARABIC_INDIC('٠')
+    }
+
+    // Below this a JNI call costs more than the Kotlin loop it replaces
+    private const val NATIVE_MIN_LENGTH = 64
+
+    init {
+        NativeLibrary.ensureLoaded()
+    }
+
+    /**
+     * [input] with every digit in [target]; [input] itself when nothing changes.
+     */
+    fun convert(input: String, target: Script): String {
+        val chars = input.toCharArray()
+        val changed = if (input.length >= NATIVE_MIN_LENGTH && NativeLibrary.isLoaded) {
+            nativeTranscode(chars, 0, chars.size, target.ordinal)
+        } else {
+            transcode(chars, 0, chars.size, target)
+        }
+        return if (changed) String(chars) else input
+    }
+
+    /**
+     * [inputs] converted as by [convert], in one native call.
+     */
+    fun convertAll(inputs: List<String>, target: Script): List<String> {
+        if (inputs.isEmpty()) return emptyList()
+
+        var total = 0
+        for (input in inputs) total += input.length
+        val chars = CharArray(total)
+        var offset = 0
+        for (input in inputs) {
+            input.toCharArray(chars, offset)
+            offset += input.length
+        }
+
+        val changed = if (NativeLibrary.isLoaded) {
+            nativeTranscode(chars, 0, total, target.ordinal)
+        } else {
+            transcode(chars, 0, total, target)
+        }
+        if (!changed) return inputs
+
+        offset = 0
+        return inputs.map { input ->
+            val converted = String(chars, offset, input.length)
+            offset += input.length
+            converted
+        }
+    }
+
+    /**
+     * Kotlin twin of the native kernel.
+     * @return Whether any character changed
+     */
+    internal fun transcode(chars: CharArray, offset: Int, length: Int, target: Script): Boolean {
+        var changed = false
+        for (i in offset until offset + length) {
+            val c = chars[i]
+            val digit = when (c) {
+                in '0'..'9' -> c - '0'
+                in '۰'..'۹' -> c - '۰'
+                in '٠'..'٩' -> c - '٠'
+                else -> continue
+            }
+            val mapped = target.zero + digit
+            if (mapped != c) {
+                chars[i] = mapped
+                changed = true
+            }
+        }
+        return changed
+    }
+
+    private external fun nativeTranscode(chars: CharArray, offset: Int, length: Int, target: Int): Boolean
+}
@@ -0,0 +1,118 @@
+package com.noghre.sod.core.util
+
+import com.noghre.sod.core.security.NativeLibrary
+import java.util.TimeZone
+
+/**
+ * A Jalali date packed into one Int, as produced by the native engine:
+ * year << 12 | month << 8 | day << 3 | weekday. No object is allocated
+ * per date.
+ */
+@JvmInline
+value class JalaliDate(val packed: Int) {
+    val year: Int get() = packed ushr 12
+    val month: Int get() = (packed ushr 8) and 0xF
+    val day: Int get() = (packed ushr 3) and 0x1F
+
+    /**
+     * 0 = شنبه (Saturday) ... 6 = جمعه (Friday)
+     */
+    val weekday: Int get() = packed and 0x7
+
+    companion object {
+        fun of(year: Int, month: Int, day: Int, weekday: Int) =
+            JalaliDate((year shl 12) or (month shl 8) or (day shl 3) or weekday)
+    }
+}
+
+/**
+ * Jalali calendar conversions backed by the native year table
+ * (src/jalali.h): 1 Farvardin of every year from [FIRST_YEAR] to
+ * [LAST_YEAR], so a conversion is a table lookup and a few multiplies.
+ *
+ * [fromEpochMillisAll] converts a whole order list in one JNI call. Dates
+ * outside the table, and every date when the library is unavailable, go
+ * through the reference algorithm in [PersianDateConverter], which the
+ * table is built from and checked against (bench/jalali_bench.cpp).
+ */
+@Suppress("KotlinJniMissing")
+object NativeJalali {
+
+    const val FIRST_YEAR = 1300
+    const val LAST_YEAR = 1500
+
+    private const val MILLIS_PER_DAY = 86_400_000L
+
+    init {
+        NativeLibrary.ensureLoaded()
+    }
+
+    fun fromEpochDay(epochDay: Long): JalaliDate {
+        if (NativeLibrary.isLoaded) {
+            val packed = nativeFromEpochDay(epochDay)
+            if (packed != 0) return JalaliDate(packed)
+        }
+        return PersianDateConverter.epochDayToJalali(epochDay)
+    }
+
+    /**
+     * Jalali date of [millis] in [zone].
+     */
+    fun fromEpochMillis(millis: Long, zone: TimeZone = TimeZone.getDefault()): JalaliDate =
+        fromEpochDay(Math.floorDiv(millis + zone.getOffset(millis), MILLIS_PER_DAY))
+
+    /**
+     * Convert every instant of [millis] into [out], as packed [JalaliDate] values.
+     *
+     * One native call; see [withSharedOffset] for how [zone] is applied.
+     */
+    fun fromEpochMillisAll(millis: LongArray, out: IntArray, zone: TimeZone = TimeZone.getDefault()) {
+        require(out.size >= millis.size) { "out needs ${millis.size} entries" }
+        if (millis.isEmpty()) return
+
+        withSharedOffset(millis, zone) { input, offset ->
+            val native = NativeLibrary.isLoaded &&
+                nativeFromEpochMillisAll(input, offset, out) == millis.size
+            for (i in millis.indices) {
+                // Outside the table the native side writes 0
+                if (!native || out[i] == 0) {
+                    out[i] = PersianDateConverter.epochDayToJalali(
+                        Math.floorDiv(input[i] + offset, MILLIS_PER_DAY)
+                    ).packed
+                }
+            }
+        }
+    }
+
+    /**
+     * Run [block] with instants that share one offset in [zone]: [millis]
+     * and that offset when every instant has it (always, for zones without
+     * daylight saving), otherwise a copy shifted instant by instant and 0.
+     */
+    internal inline fun <R> withSharedOffset(
+        millis: LongArray,
+        zone: TimeZone,
+        block: (input: LongArray, offsetMillis: Long) -> R
+    ): R {
+        val offset = if (millis.isEmpty()) 0 else zone.getOffset(millis[0])
+        if (millis.all { zone.getOffset(it) == offset }) {
+            return block(millis, offset.toLong())
+        }
+        return block(LongArray(millis.size) { millis[it] + zone.getOffset(millis[it]) }, 0L)
+    }
+
+    /**
+     * Epoch day of a Jalali date.
+     */
+    fun toEpochDay(year: Int, month: Int, day: Int): Long {
+        if (NativeLibrary.isLoaded) {
+            val epochDay = nativeToEpochDay(year, month, day)
+            if (epochDay != Long.MIN_VALUE) return epochDay
+        }
+        return PersianDateConverter.jalaliToEpochDay(year, month, day)
+    }
+
+    private external fun nativeFromEpochDay(epochDay: Long): Int
+    private external fun nativeToEpochDay(year: Int, month: Int, day: Int): Long
+    private external fun nativeFromEpochMillisAll(millis: LongArray, offsetMillis: Long, out: IntArray): Int
+}
@@ -0,0 +1,184 @@
+package com.noghre.sod.core.util
+
+import com.noghre.sod.core.security.NativeLibrary
+
+/**
+ * Fixed-point money arithmetic for jewelry pricing (src/money.h).
+ *
+ * Amounts are Long Rial, rates are basis points (1/100 of a percent, so
+ * 9% VAT is [VAT_BPS]) and weights are milligrams; every division rounds
+ * with an explicit [Rounding]. Inputs are bounded by the MAX_* constants so
+ * no intermediate product overflows a Long, which keeps every result
+ * identical on all ABIs and in the Kotlin twin here.
+ *
+ * [priceAll] reprices a whole catalog at a new silver price in one JNI
+ * call. Single products are priced in Kotlin, which gives the same Rial
+ * without the call overhead; bench/money_bench.cpp and NativeMoneyTest pin
+ * both to the same catalog checksum.
+ */
+@Suppress("KotlinJniMissing")
+object NativeMoney {
+
+    /**
+     * Rounding of a quotient. Ordinals match RoundingMode in money.h.
+     */
+    enum class Rounding {
+        /** Ties away from zero */
+        HALF_UP,
+        /** Ties to the even neighbour (banker's rounding) */
+        HALF_EVEN,
+        /** Toward zero */
+        DOWN,
+        /** Away from zero */
+        UP
+    }
+
+    const val BASIS_POINTS = 10_000
+    const val VAT_BPS = 900
+    const val MILLIGRAMS_PER_GRAM = 1000L
+
+    const val MAX_WEIGHT_MG = 10_000_000L                  // 10 kg
+    const val MAX_PRICE_PER_GRAM = 10_000_000_000L         // 10^10 Rial
+    const val MAX_WAGE = 100_000_000_000_000L              // 10^14 Rial
+
+    /**
+     * One product's price, every step rounded with the same [Rounding].
+     */
+    data class PriceBreakdown(
+        val metal: Long,        // weight x price per gram
+        val wage: Long,         // making charge (اجرت)
+        val discount: Long,     // off metal + wage
+        val tax: Long,          // on the discounted subtotal
+        val total: Long         // metal + wage - discount + tax
+    )
+
+    init {
+        NativeLibrary.ensureLoaded()
+    }
+
+    /**
+     * value * numerator / denominator, rounded with [rounding].
+     * @throws ArithmeticException if |value * numerator| + denominator overflows a Long
+     */
+    fun mulDiv(value: Long, numerator: Long, denominator: Long, rounding: Rounding = Rounding.HALF_UP): Long =
+        mulDivOrNull(value, numerator, denominator, rounding) ?: throw ArithmeticException("long overflow")
+
+    /**
+     * [mulDiv], or null where it would throw an ArithmeticException; for
+     * display paths that must not fail on out-of-range amounts.
+     */
+    fun mulDivOrNull(value: Long, numerator: Long, denominator: Long, rounding: Rounding = Rounding.HALF_UP): Long? {
+        require(denominator > 0) { "denominator must be positive: $denominator" }
+        val product = value * numerator
+        if (value != 0L && (product / value != numerator || (value == -1L && numerator == Long.MIN_VALUE))) return null
+        // Long.MIN_VALUE has no positive magnitude
+        val magnitude = if (product < 0) -product else product
+        if (magnitude < 0 || magnitude > Long.MAX_VALUE - denominator) return null
+        val rounded = divide(magnitude, denominator, rounding)
+        return if (product < 0) -rounded else rounded
+    }
+
+    /**
+     * [bps] basis points of [amount], e.g. percentOf(price, VAT_BPS).
+     */
+    fun percentOf(amount: Long, bps: Int, rounding: Rounding = Rounding.HALF_UP): Long =
+        mulDiv(amount, bps.toLong(), BASIS_POINTS.toLong(), rounding)
+
+    /**
+     * Price one product: metal = weight x price per gram, [discountBps] off
+     * metal + wage, then [taxBps] on what is left.
+     */
+    fun price(
+        weightMg: Long,
+        pricePerGram: Long,
+        wage: Long = 0,
+        discountBps: Int = 0,
+        taxBps: Int = VAT_BPS,
+        rounding: Rounding = Rounding.HALF_UP
+    ): PriceBreakdown {
+        requireValid(weightMg, pricePerGram, wage, discountBps, taxBps)
+        val metal = divide(weightMg * pricePerGram, MILLIGRAMS_PER_GRAM, rounding)
+        val subtotal = metal + wage
+        val discount = divide(subtotal * discountBps, BASIS_POINTS.toLong(), rounding)
+        val discounted = subtotal - discount
+        val tax = divide(discounted * taxBps, BASIS_POINTS.toLong(), rounding)
+        return PriceBreakdown(metal, wage, discount, tax, discounted + tax)
+    }
+
+    /**
+     * Reprice every product at [pricePerGram] in one native call:
+     * totals[i] = price(weightMg[i], pricePerGram, wage[i], discountBps[i], taxBps).total.
+     * Reusing [totals] across price updates makes a repricing allocation-free.
+     *
+     * @param discountBps Per product, or null for no discounts
+     * @return [totals]
+     * @throws IllegalArgumentException if an input is outside its bound
+     */
+    fun priceAll(
+        weightMg: LongArray,
+        wage: LongArray,
+        discountBps: IntArray?,
+        pricePerGram: Long,
+        taxBps: Int = VAT_BPS,
+        rounding: Rounding = Rounding.HALF_UP,
+        totals: LongArray = LongArray(weightMg.size)
+    ): LongArray {
+        val count = weightMg.size
+        require(wage.size >= count) { "wage needs $count entries" }
+        require(discountBps == null || discountBps.size >= count) { "discountBps needs $count entries" }
+        require(totals.size >= count) { "totals needs $count entries" }
+        if (count == 0) return totals
+
+        if (NativeLibrary.isLoaded) {
+            val priced = nativePriceAll(weightMg, wage, discountBps, pricePerGram, taxBps, rounding.ordinal, totals)
+            require(priced == count) { "Product $priced is out of range" }
+        } else {
+            for (i in 0 until count) {
+                totals[i] = price(weightMg[i], pricePerGram, wage[i], discountBps?.get(i) ?: 0, taxBps, rounding).total
+            }
+        }
+        return totals
+    }
+
+    /**
+     * Grams to milligrams, rounded half up.
+     */
+    fun gramsToMg(grams: Double): Long = Math.round(grams * MILLIGRAMS_PER_GRAM)
+
+    /**
+     * A percentage to basis points, rounded half up: 9.0 -> 900.
+     */
+    fun percentToBps(percent: Double): Int = Math.round(percent * 100).toInt()
+
+    private fun requireValid(weightMg: Long, pricePerGram: Long, wage: Long, discountBps: Int, taxBps: Int) {
+        require(weightMg in 0..MAX_WEIGHT_MG) { "weightMg out of range: $weightMg" }
+        require(pricePerGram in 0..MAX_PRICE_PER_GRAM) { "pricePerGram out of range: $pricePerGram" }
+        require(wage in 0..MAX_WAGE) { "wage out of range: $wage" }
+        require(discountBps in 0..BASIS_POINTS) { "discountBps out of range: $discountBps" }
+        require(taxBps in 0..BASIS_POINTS) { "taxBps out of range: $taxBps" }
+    }
+
+    /**
+     * Kotlin twin of divideRounded() in money.cpp: n / d for n >= 0, d > 0.
+     */
+    private fun divide(n: Long, d: Long, rounding: Rounding): Long = when (rounding) {
+        Rounding.HALF_UP -> (n + d / 2) / d
+        Rounding.HALF_EVEN -> {
+            val q = n / d
+            val r = n - q * d
+            if (2 * r > d || (2 * r == d && q and 1L != 0L)) q + 1 else q
+        }
+        Rounding.DOWN -> n / d
+        Rounding.UP -> (n + d - 1) / d
+    }
+
+    private external fun nativePriceAll(
+        weightMg: LongArray,
+        wage: LongArray,
+        discountBps: IntArray?,
+        pricePerGram: Long,
+        taxBps: Int,
+        rounding: Int,
+        totals: LongArray
+    ): Int
+}
@@ -0,0 +1,157 @@
+package com.noghre.sod.core.util
+
+import com.noghre.sod.core.security.NativeLibrary
+
+/**
+ * Grouped number and price formatting without temporary objects.
+ *
+ * Digits are written in groups of three, separated by '٬' (U+066C), with
+ * '−' (U+2212) for negatives and an optional " تومان" suffix, straight into
+ * a UTF-16 buffer by the native library (src/number_format.h). The only
+ * allocation per value is the returned String; [formatInto] and
+ * [formatAllInto] avoid even that. A whole page of prices is formatted by
+ * [formatAll] in one JNI call. When the library is unavailable the same
+ * output is produced in Kotlin.
+ */
+@Suppress("KotlinJniMissing")
+object NativePriceFormatter {
+
+    /**
+     * Longest formatted value in chars: "−۹٬۲۲۳٬۳۷۲٬۰۳۶٬۸۵۴٬۷۷۵٬۸۰۸ تومان".
+     */
+    const val MAX_LENGTH = 32
+
+    // NumberFormatFlags in number_format.h
+    private const val FLAG_LATIN = 1
+    private const val FLAG_TOMAN = 2
+
+    private const val TOMAN_SUFFIX = " تومان"
+
+    private val buffer = object : ThreadLocal<CharArray>() {
+        override fun initialValue() = CharArray(MAX_LENGTH)
+    }
+
+    init {
+        NativeLibrary.ensureLoaded()
+    }
+
+    /**
+     * @param toman Append " تومان"
+     * @param persianDigits Persian digits, '٬' and '−'; otherwise ASCII digits, ',' and '-'
+     */
+    fun format(value: Long, toman: Boolean = false, persianDigits: Boolean = true): String {
+        val chars = buffer.get()!!
+        val length = formatInto(value, chars, 0, toman, persianDigits)
+        return String(chars, 0, length)
+    }
+
+    /**
+     * Write [value] into out[offset...], which needs room for [MAX_LENGTH] chars.
+     * @return Chars written
+     */
+    fun formatInto(
+        value: Long,
+        out: CharArray,
+        offset: Int,
+        toman: Boolean = false,
+        persianDigits: Boolean = true
+    ): Int {
+        require(offset >= 0 && out.size - offset >= MAX_LENGTH) { "No room for $MAX_LENGTH chars at $offset" }
+        val flags = flags(toman, persianDigits)
+        if (NativeLibrary.isLoaded) {
+            return nativeFormat(value, flags, out, offset)
+        }
+        return formatKotlin(value, flags, out, offset)
+    }
+
+    /**
+     * [values] formatted as by [format], in one native call.
+     */
+    fun formatAll(values: LongArray, toman: Boolean = false, persianDigits: Boolean = true): List<String> {
+        if (values.isEmpty()) return emptyList()
+        val chars = CharArray(values.size * MAX_LENGTH)
+        val ends = IntArray(values.size)
+        formatAllInto(values, chars, ends, toman, persianDigits)
+
+        var start = 0
+        return ends.map { end ->
+            val formatted = String(chars, start, end - start)
+            start = end
+            formatted
+        }
+    }
+
+    /**
+     * Format [values] back to back into [out]; value i ends at ends[i].
+     * Reusing [out] and [ends] across pages makes a batch allocation-free.
+     *
+     * @param out Room for values.size * [MAX_LENGTH] chars
+     * @return Number of chars written
+     */
+    fun formatAllInto(
+        values: LongArray,
+        out: CharArray,
+        ends: IntArray,
+        toman: Boolean = false,
+        persianDigits: Boolean = true
+    ): Int {
+        require(out.size >= values.size * MAX_LENGTH) { "out needs ${values.size * MAX_LENGTH} chars" }
+        require(ends.size >= values.size) { "ends needs ${values.size} entries" }
+        if (values.isEmpty()) return 0
+
+        val flags = flags(toman, persianDigits)
+        if (NativeLibrary.isLoaded) {
+            check(nativeFormatAll(values, flags, out, ends) == values.size) { "Native batch format failed" }
+        } else {
+            var position = 0
+            for (i in values.indices) {
+                position += formatKotlin(values[i], flags, out, position)
+                ends[i] = position
+            }
+        }
+        return ends[values.size - 1]
+    }
+
+    private fun flags(toman: Boolean, persianDigits: Boolean): Int =
+        (if (toman) FLAG_TOMAN else 0) or (if (persianDigits) 0 else FLAG_LATIN)
+
+    /**
+     * Kotlin twin of formatNumber() in number_format.cpp.
+     */
+    internal fun formatKotlin(value: Long, flags: Int, out: CharArray, offset: Int): Int {
+        val latin = flags and FLAG_LATIN != 0
+        val zero = if (latin) '0' else '۰'
+        val separator = if (latin) ',' else '٬'
+
+        // Digits counted first so they can be written left to right
+        var digits = 1
+        var probe = value / 10
+        while (probe != 0L) {
+            digits++
+            probe /= 10
+        }
+        var position = offset
+        if (value < 0) out[position++] = if (latin) '-' else '−'
+        val separators = (digits - 1) / 3
+        var index = position + digits + separators
+        position = index
+
+        // Negated digit by digit, so Long.MIN_VALUE needs no special case
+        var rest = value
+        for (written in 0 until digits) {
+            if (written > 0 && written % 3 == 0) out[--index] = separator
+            val digit = rest % 10
+            out[--index] = zero + (if (digit < 0) -digit else digit).toInt()
+            rest /= 10
+        }
+
+        if (flags and FLAG_TOMAN != 0) {
+            TOMAN_SUFFIX.toCharArray(out, position)
+            position += TOMAN_SUFFIX.length
+        }
+        return position - offset
+    }
+
+    private external fun nativeFormat(value: Long, flags: Int, out: CharArray, offset: Int): Int
+    private external fun nativeFormatAll(values: LongArray, flags: Int, out: CharArray, ends: IntArray): Int
+}
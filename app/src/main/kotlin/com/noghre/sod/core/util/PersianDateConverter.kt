@@ -24,120 +24,127 @@ object PersianDateConverter {
         val gm = gregorian.get(Calendar.MONTH) + 1
         val gd = gregorian.get(Calendar.DAY_OF_MONTH)
         
-        return gregorianToJalali(gy, gm, gd)
+        val date = NativeJalali.fromEpochDay((gregorianToJdn(gy, gm, gd) - UNIX_EPOCH_JDN).toLong())
+        return Triple(date.year, date.month, date.day)
     }
     
     /**
      * تبدیل اعداد انگلیسی به فارسی
      * 2024 → ۲۰۲۴
      */
-    fun toFarsiNumbers(input: String): String {
-        val farsiDigits = arrayOf("۰", "۱", "۲", "۳", "۴", "۵", "۶", "۷", "۸", "۹")
-        var output = input
-        
-        for (i in 0..9) {
-            output = output.replace(i.toString(), farsiDigits[i])
-        }
-        return output
-    }
+    fun toFarsiNumbers(input: String): String =
+        NativeDigits.convert(input, NativeDigits.Script.PERSIAN)
     
     /**
      * تبدیل تاریخ به فرمت "۱۴۰۳/۱۰/۰۶"
      */
-    fun toPersianDateString(jy: Int, jm: Int, jd: Int): String {
-        val formattedMonth = if (jm < 10) "0$jm" else "$jm"
-        val formattedDay = if (jd < 10) "0$jd" else "$jd"
-        val dateString = "$jy/$formattedMonth/$formattedDay"
-        return toFarsiNumbers(dateString)
-    }
+    fun toPersianDateString(jy: Int, jm: Int, jd: Int): String =
+        NativeDateFormatter.formatDay(NativeJalali.toEpochDay(jy, jm, jd), NativeDateFormatter.NUMERIC)
     
     /**
      * تبدیل تاریخ به متن فارسی
-     * مثال: "دوشنبه، ۶ دی ۱۴۰۳"
+     * مثال: "پنج‌شنبه، ۶ دی ۱۴۰۳"
+     * نام روز و ماه از رشته‌های ازپیش‌ساخته کپی می‌شوند
      */
-    fun toPersianText(jy: Int, jm: Int, jd: Int): String {
-        val dayName = getDayName(jy, jm, jd)
-        val monthName = getMonthName(jm)
-        val farsiDay = toFarsiNumbers("$jd")
-        val farsiYear = toFarsiNumbers("$jy")
-        
-        return "$dayName، $farsiDay $monthName $farsiYear"
-    }
+    fun toPersianText(jy: Int, jm: Int, jd: Int): String =
+        NativeDateFormatter.formatDay(NativeJalali.toEpochDay(jy, jm, jd), NativeDateFormatter.TEXT)
     
     /**
-     * نام روزهای هفته
+     * روز جولی مبدأ Unix (۱۹۷۰/۰۱/۰۱)
      */
-    private fun getDayName(jy: Int, jm: Int, jd: Int): String {
-        val days = arrayOf(
-            "شنبه", "یکشنبه", "دوشنبه", "سه‌شنبه",
-            "چهارشنبه", "پنج‌شنبه", "جمعه"
-        )
+    private const val UNIX_EPOCH_JDN = 2440588
+    
+    /**
+     * تبدیل روز Unix (روزهای پس از ۱۹۷۰/۰۱/۰۱) به خورشیدی
+     * الگوریتم مرجع (jalaali-js) که جدول سال‌های NativeJalali از آن ساخته می‌شود
+     */
+    internal fun epochDayToJalali(epochDay: Long): JalaliDate {
+        val jdn = (epochDay + UNIX_EPOCH_JDN).toInt()
+        var jy = jdnToGregorianYear(jdn) - 621
+        val cal = jalaliCalendar(jy)
+        var k = jdn - gregorianToJdn(jy + 621, 3, cal.march)
         
-        val dayOfWeek = calculateDayOfWeek(jy, jm, jd)
-        return days.getOrNull(dayOfWeek) ?: ""
+        val jm: Int
+        val jd: Int
+        if (k >= 0 && k <= 185) {
+            jm = 1 + k / 31
+            jd = 1 + k % 31
+        } else {
+            if (k >= 0) {
+                k -= 186
+            } else {
+                jy--
+                k += if (cal.leap == 1) 180 else 179
+            }
+            jm = 7 + k / 30
+            jd = 1 + k % 30
+        }
+        
+        // ۱۹۷۰/۰۱/۰۱ پنج‌شنبه بود: روز ۵ از شنبه
+        val weekday = Math.floorMod(epochDay + 5, 7L).toInt()
+        return JalaliDate.of(jy, jm, jd, weekday)
     }
     
     /**
-     * نام ماه‌های سال خورشیدی
+     * تبدیل تاریخ خورشیدی به روز Unix
      */
-    private fun getMonthName(jm: Int): String {
-        val months = arrayOf(
-            "", "فروردین", "اردیبهشت", "خرداد", "تیر", "مرداد", "شهریور",
-            "مهر", "آبان", "آذر", "دی", "بهمن", "اسفند"
-        )
-        return months.getOrNull(jm) ?: ""
+    internal fun jalaliToEpochDay(jy: Int, jm: Int, jd: Int): Long {
+        val cal = jalaliCalendar(jy)
+        val jdn = gregorianToJdn(jy + 621, 3, cal.march) + (jm - 1) * 31 - (jm / 7) * (jm - 7) + jd - 1
+        return (jdn - UNIX_EPOCH_JDN).toLong()
     }
     
+    private class JalaliYear(val leap: Int, val march: Int)
+    
     /**
-     * الگوریتم تبدیل میلادی به خورشیدی
+     * کبیسه بودن سال خورشیدی و روز اسفند/مارس آغاز آن
+     * leap == 0 یعنی سال کبیسه است
      */
-    private fun gregorianToJalali(gy: Int, gm: Int, gd: Int): Triple<Int, Int, Int> {
-        val gy2 = if (gm > 2) gy + 1 else gy
-        val days = 365 * gy + ((gy2 + 3) / 4) - ((gy2 + 99) / 100) + ((gy2 + 399) / 400)
-            .also {
-                val dm = intArrayOf(0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334)
-                return@also it + dm[gm - 1] + gd
-            }
+    private fun jalaliCalendar(jy: Int): JalaliYear {
+        val gy = jy + 621
+        var leapJ = -14
+        var jp = jy_breaks[0]
+        var jump = 0
         
-        var jy = -1595 + 33 * (days / 12053) + 4 * ((days % 12053) / 1461)
-        var g_d_n = days - 365 * jy - ((jy + 3) / 4) + ((jy + 99) / 100) - ((jy + 399) / 400)
-        
-        for (i in jy_breaks.indices) {
-            var jm = 0
-            var jump = 0
-            
-            if (i == 0) {
-                jump = jy_breaks[0]
-            } else if (jy < jy_breaks[i]) {
-                jump = jy_breaks[i - 1]
-            }
-            
-            if (jy < jy_breaks[i]) break
-            
-            jy += 33 * (((days - 365 * jy - ((jy + 3) / 4) + ((jy + 99) / 100) - ((jy + 399) / 400))) / 12053)
+        for (i in 1 until jy_breaks.size) {
+            val jm = jy_breaks[i]
+            jump = jm - jp
+            if (jy < jm) break
+            leapJ += jump / 33 * 8 + jump % 33 / 4
+            jp = jm
         }
         
-        g_d_n = days - 365 * jy - ((jy + 3) / 4) + ((jy + 99) / 100) - ((jy + 399) / 400)
+        var n = jy - jp
+        leapJ += n / 33 * 8 + (n % 33 + 3) / 4
+        if (jump % 33 == 4 && jump - n == 4) leapJ++
         
-        var jm = 0
-        if (g_d_n < 186) {
-            jm = 1 + g_d_n / 31
-        } else {
-            jm = 7 + (g_d_n - 186) / 30
-        }
+        val leapG = gy / 4 - (gy / 100 + 1) * 3 / 4 - 150
+        val march = 20 + leapJ - leapG
         
-        val jd = 1 + (if (g_d_n < 186) g_d_n % 31 else (g_d_n - 186) % 30)
+        if (jump - n < 6) n = n - jump + (jump + 4) / 33 * 33
+        var leap = ((n + 1) % 33 - 1) % 4
+        if (leap == -1) leap = 4
         
-        return Triple(jy, jm, jd)
+        return JalaliYear(leap, march)
+    }
+    
+    /**
+     * روز جولی یک تاریخ میلادی
+     */
+    private fun gregorianToJdn(gy: Int, gm: Int, gd: Int): Int {
+        val d = (gy + (gm - 8) / 6 + 100100) * 1461 / 4 +
+            (153 * ((gm + 9) % 12) + 2) / 5 + gd - 34840408
+        return d - (gy + 100100 + (gm - 8) / 6) / 100 * 3 / 4 + 752
     }
     
     /**
-     * محاسبه روز هفته (برای بدستالی)
+     * سال میلادی یک روز جولی
      */
-    private fun calculateDayOfWeek(jy: Int, jm: Int, jd: Int): Int {
-        val a = ((14 - jm) / 12)
-        val y = jy + 4800 - a
-        val m = jm + 12 * a - 3
-        return (jd + ((153 * m + 2) / 5) + 365 * y + (y / 4) - (y / 100) + (y / 400)) % 7
+    private fun jdnToGregorianYear(jdn: Int): Int {
+        var j = 4 * jdn + 139361631
+        j += (4 * jdn + 183187720) / 146097 * 3 / 4 * 4 - 3908
+        val i = j % 1461 / 4 * 5 + 308
+        val gm = i / 153 % 12 + 1
+        return j / 1461 - 100100 + (8 - gm) / 6
     }
 }
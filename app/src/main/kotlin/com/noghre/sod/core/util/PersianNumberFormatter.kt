@@ -31,12 +31,6 @@ object PersianNumberFormatter {
         '۹'   // 9 → ۹
     )
     
-    // Persian thousands separator (comma in Persian: ٬)
-    private const val PERSIAN_COMMA = '٬'  // Persian separator for thousands
-    
-    // Persian minus sign
-    private const val PERSIAN_MINUS = '−'   // Unicode minus sign
-    
     /**
      * Format a number in Persian.
      * 
@@ -50,32 +44,7 @@ object PersianNumberFormatter {
      * - 1234567 → "۱٬۲۳۴٬۵۶۷"
      * - -500 → "−۵۰۰"
      */
-    fun format(value: Long): String {
-        if (value == 0L) return persianDigits[0].toString()
-        
-        val isNegative = value < 0
-        val absValue = if (isNegative) -value else value
-        
-        // Convert to string and split from right to left in groups of 3
-        val stringValue = absValue.toString()
-        val parts = stringValue.reversed().chunked(3).reversed()
-        
-        // Format each part and rejoin with Persian comma
-        val formattedParts = parts.map { part ->
-            part.reversed().map { digit ->
-                persianDigits[digit.toString().toInt()]
-            }.joinToString("")
-        }
-        
-        var result = formattedParts.joinToString(PERSIAN_COMMA.toString())
-        
-        // Add Persian minus sign if negative
-        if (isNegative) {
-            result = "$PERSIAN_MINUS$result"
-        }
-        
-        return result
-    }
+    fun format(value: Long): String = NativePriceFormatter.format(value)
     
     /**
      * Format a Toman amount with currency label.
@@ -83,10 +52,21 @@ object PersianNumberFormatter {
      * @param toman Toman value
      * @return Formatted string with Persian digits and "تومان" label
      * 
-     * Example: Toman(123456) → "۱٬۲۳۴٬۵۶ تومان"
+     * Example: Toman(123456) → "۱۲۳٬۴۵۶ تومان"
      */
     fun formatTomanPrice(toman: Toman): String {
-        return "${format(toman.value)} تومان"
+        return NativePriceFormatter.format(toman.value, toman = true)
+    }
+    
+    /**
+     * Format a whole page of Toman amounts in one native call.
+     * 
+     * @param prices Toman values, e.g. every product on a grid page
+     * @return Formatted strings, in order, as by [formatTomanPrice]
+     */
+    fun formatTomanPrices(prices: List<Toman>): List<String> {
+        val values = LongArray(prices.size) { prices[it].value }
+        return NativePriceFormatter.formatAll(values, toman = true)
     }
     
     /**
@@ -144,10 +124,6 @@ object PersianNumberFormatter {
      * 
      * Example: (1404, 10, 8) → "۱۴۰۴/۱۰/۰۸"
      */
-    fun formatJalaliDate(year: Int, month: Int, day: Int): String {
-        val yearStr = format(year.toLong())
-        val monthStr = String.format("%02d", month).map { persianDigits[it.toString().toInt()] }.joinToString("")
-        val dayStr = String.format("%02d", day).map { persianDigits[it.toString().toInt()] }.joinToString("")
-        return "$yearStr/$monthStr/$dayStr"
-    }
+    fun formatJalaliDate(year: Int, month: Int, day: Int): String =
+        NativeDateFormatter.formatDay(NativeJalali.toEpochDay(year, month, day), NativeDateFormatter.NUMERIC)
 }
\ No newline at end of file
@@ -1,7 +1,5 @@
 package com.noghre.sod.core.util
 
-import java.text.DecimalFormat
-import java.text.DecimalFormatSymbols
 import java.util.Locale
 
 /**
@@ -10,53 +8,28 @@ import java.util.Locale
  */
 object PersianUtils {
     
-    private val persianDigits = arrayOf('۰', '۱', '۲', '۳', '۴', '۵', '۶', '۷', '۸', '۹')
+    private val dateTimePattern = NativeDateFormatter.Pattern("yyyy/MM/dd - HH:mm")
     
     /**
-     * Convert English digits to Persian digits
+     * Convert English (and Arabic-Indic) digits to Persian digits
      * Example: "123" -> "۱۲۳"
      */
-    fun toPersianDigits(input: String): String {
-        val builder = StringBuilder()
-        for (char in input) {
-            if (char.isDigit()) {
-                builder.append(persianDigits[char.toString().toInt()])
-            } else {
-                builder.append(char)
-            }
-        }
-        return builder.toString()
-    }
+    fun toPersianDigits(input: String): String =
+        NativeDigits.convert(input, NativeDigits.Script.PERSIAN)
     
     /**
-     * Convert Persian digits to English digits
+     * Convert Persian (and Arabic-Indic) digits to English digits
      * Example: "۱۲۳" -> "123"
      */
-    fun toEnglishDigits(input: String): String {
-        var result = input
-        for (i in persianDigits.indices) {
-            result = result.replace(persianDigits[i], ('0' + i))
-        }
-        return result
-    }
+    fun toEnglishDigits(input: String): String =
+        NativeDigits.convert(input, NativeDigits.Script.LATIN)
     
     /**
      * Format price in Toman (Iranian currency)
-     * Example: 1500000 -> "۱,۵۰۰,۰۰۰ تومان"
+     * Example: 1500000 -> "۱٬۵۰۰٬۰۰۰ تومان"
      */
-    fun formatPrice(price: Double, usePersianDigits: Boolean = true): String {
-        val symbols = DecimalFormatSymbols(Locale.US)
-        symbols.groupingSeparator = ','
-        
-        val formatter = DecimalFormat("#,###", symbols)
-        val formatted = formatter.format(price.toLong())
-        
-        return if (usePersianDigits) {
-            "${toPersianDigits(formatted)} تومان"
-        } else {
-            "$formatted تومان"
-        }
-    }
+    fun formatPrice(price: Double, usePersianDigits: Boolean = true): String =
+        NativePriceFormatter.format(price.toLong(), toman = true, persianDigits = usePersianDigits)
     
     /**
      * Format weight in grams
@@ -131,12 +104,10 @@ object PersianUtils {
     
     /**
      * Get Persian date/time string
-     * TODO: Integrate with Persian Calendar library
+     * Example: "۱۴۰۳/۱۰/۰۸ - ۱۳:۰۰"
      */
-    fun getPersianDate(timestamp: Long): String {
-        val sdf = java.text.SimpleDateFormat("yyyy/MM/dd - HH:mm", Locale.US)
-        return sdf.format(java.util.Date(timestamp))
-    }
+    fun getPersianDate(timestamp: Long): String =
+        NativeDateFormatter.format(timestamp, dateTimePattern)
 }
 
 /**
@@ -0,0 +1,107 @@
+package com.noghre.sod.core.monitoring
+
+import org.junit.Test
+import com.google.common.truth.Truth.assertThat
+import java.nio.ByteBuffer
+import java.nio.ByteOrder
+
+/**
+ * Unit tests for decoding the native stats snapshot
+ *
+ * Snapshots are built here in the layout documented on
+ * NativeStats::snapshot() (native_stats.h).
+ */
+class NativeEntryStatsTest {
+
+    private class Entry(
+        val name: String,
+        val calls: Long,
+        val totalNs: Long,
+        val maxNs: Long,
+        val buckets: List<Pair<Int, Int>>
+    )
+
+    private fun snapshot(vararg entries: Entry, version: Int = 1, subBucketBits: Int = 2): ByteArray {
+        val buffer = ByteBuffer.allocate(4096).order(ByteOrder.nativeOrder())
+        buffer.putInt(version).putInt(entries.size).putInt(subBucketBits)
+        for (entry in entries) {
+            val name = entry.name.toByteArray(Charsets.UTF_8)
+            buffer.putInt(name.size).put(name)
+            buffer.putLong(entry.calls).putLong(entry.totalNs).putLong(entry.maxNs)
+            buffer.putInt(entry.buckets.size)
+            for ((bucket, count) in entry.buckets) {
+                buffer.putInt(bucket).putInt(count)
+            }
+        }
+        return buffer.array().copyOf(buffer.position())
+    }
+
+    // ==================== Decoding ====================
+
+    @Test
+    fun `empty snapshot decodes to no entries`() {
+        assertThat(NativeEntryStats.decode(snapshot())).isEmpty()
+    }
+
+    @Test
+    fun `entries decode with their histograms`() {
+        val stats = NativeEntryStats.decode(snapshot(
+            Entry("KeyProvider.getApiKey", 3, 300, 150, listOf(24 to 2, 29 to 1)),
+            Entry("NativeKeys.getApiUrl", 1, 40, 40, listOf(17 to 1))
+        ))
+
+        assertThat(stats).hasSize(2)
+        assertThat(stats[0].name).isEqualTo("KeyProvider.getApiKey")
+        assertThat(stats[0].calls).isEqualTo(3L)
+        assertThat(stats[0].meanNs).isEqualTo(100L)
+        assertThat(stats[0].maxNs).isEqualTo(150L)
+        assertThat(stats[0].buckets).containsExactly(24, 2, 29, 1)
+        assertThat(stats[1].name).isEqualTo("NativeKeys.getApiUrl")
+    }
+
+    @Test(expected = IllegalArgumentException::class)
+    fun `unknown version is rejected`() {
+        NativeEntryStats.decode(snapshot(version = 2))
+    }
+
+    @Test(expected = IllegalArgumentException::class)
+    fun `truncated snapshot is rejected`() {
+        val bytes = snapshot(Entry("NativeKeys.getApiUrl", 1, 40, 40, listOf(17 to 1)))
+        NativeEntryStats.decode(bytes.copyOf(bytes.size - 4))
+    }
+
+    // ==================== Histogram ====================
+
+    @Test
+    fun `bucket lower bounds match the native log-linear layout`() {
+        // Exact below 2^subBucketBits, then four linear steps per power of two
+        assertThat(NativeEntryStats.bucketLowerBound(3, 2)).isEqualTo(3L)
+        assertThat(NativeEntryStats.bucketLowerBound(4, 2)).isEqualTo(4L)
+        assertThat(NativeEntryStats.bucketLowerBound(8, 2)).isEqualTo(8L)
+        assertThat(NativeEntryStats.bucketLowerBound(9, 2)).isEqualTo(10L)
+        assertThat(NativeEntryStats.bucketLowerBound(12, 2)).isEqualTo(16L)
+        assertThat(NativeEntryStats.bucketLowerBound(36, 2)).isEqualTo(1024L)
+    }
+
+    @Test
+    fun `percentiles walk the histogram`() {
+        // 98 calls at ~1 us (bucket 36), two at ~1 ms (bucket 76)
+        val stats = NativeEntryStats.decode(snapshot(
+            Entry("NativeCrypto.nativeUpdate", 100, 0, 1_100_000, listOf(76 to 2, 36 to 98))
+        )).single()
+
+        assertThat(stats.percentileNs(50.0)).isEqualTo(1024L)
+        assertThat(stats.percentileNs(98.0)).isEqualTo(1024L)
+        assertThat(stats.percentileNs(99.0)).isEqualTo(1L shl 20)
+        assertThat(stats.percentileNs(100.0)).isEqualTo(1L shl 20)
+    }
+
+    @Test
+    fun `percentile never exceeds the recorded maximum`() {
+        val stats = NativeEntryStats.decode(snapshot(
+            Entry("NativeKeys.getMaxRetries", 1, 9, 9, listOf(9 to 1))
+        )).single()
+
+        assertThat(stats.percentileNs(99.0)).isAtMost(9L)
+    }
+}
@@ -0,0 +1,101 @@
+package com.noghre.sod.core.util
+
+import org.junit.Assert.assertThrows
+import org.junit.Test
+import com.google.common.truth.Truth.assertThat
+import java.util.TimeZone
+
+/**
+ * Unit tests برای NativeDateFormatter
+ * 
+ * اهداف:
+ * - تست patternهای تاریخ شمسی (نام ماه و روز، ارقام فارسی)
+ * - تست quoted text و ردّ patternهای نامعتبر
+ * - تست batch formatting و تغییر DST
+ */
+class NativeDateFormatterTest {
+
+    // 2024-12-28T09:30Z: Saturday 8 Dey 1403, 13:00 in Tehran
+    private val instant = 1_735_378_200_000L
+    private val tehran = TimeZone.getTimeZone("GMT+03:30")
+
+    // ==================== Patterns ====================
+
+    @Test
+    fun `names and numbers are formatted`() {
+        assertThat(NativeDateFormatter.format(instant, NativeDateFormatter.LONG, tehran))
+            .isEqualTo("شنبه ۸ دی ۱۴۰۳")
+        assertThat(NativeDateFormatter.format(instant, NativeDateFormatter.NUMERIC_TIME, tehran))
+            .isEqualTo("۱۴۰۳/۱۰/۰۸ ۱۳:۰۰")
+        assertThat(NativeDateFormatter.format(instant, NativeDateFormatter.NUMERIC_TIME, tehran, persianDigits = false))
+            .isEqualTo("1403/10/08 13:00")
+    }
+
+    @Test
+    fun `quoted text is literal`() {
+        val pattern = NativeDateFormatter.Pattern("d 'of' MMMM, ''yy")
+        assertThat(NativeDateFormatter.format(instant, pattern, tehran, persianDigits = false))
+            .isEqualTo("8 of دی, '03")
+    }
+
+    @Test
+    fun `invalid patterns are rejected`() {
+        assertThrows(IllegalArgumentException::class.java) { NativeDateFormatter.Pattern("yyyy-QQ") }
+        assertThrows(IllegalArgumentException::class.java) { NativeDateFormatter.Pattern("'open") }
+        assertThrows(IllegalArgumentException::class.java) {
+            NativeDateFormatter.Pattern("d".repeat(NativeDateFormatter.MAX_PATTERN_LENGTH + 1))
+        }
+    }
+
+    @Test
+    fun `patterns are parsed once and shared`() {
+        assertThat(NativeDateFormatter.patternOf("yyyy/MM/dd")).isSameInstanceAs(NativeDateFormatter.NUMERIC)
+        val custom = NativeDateFormatter.patternOf("d MMMM")
+        assertThat(NativeDateFormatter.patternOf("d MMMM")).isSameInstanceAs(custom)
+        assertThrows(IllegalArgumentException::class.java) { NativeDateFormatter.patternOf("yyyy-QQ") }
+    }
+
+    @Test
+    fun `maxLength covers the longest names`() {
+        assertThat(NativeDateFormatter.LONG.maxLength).isEqualTo(25)
+        assertThat(NativeDateFormatter.NUMERIC_TIME.maxLength).isEqualTo(16)
+        // 5 Ordibehesht 1403 was a Wednesday (چهارشنبه): both names at full length
+        val longest = NativeDateFormatter.formatDay(NativeJalali.toEpochDay(1403, 2, 5), NativeDateFormatter.LONG)
+        assertThat(longest.length).isAtMost(NativeDateFormatter.LONG.maxLength)
+    }
+
+    @Test
+    fun `calendar days format at midnight`() {
+        assertThat(NativeDateFormatter.formatDay(20085, NativeDateFormatter.TEXT)).isEqualTo("شنبه، ۸ دی ۱۴۰۳")
+        assertThat(PersianDateConverter.toPersianText(1403, 10, 6)).isEqualTo("پنج‌شنبه، ۶ دی ۱۴۰۳")
+        assertThat(PersianNumberFormatter.formatJalaliDate(1404, 10, 8)).isEqualTo("۱۴۰۴/۱۰/۰۸")
+    }
+
+    // ==================== Batch ====================
+
+    @Test
+    fun `batch packs dates back to back`() {
+        val millis = longArrayOf(instant, instant - 86_400_000L)
+        val pattern = NativeDateFormatter.NUMERIC_TIME
+        val out = CharArray(millis.size * pattern.maxLength)
+        val ends = IntArray(millis.size)
+
+        val written = NativeDateFormatter.formatAllInto(millis, pattern, out, ends, tehran)
+
+        assertThat(written).isEqualTo(32)
+        assertThat(String(out, 0, ends[0])).isEqualTo("۱۴۰۳/۱۰/۰۸ ۱۳:۰۰")
+        assertThat(String(out, ends[0], ends[1] - ends[0])).isEqualTo("۱۴۰۳/۱۰/۰۷ ۱۳:۰۰")
+    }
+
+    @Test
+    fun `batch matches single dates across a DST change`() {
+        val berlin = TimeZone.getTimeZone("Europe/Berlin")
+        val millis = LongArray(60) { instant + it * 7L * 86_400_000L }
+
+        val formatted = NativeDateFormatter.formatAll(millis, NativeDateFormatter.NUMERIC_TIME, berlin)
+
+        for (i in millis.indices) {
+            assertThat(formatted[i]).isEqualTo(NativeDateFormatter.format(millis[i], NativeDateFormatter.NUMERIC_TIME, berlin))
+        }
+    }
+}
@@ -0,0 +1,72 @@
+package com.noghre.sod.core.util
+
+import org.junit.Test
+import com.google.common.truth.Truth.assertThat
+import com.noghre.sod.core.util.NativeDigits.Script
+
+/**
+ * Unit tests برای NativeDigits
+ * 
+ * اهداف:
+ * - تبدیل ارقام همه‌ی scriptها به فارسی در یک pass
+ * - حفظ کاراکترهای غیر رقمی و مرز digit blockها
+ * - تست batch conversion و PersianUtils
+ * - همان caseهای bench/digit_transcoder_bench.cpp
+ */
+class NativeDigitsTest {
+
+    // ==================== Single strings ====================
+
+    @Test
+    fun `every script converts to Persian`() {
+        assertThat(NativeDigits.convert("0123456789", Script.PERSIAN)).isEqualTo("۰۱۲۳۴۵۶۷۸۹")
+        assertThat(NativeDigits.convert("٠١٢٣٤٥٦٧٨٩", Script.PERSIAN)).isEqualTo("۰۱۲۳۴۵۶۷۸۹")
+    }
+
+    @Test
+    fun `mixed scripts convert in one pass`() {
+        assertThat(NativeDigits.convert("1۲٣", Script.LATIN)).isEqualTo("123")
+        assertThat(NativeDigits.convert("1۲٣", Script.ARABIC_INDIC)).isEqualTo("١٢٣")
+    }
+
+    @Test
+    fun `non-digits are kept`() {
+        val result = NativeDigits.convert("قیمت: 1,250 تومان / x:9", Script.PERSIAN)
+        assertThat(result).isEqualTo("قیمت: ۱,۲۵۰ تومان / x:۹")
+    }
+
+    @Test
+    fun `unchanged input is returned as is`() {
+        val input = "۱۲۳ گرم"
+        assertThat(NativeDigits.convert(input, Script.PERSIAN)).isSameInstanceAs(input)
+    }
+
+    @Test
+    fun `characters next to the digit blocks are not digits`() {
+        // '/' ':' U+065F U+066A U+06EF U+06FA
+        val input = "/:ٟ٪ۯۺ"
+        assertThat(NativeDigits.convert(input, Script.LATIN)).isEqualTo(input)
+    }
+
+    // ==================== Batches ====================
+
+    @Test
+    fun `batch converts each string`() {
+        val result = NativeDigits.convertAll(listOf("12", "", "abc", "۳٤5"), Script.LATIN)
+        assertThat(result).containsExactly("12", "", "abc", "345").inOrder()
+    }
+
+    @Test
+    fun `empty batch is empty`() {
+        assertThat(NativeDigits.convertAll(emptyList(), Script.PERSIAN)).isEmpty()
+    }
+
+    // ==================== PersianUtils ====================
+
+    @Test
+    fun `PersianUtils round trips through NativeDigits`() {
+        assertThat(PersianUtils.toPersianDigits("0912 345 6789")).isEqualTo("۰۹۱۲ ۳۴۵ ۶۷۸۹")
+        assertThat(PersianUtils.toEnglishDigits("۰۹۱۲ ۳۴۵ ۶۷۸۹")).isEqualTo("0912 345 6789")
+        assertThat(PersianUtils.toEnglishDigits("١٢٣")).isEqualTo("123")
+    }
+}
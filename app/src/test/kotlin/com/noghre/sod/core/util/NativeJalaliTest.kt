@@ -0,0 +1,92 @@
+package com.noghre.sod.core.util
+
+import org.junit.Test
+import com.google.common.truth.Truth.assertThat
+import java.util.Calendar
+import java.util.TimeZone
+
+/**
+ * Unit tests برای NativeJalali
+ * 
+ * اهداف:
+ * - تبدیل epoch day به تاریخ شمسی و برعکس
+ * - تطابق با PersianDateConverter در کل جدول سال‌ها
+ * - تست batch conversion با zone offset
+ */
+class NativeJalaliTest {
+
+    // ==================== Single dates ====================
+
+    @Test
+    fun `known dates convert`() {
+        assertThat(NativeJalali.fromEpochDay(19802)).isEqualTo(JalaliDate.of(1403, 1, 1, 4))
+        assertThat(NativeJalali.fromEpochDay(20085)).isEqualTo(JalaliDate.of(1403, 10, 8, 0))
+        assertThat(NativeJalali.fromEpochDay(20167)).isEqualTo(JalaliDate.of(1403, 12, 30, 5))
+        assertThat(NativeJalali.fromEpochDay(19801)).isEqualTo(JalaliDate.of(1402, 12, 29, 3))
+        assertThat(NativeJalali.fromEpochDay(3328)).isEqualTo(JalaliDate.of(1357, 11, 22, 1))
+    }
+
+    @Test
+    fun `packed fields unpack`() {
+        val date = JalaliDate.of(1403, 12, 30, 5)
+        assertThat(date.year).isEqualTo(1403)
+        assertThat(date.month).isEqualTo(12)
+        assertThat(date.day).isEqualTo(30)
+        assertThat(date.weekday).isEqualTo(5)
+    }
+
+    @Test
+    fun `epoch days round trip over the table`() {
+        val first = NativeJalali.toEpochDay(NativeJalali.FIRST_YEAR, 1, 1)
+        val last = NativeJalali.toEpochDay(NativeJalali.LAST_YEAR + 1, 1, 1) - 1
+        assertThat(first).isEqualTo(-17818L)
+        assertThat(last).isEqualTo(55595L)
+
+        var previous = NativeJalali.fromEpochDay(first - 1)
+        for (epochDay in first..last) {
+            val date = NativeJalali.fromEpochDay(epochDay)
+            assertThat(NativeJalali.toEpochDay(date.year, date.month, date.day)).isEqualTo(epochDay)
+            assertThat(date.weekday).isEqualTo((previous.weekday + 1) % 7)
+            previous = date
+        }
+    }
+
+    @Test
+    fun `agrees with the calendar converter`() {
+        val calendar = Calendar.getInstance().apply {
+            set(2024, Calendar.DECEMBER, 28)
+        }
+        assertThat(PersianDateConverter.toJalali(calendar)).isEqualTo(Triple(1403, 10, 8))
+    }
+
+    // ==================== Batch ====================
+
+    @Test
+    fun `batch uses the zone offset`() {
+        val tehran = TimeZone.getTimeZone("GMT+03:30")
+        // 2024-03-19T20:29:59.999Z and a millisecond later
+        val nowruz = 19802L * 86_400_000L - 12_600_000L
+        val millis = longArrayOf(nowruz - 1, nowruz, -1L, 0L)
+        val out = IntArray(millis.size)
+
+        NativeJalali.fromEpochMillisAll(millis, out, tehran)
+
+        assertThat(JalaliDate(out[0])).isEqualTo(NativeJalali.fromEpochDay(19801))
+        assertThat(JalaliDate(out[1])).isEqualTo(NativeJalali.fromEpochDay(19802))
+        assertThat(JalaliDate(out[2])).isEqualTo(NativeJalali.fromEpochDay(0))
+        assertThat(JalaliDate(out[3])).isEqualTo(NativeJalali.fromEpochDay(0))
+    }
+
+    @Test
+    fun `batch matches single conversions`() {
+        val zone = TimeZone.getTimeZone("Asia/Tehran")
+        val millis = LongArray(500) { 1_400_000_000_000L + it * 77_777_777L * 13 }
+        val out = IntArray(millis.size)
+
+        NativeJalali.fromEpochMillisAll(millis, out, zone)
+
+        for (i in millis.indices) {
+            assertThat(JalaliDate(out[i])).isEqualTo(NativeJalali.fromEpochMillis(millis[i], zone))
+        }
+    }
+}
@@ -0,0 +1,156 @@
+package com.noghre.sod.core.util
+
+import com.noghre.sod.core.ext.calculateTax
+import com.noghre.sod.core.ext.calculateTotal
+import com.noghre.sod.core.ext.formatJewelryPrice
+import com.noghre.sod.core.ext.toRials
+import com.noghre.sod.core.util.NativeMoney.Rounding
+import org.junit.Assert.assertThrows
+import org.junit.Test
+import com.google.common.truth.Truth.assertThat
+
+/**
+ * Unit tests برای NativeMoney
+ * 
+ * اهداف:
+ * - تست rounding modeها و overflow
+ * - تست محاسبه‌ی قیمت (فلز، اجرت، تخفیف، مالیات)
+ * - تطابق checksum کاتالوگ با bench/money_bench.cpp
+ * - تست MoneyExt با Double
+ */
+class NativeMoneyTest {
+
+    // ==================== Rounding ====================
+
+    @Test
+    fun `each rounding mode breaks ties its own way`() {
+        // 2.5, 3.5, -2.5 and 2.4 in every mode
+        assertThat(Rounding.values().map { NativeMoney.mulDiv(25, 1, 10, it) }).containsExactly(3L, 2L, 2L, 3L).inOrder()
+        assertThat(Rounding.values().map { NativeMoney.mulDiv(35, 1, 10, it) }).containsExactly(4L, 4L, 3L, 4L).inOrder()
+        assertThat(Rounding.values().map { NativeMoney.mulDiv(-25, 1, 10, it) }).containsExactly(-3L, -2L, -2L, -3L).inOrder()
+        assertThat(Rounding.values().map { NativeMoney.mulDiv(24, 1, 10, it) }).containsExactly(2L, 2L, 2L, 3L).inOrder()
+    }
+
+    @Test
+    fun `overflowing products are rejected`() {
+        assertThrows(ArithmeticException::class.java) { NativeMoney.mulDiv(Long.MAX_VALUE, 2, 10) }
+        assertThrows(ArithmeticException::class.java) { NativeMoney.mulDiv(Long.MIN_VALUE, 1, 10) }
+        assertThat(NativeMoney.mulDivOrNull(Long.MAX_VALUE, 2, 10)).isNull()
+        assertThat(NativeMoney.mulDivOrNull(-1, Long.MIN_VALUE, 10)).isNull()
+        assertThat(NativeMoney.mulDivOrNull(-25, 1, 10)).isEqualTo(-3L)
+    }
+
+    // ==================== Products ====================
+
+    @Test
+    fun `price breaks down metal, wage, discount and tax`() {
+        // 12.345 g at 1,234,567 Rial/g, 2,000,000 wage, 5% off, 9% VAT
+        val price = NativeMoney.price(12_345, 1_234_567, wage = 2_000_000, discountBps = 500)
+
+        assertThat(price).isEqualTo(
+            NativeMoney.PriceBreakdown(
+                metal = 15_240_730L,
+                wage = 2_000_000L,
+                discount = 862_037L,
+                tax = 1_474_082L,
+                total = 17_852_775L
+            )
+        )
+        assertThat(NativeMoney.price(12_345, 1_234_567, 2_000_000, 500, rounding = Rounding.HALF_EVEN).discount)
+            .isEqualTo(862_036L)
+    }
+
+    @Test
+    fun `the largest inputs stay exact and larger ones are rejected`() {
+        val max = NativeMoney.price(
+            NativeMoney.MAX_WEIGHT_MG, NativeMoney.MAX_PRICE_PER_GRAM, NativeMoney.MAX_WAGE,
+            taxBps = NativeMoney.BASIS_POINTS, rounding = Rounding.UP
+        )
+        assertThat(max.total).isEqualTo(400_000_000_000_000L)
+
+        assertThrows(IllegalArgumentException::class.java) { NativeMoney.price(NativeMoney.MAX_WEIGHT_MG + 1, 1) }
+        assertThrows(IllegalArgumentException::class.java) { NativeMoney.price(1, -1) }
+        assertThrows(IllegalArgumentException::class.java) { NativeMoney.price(1, 1, discountBps = 10_001) }
+    }
+
+    // ==================== Batch ====================
+
+    @Test
+    fun `catalog totals match the native checksum`() {
+        val catalog = Catalog(10_000)
+        val totals = LongArray(catalog.size)
+        var hash = -0x340d631b7bdddcdbL             // FNV-1a offset basis
+
+        for (rounding in Rounding.values()) {
+            NativeMoney.priceAll(catalog.weightMg, catalog.wage, catalog.discountBps, 1_234_567, rounding = rounding, totals = totals)
+            for (total in totals) {
+                hash = (hash xor total) * 0x100000001b3L
+            }
+        }
+
+        // CATALOG_CHECKSUM in bench/money_bench.cpp
+        assertThat(hash).isEqualTo(-0x47aa943491cac0baL)
+    }
+
+    @Test
+    fun `batch matches single products and stops at bad input`() {
+        val catalog = Catalog(100)
+        val totals = NativeMoney.priceAll(catalog.weightMg, catalog.wage, null, 1_234_567)
+
+        for (i in 0 until catalog.size) {
+            assertThat(totals[i]).isEqualTo(NativeMoney.price(catalog.weightMg[i], 1_234_567, catalog.wage[i]).total)
+        }
+        catalog.wage[17] = -1
+        assertThrows(IllegalArgumentException::class.java) {
+            NativeMoney.priceAll(catalog.weightMg, catalog.wage, null, 1_234_567)
+        }
+    }
+
+    // ==================== MoneyExt ====================
+
+    @Test
+    fun `Double prices are computed in whole Rials`() {
+        assertThat(1_000_000.0.calculateTotal(10.0)).isEqualTo(981_000.0)
+        // 0.1 + 0.2 in Double is 0.30000000000000004
+        assertThat((0.1 + 0.2).calculateTotal(0.0)).isEqualTo(0.0)
+        // Above Int.MAX_VALUE, where the old toRials() overflowed
+        assertThat(3_000_000_000.4.toRials()).isEqualTo(3_000_000_000L)
+    }
+
+    @Test
+    fun `Double prices and labels never throw on huge amounts`() {
+        // Beyond exact Rials the Double arithmetic is kept
+        assertThat(1e300.calculateTax(9.0)).isEqualTo(1e300 * 0.09)
+        assertThat(1e15.calculateTax(1e6)).isEqualTo(1e15 * 1e4)
+        // 20 kg is past MAX_WEIGHT_MG, and 1e30 Rial/g past any Long
+        assertThat(0.0.formatJewelryPrice(20_000.0, 1_000_000.0)).isNotEmpty()
+        assertThat(0.0.formatJewelryPrice(1.0, 1e30)).isNotEmpty()
+    }
+
+    /**
+     * The catalog of makeCatalog() in money_bench.cpp: splitmix64 from 1403.
+     */
+    private class Catalog(val size: Int) {
+        val weightMg = LongArray(size)
+        val wage = LongArray(size)
+        val discountBps = IntArray(size)
+
+        private var state = 1403L
+
+        init {
+            for (i in 0 until size) {
+                weightMg[i] = 500 + (next() ushr 1) % 199_501
+                wage[i] = (next() ushr 1) % 5_000_001
+                discountBps[i] = ((next() ushr 1) % 3001).toInt()
+            }
+        }
+
+        private fun next(): Long {
+            state += -0x61c8864680b583ebL
+            var z = state
+            z = (z xor (z ushr 30)) * -0x40a7b892e31b1a47L
+            z = (z xor (z ushr 27)) * -0x6b2fb644ecceee15L
+            return z xor (z ushr 31)
+        }
+    }
+}
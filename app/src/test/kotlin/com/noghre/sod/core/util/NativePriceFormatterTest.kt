@@ -0,0 +1,84 @@
+package com.noghre.sod.core.util
+
+import org.junit.Test
+import com.google.common.truth.Truth.assertThat
+
+/**
+ * Unit tests برای NativePriceFormatter
+ * 
+ * اهداف:
+ * - جداکننده‌ی هزاری، علامت منفی و پسوند تومان
+ * - تست formatInto و MAX_LENGTH
+ * - تطابق batch با formatting تکی
+ */
+class NativePriceFormatterTest {
+
+    // ==================== Single values ====================
+
+    @Test
+    fun `digits are grouped in threes`() {
+        assertThat(NativePriceFormatter.format(0)).isEqualTo("۰")
+        assertThat(NativePriceFormatter.format(999)).isEqualTo("۹۹۹")
+        assertThat(NativePriceFormatter.format(1000)).isEqualTo("۱٬۰۰۰")
+        assertThat(NativePriceFormatter.format(1234567)).isEqualTo("۱٬۲۳۴٬۵۶۷")
+    }
+
+    @Test
+    fun `negatives use the minus sign`() {
+        assertThat(NativePriceFormatter.format(-500)).isEqualTo("−۵۰۰")
+        assertThat(NativePriceFormatter.format(Long.MIN_VALUE, persianDigits = false))
+            .isEqualTo("-9,223,372,036,854,775,808")
+    }
+
+    @Test
+    fun `Toman suffix is appended`() {
+        assertThat(NativePriceFormatter.format(1500000, toman = true)).isEqualTo("۱٬۵۰۰٬۰۰۰ تومان")
+        assertThat(NativePriceFormatter.format(1500000, toman = true, persianDigits = false))
+            .isEqualTo("1,500,000 تومان")
+    }
+
+    @Test
+    fun `longest value fits MAX_LENGTH`() {
+        val longest = NativePriceFormatter.format(Long.MIN_VALUE, toman = true)
+        assertThat(longest).hasLength(NativePriceFormatter.MAX_LENGTH)
+    }
+
+    @Test
+    fun `formatInto writes at the offset`() {
+        val out = CharArray(NativePriceFormatter.MAX_LENGTH + 2)
+        val length = NativePriceFormatter.formatInto(1250, out, 2)
+        assertThat(String(out, 2, length)).isEqualTo("۱٬۲۵۰")
+        assertThat(out[0]).isEqualTo('\u0000')
+    }
+
+    @Test(expected = IllegalArgumentException::class)
+    fun `formatInto needs room for the longest value`() {
+        NativePriceFormatter.formatInto(1, CharArray(NativePriceFormatter.MAX_LENGTH), 1)
+    }
+
+    // ==================== Batches ====================
+
+    @Test
+    fun `batch matches single formatting`() {
+        val values = longArrayOf(0, 12750000, -42, 1000)
+        val expected = values.map { NativePriceFormatter.format(it, toman = true) }
+        assertThat(NativePriceFormatter.formatAll(values, toman = true)).isEqualTo(expected)
+    }
+
+    @Test
+    fun `batch into reused buffers reports its end offsets`() {
+        val out = CharArray(3 * NativePriceFormatter.MAX_LENGTH)
+        val ends = IntArray(3)
+        val length = NativePriceFormatter.formatAllInto(longArrayOf(5, 1000, -1), out, ends)
+        assertThat(ends.toList()).containsExactly(1, 6, 8).inOrder()
+        assertThat(String(out, 0, length)).isEqualTo("۵۱٬۰۰۰−۱")
+    }
+
+    // ==================== Callers ====================
+
+    @Test
+    fun `PersianUtils formatPrice uses the native formatter`() {
+        assertThat(PersianUtils.formatPrice(1500000.0)).isEqualTo("۱٬۵۰۰٬۰۰۰ تومان")
+        assertThat(PersianUtils.formatPrice(1500000.0, usePersianDigits = false)).isEqualTo("1,500,000 تومان")
+    }
+}
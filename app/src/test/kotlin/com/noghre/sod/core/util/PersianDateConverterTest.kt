@@ -9,14 +9,14 @@ class PersianDateConverterTest {
     @Test
     fun testGregorianToJalaliConversion() {
         val calendar = Calendar.getInstance().apply {
-            set(2024, Calendar.DECEMBER, 28)  // 28 Dec 2024 = 7 Dey 1403
+            set(2024, Calendar.DECEMBER, 28)  // 28 Dec 2024 = 8 Dey 1403
         }
         
         val (jy, jm, jd) = PersianDateConverter.toJalali(calendar)
         
         assertEquals(1403, jy)
         assertEquals(10, jm)  // Dey
-        assertEquals(7, jd)
+        assertEquals(8, jd)
     }
     
     @Test
@@ -43,7 +43,7 @@ class PersianDateConverterTest {
     
     @Test
     fun testJanuaryConversion() {
-        // 1 January 2024 = 12 Dey 1402
+        // 1 January 2024 = 11 Dey 1402
         val calendar = Calendar.getInstance().apply {
             set(2024, Calendar.JANUARY, 1)
         }
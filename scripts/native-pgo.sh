@@ -0,0 +1,52 @@
+#!/bin/bash
+#
+# Native PGO Profile Collection
+# Builds the host benchmarks instrumented with the NDK's own clang, runs them
+# and merges the profiles into app/src/main/cpp/pgo/noghresod.profdata.
+# Release builds pick that file up for every ABI (app/build.gradle.kts).
+#
+# Usage: ANDROID_NDK_HOME=/path/to/ndk/26.1.10909125 scripts/native-pgo.sh
+#
+# Use the NDK that matches ndkVersion: .profdata is only readable by the
+# LLVM version that wrote it.
+#
+
+set -e
+
+NDK="${ANDROID_NDK_HOME:-$ANDROID_NDK_ROOT}"
+if [ ! -d "$NDK" ]; then
+    echo "Set ANDROID_NDK_HOME to the NDK used by app/build.gradle.kts"
+    exit 1
+fi
+
+case "$(uname -s)" in
+    Darwin) HOST_TAG=darwin-x86_64 ;;
+    *) HOST_TAG=linux-x86_64 ;;
+esac
+TOOLCHAIN="$NDK/toolchains/llvm/prebuilt/$HOST_TAG/bin"
+
+ROOT="$(cd "$(dirname "$0")/.." && pwd)"
+SOURCE="$ROOT/app/src/main/cpp"
+BUILD="$ROOT/build/native-pgo"
+PROFILE="$SOURCE/pgo/noghresod.profdata"
+
+echo "Building instrumented host benchmarks..."
+cmake -S "$SOURCE" -B "$BUILD" \
+    -DCMAKE_BUILD_TYPE=Release \
+    -DCMAKE_C_COMPILER="$TOOLCHAIN/clang" \
+    -DCMAKE_CXX_COMPILER="$TOOLCHAIN/clang++" \
+    -DNOGHRESOD_PGO=GENERATE
+cmake --build "$BUILD" -j
+
+echo "Collecting profiles..."
+rm -rf "$BUILD/profiles"
+export LLVM_PROFILE_FILE="$BUILD/profiles/%m-%p.profraw"
+"$BUILD/bench/native_microbench" --min-time-ms=100 --json="$BUILD/pgo-run.json" > /dev/null
+"$BUILD/bench/native_paths_bench" > /dev/null
+"$BUILD/bench/aes_gcm_bench" > /dev/null
+"$BUILD/bench/xor_kernel_bench" > /dev/null
+
+mkdir -p "$(dirname "$PROFILE")"
+"$TOOLCHAIN/llvm-profdata" merge -output="$PROFILE" "$BUILD"/profiles/*.profraw
+
+echo "✓ Profile written to $PROFILE"